@@ -5,11 +5,14 @@
 #ifndef V8_LIBPLATFORM_LIBPLATFORM_H_
 #define V8_LIBPLATFORM_LIBPLATFORM_H_
 
+#include "libplatform/v8-tracing.h"
 #include "v8-platform.h"  // NOLINT(build/include)
 
 namespace v8 {
 namespace platform {
 
+enum class IdleTaskSupport { kDisabled, kEnabled };
+
 /**
  * Returns a new instance of the default v8::Platform implementation.
  *
@@ -17,8 +20,13 @@ namespace platform {
  * is the number of worker threads to allocate for background jobs. If a value
  * of zero is passed, a suitable default based on the current number of
  * processors online will be chosen.
+ * If |idle_task_support| is enabled then the embedder must call
+ * |RunIdleTasks| whenever the message loop of an isolate is idle, otherwise
+ * idle tasks are never run.
  */
-v8::Platform* CreateDefaultPlatform(int thread_pool_size = 0);
+v8::Platform* CreateDefaultPlatform(
+    int thread_pool_size = 0,
+    IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled);
 
 
 /**
@@ -31,6 +39,51 @@ v8::Platform* CreateDefaultPlatform(int thread_pool_size = 0);
  */
 bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate);
 
+/**
+ * Runs pending idle tasks for the given isolate until |idle_time_in_seconds|
+ * have passed or no idle task is left.
+ *
+ * The caller has to make sure that this is called from the right thread, and
+ * only when no other task is pending, e.g. after |PumpMessageLoop| returned
+ * false. The |platform| has to be created using |CreateDefaultPlatform| with
+ * idle task support enabled.
+ */
+void RunIdleTasks(v8::Platform* platform, v8::Isolate* isolate,
+                  double idle_time_in_seconds);
+
+/**
+ * Attempts to set the tracing controller for the given platform.
+ *
+ * The |platform| has to be created using |CreateDefaultPlatform|. The
+ * platform takes ownership of |tracing_controller|, and forwards all trace
+ * events to it from then on.
+ */
+void SetTracingController(
+    v8::Platform* platform,
+    v8::platform::tracing::TracingController* tracing_controller);
+
+/**
+ * Statistics about the background tasks run by a platform, see
+ * GetBackgroundTaskStats. Arrays are indexed by v8::Platform::TaskPriority.
+ */
+struct BackgroundTaskStats {
+  static const int kNumPriorities = 3;
+
+  // Number of tasks taken by a worker thread.
+  uint64_t tasks_run[kNumPriorities];
+  // Total and longest time tasks waited in the queue before they ran.
+  double total_queue_time_in_seconds[kNumPriorities];
+  double max_queue_time_in_seconds[kNumPriorities];
+  // Number of tasks a worker thread took from the queue of another one.
+  uint64_t tasks_stolen;
+};
+
+/**
+ * Fills in |stats| with the statistics about all background tasks that the
+ * given |platform| has started so far. The |platform| has to be created using
+ * |CreateDefaultPlatform|.
+ */
+void GetBackgroundTaskStats(v8::Platform* platform, BackgroundTaskStats* stats);
 
 }  // namespace platform
 }  // namespace v8
@@ -0,0 +1,265 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_V8_TRACING_H_
+#define V8_LIBPLATFORM_V8_TRACING_H_
+
+#include <stdint.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace v8 {
+
+namespace base {
+class Mutex;
+}  // namespace base
+
+namespace platform {
+namespace tracing {
+
+const int kTraceMaxNumArgs = 2;
+
+class TraceObject {
+ public:
+  union ArgValue {
+    bool as_bool;
+    uint64_t as_uint;
+    int64_t as_int;
+    double as_double;
+    const void* as_pointer;
+    const char* as_string;
+  };
+
+  TraceObject() {}
+  ~TraceObject();
+  void Initialize(char phase, const uint8_t* category_enabled_flag,
+                  const char* name, const char* scope, uint64_t id,
+                  uint64_t bind_id, int num_args, const char** arg_names,
+                  const uint8_t* arg_types, const uint64_t* arg_values,
+                  unsigned int flags);
+
+  // Complete ('X') events are recorded as begin ('B') events, because a
+  // chunk may be written out before the event ends. If the event is still
+  // writable when it ends, this turns it back into an 'X' event with a
+  // duration; otherwise a matching 'E' event is added instead.
+  void UpdateDuration();
+
+  int pid() const { return pid_; }
+  int tid() const { return tid_; }
+  char phase() const { return phase_; }
+  const uint8_t* category_enabled_flag() const {
+    return category_enabled_flag_;
+  }
+  const char* name() const { return name_; }
+  const char* scope() const { return scope_; }
+  uint64_t id() const { return id_; }
+  uint64_t bind_id() const { return bind_id_; }
+  int num_args() const { return num_args_; }
+  const char** arg_names() { return arg_names_; }
+  uint8_t* arg_types() { return arg_types_; }
+  ArgValue* arg_values() { return arg_values_; }
+  unsigned int flags() const { return flags_; }
+  int64_t ts() { return ts_; }
+  int64_t tts() { return tts_; }
+  uint64_t duration() { return duration_; }
+  uint64_t cpu_duration() { return cpu_duration_; }
+
+ private:
+  int pid_;
+  int tid_;
+  char phase_;
+  const char* name_;
+  const char* scope_;
+  const uint8_t* category_enabled_flag_;
+  uint64_t id_;
+  uint64_t bind_id_;
+  int num_args_;
+  const char* arg_names_[kTraceMaxNumArgs];
+  uint8_t arg_types_[kTraceMaxNumArgs];
+  ArgValue arg_values_[kTraceMaxNumArgs];
+  char* parameter_copy_storage_ = nullptr;
+  unsigned int flags_;
+  int64_t ts_;
+  int64_t tts_;
+  uint64_t duration_;
+  uint64_t cpu_duration_;
+
+  // Disallow copy and assign
+  TraceObject(const TraceObject&) = delete;
+  void operator=(const TraceObject&) = delete;
+};
+
+class TraceWriter {
+ public:
+  TraceWriter() {}
+  virtual ~TraceWriter() {}
+  virtual void AppendTraceEvent(TraceObject* trace_event) = 0;
+  virtual void Flush() = 0;
+
+  // Returns a writer emitting the Chrome trace-event JSON format to |stream|,
+  // which must outlive the writer.
+  static TraceWriter* CreateJSONTraceWriter(std::ostream& stream);
+
+ private:
+  // Disallow copy and assign
+  TraceWriter(const TraceWriter&) = delete;
+  void operator=(const TraceWriter&) = delete;
+};
+
+class TraceBufferChunk {
+ public:
+  explicit TraceBufferChunk(uint32_t seq);
+
+  void Reset(uint32_t new_seq);
+  bool IsFull() const { return next_free_ == kChunkSize; }
+  TraceObject* AddTraceEvent(size_t* event_index);
+  TraceObject* GetEventAt(size_t index) { return &chunk_[index]; }
+
+  uint32_t seq() const { return seq_; }
+  size_t size() const { return next_free_; }
+
+  static const size_t kChunkSize = 64;
+
+ private:
+  size_t next_free_ = 0;
+  TraceObject chunk_[kChunkSize];
+  uint32_t seq_;
+
+  // Disallow copy and assign
+  TraceBufferChunk(const TraceBufferChunk&) = delete;
+  void operator=(const TraceBufferChunk&) = delete;
+};
+
+class TraceBuffer {
+ public:
+  TraceBuffer() {}
+  virtual ~TraceBuffer() {}
+
+  // Reserves a slot for a new event on the calling thread. Returns nullptr if
+  // the event has to be dropped.
+  virtual TraceObject* AddTraceEvent(uint64_t* handle) = 0;
+
+  // Returns the event for |handle| if the calling thread added it and can
+  // still modify it, and nullptr otherwise.
+  virtual TraceObject* GetEventByHandle(uint64_t handle) = 0;
+
+  // Writes out all buffered events. No events may be added concurrently, and
+  // the buffer cannot be used again afterwards.
+  virtual bool Flush() = 0;
+
+  static const size_t kRingBufferChunks = 1024;
+
+  // Returns a buffer in which every thread fills its own chunks without
+  // locking. Full chunks are handed to a background thread that writes them
+  // to |trace_writer|; if the writer falls behind |max_chunks| chunks, the
+  // oldest unwritten ones are dropped.
+  static TraceBuffer* CreateTraceBufferRingBuffer(size_t max_chunks,
+                                                  TraceWriter* trace_writer);
+
+ private:
+  // Disallow copy and assign
+  TraceBuffer(const TraceBuffer&) = delete;
+  void operator=(const TraceBuffer&) = delete;
+};
+
+class TraceConfig {
+ public:
+  typedef std::vector<std::string> StringList;
+
+  // Returns a config that records the "v8" category.
+  static TraceConfig* CreateDefaultTraceConfig();
+
+  // Parses a comma-separated category filter such as
+  // "v8,-v8.compile,disabled-by-default-v8.*". Categories prefixed with '-'
+  // are excluded and a trailing '*' matches any suffix. If only exclusions
+  // are given, all other categories are recorded. Categories starting with
+  // "disabled-by-default-" are only recorded if they are listed explicitly.
+  static TraceConfig* CreateFromCategoryFilter(const char* filter);
+
+  TraceConfig() {}
+  const StringList& GetIncludedCategories() const {
+    return included_categories_;
+  }
+  const StringList& GetExcludedCategories() const {
+    return excluded_categories_;
+  }
+  void AddIncludedCategory(const char* included_category);
+  void AddExcludedCategory(const char* excluded_category);
+
+  bool IsCategoryGroupEnabled(const char* category_group) const;
+
+ private:
+  StringList included_categories_;
+  StringList excluded_categories_;
+
+  // Disallow copy and assign
+  TraceConfig(const TraceConfig&) = delete;
+  void operator=(const TraceConfig&) = delete;
+};
+
+class TracingController {
+ public:
+  enum Mode { DISABLED = 0, RECORDING_MODE };
+
+  // The pointer returned from GetCategoryGroupEnabled() points to a value
+  // with zero or more of the following bits. Used in this class only.
+  // The TRACE_EVENT macros should only use the value as a bool.
+  // These values must be in sync with macro values in trace_event.h in
+  // Chromium.
+  enum CategoryGroupEnabledFlags {
+    // Category group enabled for the recording mode.
+    ENABLED_FOR_RECORDING = 1 << 0,
+    // Category group enabled by SetEventCallbackEnabled().
+    ENABLED_FOR_EVENT_CALLBACK = 1 << 2,
+    // Category group enabled to export events to ETW.
+    ENABLED_FOR_ETW_EXPORT = 1 << 3
+  };
+
+  TracingController();
+  ~TracingController();
+
+  // Takes ownership of |trace_buffer|, replacing any previous buffer. A
+  // buffer is flushed when tracing stops, so a new one has to be installed
+  // before tracing is started again.
+  void Initialize(TraceBuffer* trace_buffer);
+
+  // The flag pointer returned for a category group stays valid forever, so
+  // the TRACE_EVENT macros can cache it and test it with a single load.
+  const uint8_t* GetCategoryGroupEnabled(const char* category_group);
+  static const char* GetCategoryGroupName(const uint8_t* category_enabled_flag);
+  uint64_t AddTraceEvent(char phase, const uint8_t* category_enabled_flag,
+                         const char* name, const char* scope, uint64_t id,
+                         uint64_t bind_id, int32_t num_args,
+                         const char** arg_names, const uint8_t* arg_types,
+                         const uint64_t* arg_values, unsigned int flags);
+  void UpdateTraceEventDuration(const uint8_t* category_enabled_flag,
+                                const char* name, uint64_t handle);
+
+  // Takes ownership of |trace_config|.
+  void StartTracing(TraceConfig* trace_config);
+  void StopTracing();
+
+ private:
+  const uint8_t* GetCategoryGroupEnabledInternal(const char* category_group);
+  void UpdateCategoryGroupEnabledFlag(size_t category_index);
+  void UpdateCategoryGroupEnabledFlags();
+
+  std::unique_ptr<TraceBuffer> trace_buffer_;
+  std::unique_ptr<TraceConfig> trace_config_;
+  std::unique_ptr<base::Mutex> mutex_;
+  Mode mode_ = DISABLED;
+
+  // Disallow copy and assign
+  TracingController(const TracingController&) = delete;
+  void operator=(const TracingController&) = delete;
+};
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_V8_TRACING_H_
@@ -54,6 +54,21 @@ class Platform {
     kLongRunningTask
   };
 
+  /**
+   * Priority of a background task, see CallPrioritizedOnBackgroundThread.
+   *   - kUserBlockingTask: a thread of the isolate is about to wait for the
+   *     task, e.g. during a parallel phase of a garbage collection.
+   *   - kUserVisibleTask: the result is needed soon, e.g. concurrent sweeping
+   *     or optimization.
+   *   - kBestEffortTask: the task can be postponed behind all other work,
+   *     e.g. returning memory to the operating system.
+   */
+  enum TaskPriority {
+    kUserBlockingTask,
+    kUserVisibleTask,
+    kBestEffortTask
+  };
+
   virtual ~Platform() {}
 
   /**
@@ -75,6 +90,28 @@ class Platform {
   virtual void CallOnBackgroundThread(Task* task,
                                       ExpectedRuntime expected_runtime) = 0;
 
+  /**
+   * Schedules a task to be invoked on a background thread like
+   * |CallOnBackgroundThread|, with the given |priority|. |isolate| is the
+   * isolate the task works for, or NULL. Implementations can use it to share
+   * their threads fairly between isolates.
+   */
+  virtual void CallPrioritizedOnBackgroundThread(Isolate* isolate, Task* task,
+                                                 TaskPriority priority) {
+    CallOnBackgroundThread(task, kShortRunningTask);
+  }
+
+  /**
+   * Schedules a task to be invoked on a background thread for |isolate|, or
+   * NULL, after the given number of seconds |delay_in_seconds|. The Platform
+   * implementation takes ownership of |task|. The default implementation
+   * ignores the delay.
+   */
+  virtual void CallDelayedOnBackgroundThread(Isolate* isolate, Task* task,
+                                             double delay_in_seconds) {
+    CallPrioritizedOnBackgroundThread(isolate, task, kUserVisibleTask);
+  }
+
   /**
    * Schedules a task to be invoked on a foreground thread wrt a specific
    * |isolate|. Tasks posted for the same isolate should be execute in order of
@@ -174,6 +174,56 @@ class V8_EXPORT CpuProfile {
 };
 
 
+/**
+ * A part of a streamed CPU profile, see CpuProfileChunkListener. All data is
+ * only valid during the call to CpuProfileChunkListener::OnChunk.
+ */
+struct CpuProfileChunk {
+  struct Node {
+    unsigned id;
+    /** Id of the parent node, 0 for the root node. */
+    unsigned parent_id;
+    const char* function_name;
+    const char* resource_name;
+    int script_id;
+    int line_number;
+    int column_number;
+  };
+
+  /**
+   * Call tree nodes added since the previous chunk. Parents always come
+   * before their children, the first chunk starts with the root node.
+   */
+  const Node* nodes;
+  int nodes_count;
+
+  /** Ids of the top frame nodes of the samples taken since the last chunk. */
+  const unsigned* samples;
+
+  /**
+   * Time in microseconds between each sample and the previous one. The
+   * first sample of a profile is relative to its start time.
+   */
+  const int* time_deltas;
+  int samples_count;
+};
+
+
+/**
+ * Receives a profile started with CpuProfiler::StartStreamingProfiling.
+ */
+class V8_EXPORT CpuProfileChunkListener {  // NOLINT
+ public:
+  virtual ~CpuProfileChunkListener() {}
+
+  /**
+   * Called on the profiler thread whenever a chunk is due, and on the thread
+   * calling StopProfiling for the last chunk. Must not call into V8.
+   */
+  virtual void OnChunk(const CpuProfileChunk& chunk) = 0;
+};
+
+
 /**
  * Interface for controlling CPU profiling. Instance of the
  * profiler can be retrieved using v8::Isolate::GetCpuProfiler.
@@ -200,6 +250,18 @@ class V8_EXPORT CpuProfiler {
    */
   void StartProfiling(Local<String> title, bool record_samples = false);
 
+  /**
+   * Starts collecting a CPU profile like StartProfiling, but instead of
+   * keeping the samples until the profile is stopped, passes the new call
+   * tree nodes and samples to |listener| every |chunk_interval_ms|
+   * milliseconds. This lets a profile run indefinitely in bounded memory.
+   * The profile returned by StopProfiling has the full call tree but no
+   * samples.
+   */
+  void StartStreamingProfiling(Local<String> title,
+                               CpuProfileChunkListener* listener,
+                               int chunk_interval_ms);
+
   /**
    * Stops collecting CPU profile with a given title and returns it.
    * If the title given is empty, finishes the last profile started.
@@ -443,6 +505,27 @@ class V8_EXPORT AllocationProfile {
     unsigned int count;
   };
 
+  /**
+   * A sampled object that is still alive.
+   */
+  struct Sample {
+    /**
+     * Size of the sampled object.
+     */
+    size_t size;
+
+    /**
+     * Time of the allocation, in milliseconds since the sampling heap
+     * profiler was started.
+     */
+    double allocation_time_ms;
+
+    /**
+     * The number of garbage collections the object has survived.
+     */
+    unsigned int gc_count;
+  };
+
   /**
    * Represents a node in the call-graph.
    */
@@ -493,6 +576,22 @@ class V8_EXPORT AllocationProfile {
      * List of self allocations done by this node in the call-graph.
      */
     std::vector<Allocation> allocations;
+
+    /**
+     * The sampled objects behind |allocations|, with their age.
+     */
+    std::vector<Sample> samples;
+
+    /**
+     * Estimated number of bytes this node has allocated since sampling was
+     * started, including objects that have been collected since.
+     */
+    size_t allocated_size;
+
+    /**
+     * Estimated number of bytes allocated by this node that are still alive.
+     */
+    size_t retained_size;
   };
 
   /**
@@ -518,6 +617,9 @@ class V8_EXPORT HeapProfiler {
   enum SamplingFlags {
     kSamplingNoFlags = 0,
     kSamplingForceGC = 1 << 0,
+    // Keeps reporting the allocation sites whose sampled objects have all
+    // been collected, so that their allocated size stays available.
+    kSamplingKeepCollectedSites = 1 << 1,
   };
 
   /**
@@ -583,6 +685,19 @@ class V8_EXPORT HeapProfiler {
       ActivityControl* control = NULL,
       ObjectNameResolver* global_object_name_resolver = NULL);
 
+  /**
+   * Takes a heap snapshot and writes it to |stream| in the format of
+   * HeapSnapshot::Serialize(kJSON) without retaining it. Only the nodes are
+   * kept in memory: edges are spilled to a temporary file while the heap is
+   * traversed and strings are deduplicated through a bounded table, so
+   * much larger heaps can be snapshotted than with TakeHeapSnapshot.
+   * Returns false if no snapshot was written, e.g. because it was aborted
+   * through |control| or no temporary file could be created.
+   */
+  bool TakeHeapSnapshotToStream(
+      OutputStream* stream, ActivityControl* control = NULL,
+      ObjectNameResolver* global_object_name_resolver = NULL);
+
   /**
    * Starts tracking of heap objects population statistics. After calling
    * this method, all heap objects relocations done by the garbage collector
@@ -642,6 +757,11 @@ class V8_EXPORT HeapProfiler {
    * Objects allocated before the sampling is started will not be included in
    * the profile.
    *
+   * Every node of the profile reports the bytes it has allocated next to the
+   * bytes that are still alive, and the age of its live samples in time and
+   * in survived garbage collections. Comparing these across profiles taken
+   * with the default interval is meant to reveal slow leaks in production.
+   *
    * Returns false if a sampling heap profiler is already running.
    */
   bool StartSamplingHeapProfiler(uint64_t sample_interval = 512 * 1024,
@@ -4519,6 +4519,13 @@ class V8_EXPORT FunctionTemplate : public Template {
       Local<Value> data = Local<Value>(),
       Local<Signature> signature = Local<Signature>(), int length = 0);
 
+  /**
+   * Returns the function template added to the snapshot the isolate was
+   * created from with SnapshotCreator::AddTemplate under |index|, if any.
+   */
+  static MaybeLocal<FunctionTemplate> FromSnapshot(Isolate* isolate,
+                                                   size_t index);
+
   /** Returns the unique function instance in the current execution context.*/
   V8_DEPRECATE_SOON("Use maybe version", Local<Function> GetFunction());
   V8_WARN_UNUSED_RESULT MaybeLocal<Function> GetFunction(
@@ -4684,6 +4691,13 @@ class V8_EXPORT ObjectTemplate : public Template {
       Local<FunctionTemplate> constructor = Local<FunctionTemplate>());
   static V8_DEPRECATED("Use isolate version", Local<ObjectTemplate> New());
 
+  /**
+   * Returns the object template added to the snapshot the isolate was
+   * created from with SnapshotCreator::AddTemplate under |index|, if any.
+   */
+  static MaybeLocal<ObjectTemplate> FromSnapshot(Isolate* isolate,
+                                                 size_t index);
+
   /** Creates a new instance of this template.*/
   V8_DEPRECATE_SOON("Use maybe version", Local<Object> NewInstance());
   V8_WARN_UNUSED_RESULT MaybeLocal<Object> NewInstance(Local<Context> context);
@@ -5219,6 +5233,63 @@ enum GCCallbackFlags {
 
 typedef void (*GCCallback)(GCType type, GCCallbackFlags flags);
 
+/**
+ * Describes a completed scavenge or mark-compact, see
+ * Isolate::SetGCEventCallback. Times are in milliseconds and sizes in bytes.
+ */
+struct GCEvent {
+  // Either kGCTypeScavenge or kGCTypeMarkSweepCompact.
+  GCType type;
+  // True for a mark-compact that finished incremental marking.
+  bool incremental;
+  // Static string describing why the collection was triggered.
+  const char* reason;
+
+  // Start of the pause on the monotonic clock used by
+  // Platform::MonotonicallyIncreasingTime.
+  double start_time_ms;
+  // Length of the pause.
+  double duration_ms;
+  // Time spent in incremental marking steps since the previous event of the
+  // same kind, outside of the pause.
+  double incremental_marking_ms;
+
+  // Main phases of the pause. The mark-compact phases are zero for
+  // scavenges and vice versa.
+  double scavenge_ms;
+  double mark_ms;
+  double sweep_ms;
+  double evacuate_ms;
+  double clear_ms;
+
+  // Time spent in every phase and sub-phase tracked by the collector, as
+  // parallel arrays of |scope_count| entries. Names are static strings; the
+  // arrays are only valid during the callback.
+  int scope_count;
+  const char* const* scope_names;
+  const double* scope_times_ms;
+
+  // Bytes of young objects promoted to the old generation and copied within
+  // the young generation.
+  size_t promoted_bytes;
+  size_t semi_space_copied_bytes;
+  // Percentages of the young generation that was promoted and copied, and of
+  // the objects copied by the previous collection that are now promoted.
+  double promotion_ratio;
+  double semi_space_copied_rate;
+  double promotion_rate;
+
+  // Size of live objects and memory committed by the heap before and after
+  // the collection.
+  size_t heap_used_before;
+  size_t heap_used_after;
+  size_t heap_committed_before;
+  size_t heap_committed_after;
+};
+
+typedef void (*GCEventCallback)(Isolate* isolate, const GCEvent& event,
+                                void* data);
+
 typedef void (*InterruptCallback)(Isolate* isolate, void* data);
 
 
@@ -5293,6 +5364,36 @@ class V8_EXPORT HeapObjectStatistics {
 };
 
 
+/**
+ * Pause time distribution of one type of garbage collection, see
+ * Isolate::GetGCLatencyStatistics. Percentiles are upper bounds taken from a
+ * log-scale histogram. They overestimate the true value by less than 20%, or
+ * by less than 0.01 ms for shorter pauses.
+ */
+class V8_EXPORT GCLatencyStatistics {
+ public:
+  GCLatencyStatistics();
+  size_t count() { return count_; }
+  double total_ms() { return total_ms_; }
+  double max_ms() { return max_ms_; }
+  double p50_ms() { return p50_ms_; }
+  double p90_ms() { return p90_ms_; }
+  double p99_ms() { return p99_ms_; }
+  double p999_ms() { return p999_ms_; }
+
+ private:
+  size_t count_;
+  double total_ms_;
+  double max_ms_;
+  double p50_ms_;
+  double p90_ms_;
+  double p99_ms_;
+  double p999_ms_;
+
+  friend class Isolate;
+};
+
+
 class RetainedObjectInfo;
 
 
@@ -5437,6 +5538,21 @@ class V8_EXPORT PersistentHandleVisitor {  // NOLINT
                                      uint16_t class_id) {}
 };
 
+/**
+ * Interface for iterating through the runtime call statistics of an isolate,
+ * see Isolate::GetRuntimeCallStats.
+ */
+class V8_EXPORT RuntimeCallStatsVisitor {  // NOLINT
+ public:
+  virtual ~RuntimeCallStatsVisitor() {}
+  /**
+   * Called for every runtime function, C++ builtin, API function or IC
+   * handler that was entered since the last reset. |name| is a static string.
+   */
+  virtual void VisitCounter(const char* name, int64_t count,
+                            int64_t time_in_microseconds) = 0;
+};
+
 /**
  * Memory pressure level for the MemoryPressureNotification.
  * kNone hints V8 that there is no memory pressure.
@@ -5500,10 +5616,12 @@ class V8_EXPORT Isolate {
         : entry_hook(NULL),
           code_event_handler(NULL),
           snapshot_blob(NULL),
+          snapshot_blob_outlives_isolate(false),
           counter_lookup_callback(NULL),
           create_histogram_callback(NULL),
           add_histogram_sample_callback(NULL),
-          array_buffer_allocator(NULL) {}
+          array_buffer_allocator(NULL),
+          external_references(NULL) {}
 
     /**
      * The optional entry_hook allows the host application to provide the
@@ -5530,6 +5648,14 @@ class V8_EXPORT Isolate {
      */
     StartupData* snapshot_blob;
 
+    /**
+     * Set to true if |snapshot_blob| and its data stay alive as long as the
+     * isolate. Builtins are then deserialized from the blob on first use
+     * rather than with the isolate. Isolates created from the same blob read
+     * it in place, and each of them only copies the builtins it runs into its
+     * own heap. The builtin code itself is not shared between isolates.
+     */
+    bool snapshot_blob_outlives_isolate;
 
     /**
      * Enables the host application to provide a mechanism for recording
@@ -5551,6 +5677,14 @@ class V8_EXPORT Isolate {
      * store of ArrayBuffers.
      */
     ArrayBuffer::Allocator* array_buffer_allocator;
+
+    /**
+     * Specifies an optional null-terminated array of embedder addresses,
+     * typically callbacks, that a snapshot created with SnapshotCreator
+     * refers to. It must list the same addresses in the same order as the
+     * array that was passed to the SnapshotCreator.
+     */
+    intptr_t* external_references;
   };
 
 
@@ -5806,6 +5940,15 @@ class V8_EXPORT Isolate {
   bool GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
                               size_t index);
 
+  /**
+   * Enables or disables tracking of the number and size of live objects per
+   * instance type, code kind, code age and fixed array sub type, which is
+   * also enabled for all isolates by --track-gc-object-stats. When enabled,
+   * every full GC counts the objects it marked live in a single pass over the
+   * mark bits.
+   */
+  void SetTrackHeapObjectStatistics(bool track);
+
   /**
    * Returns the number of types of objects tracked in the heap at GC.
    */
@@ -5815,14 +5958,33 @@ class V8_EXPORT Isolate {
    * Get statistics about objects in the heap.
    *
    * \param object_statistics The HeapObjectStatistics object to fill in
-   *   statistics of objects of given type, which were live in the previous GC.
+   *   statistics of objects of given type, which were live in the last full
+   *   GC that ran while tracking was enabled.
    * \param type_index The index of the type of object to fill details about,
    *   which ranges from 0 to NumberOfTrackedHeapObjectTypes() - 1.
-   * \returns true on success.
+   * \returns true on success, false if tracking is disabled.
    */
   bool GetHeapObjectStatisticsAtLastGC(HeapObjectStatistics* object_statistics,
                                        size_t type_index);
 
+  /**
+   * Reports the number of calls to and the own time spent in each runtime
+   * function, C++ builtin, API function and IC handler since the last reset.
+   * Nothing is collected unless the isolate runs with --runtime-call-stats,
+   * which times every call, or with --runtime-call-stats-sampling=n, which is
+   * cheap enough for production use. In the latter case only 1 in n calls
+   * that are not nested in another one is timed, together with all calls
+   * nested in it, and the reported counts and times are estimates scaled up
+   * by n.
+   */
+  void GetRuntimeCallStats(RuntimeCallStatsVisitor* visitor);
+
+  /**
+   * Clears the statistics reported by GetRuntimeCallStats. Must not be called
+   * from within a callback made by V8.
+   */
+  void ResetRuntimeCallStats();
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -5980,6 +6142,26 @@ class V8_EXPORT Isolate {
    */
   void RemoveGCEpilogueCallback(GCCallback callback);
 
+  /**
+   * Installs a callback that receives a GCEvent after every scavenge and
+   * mark-compact, replacing any previous one. Pass nullptr to remove it. The
+   * callback runs inside the pause: it must be fast, must not allocate on the
+   * V8 heap and must not call into V8.
+   */
+  void SetGCEventCallback(GCEventCallback callback, void* data = nullptr);
+
+  /**
+   * Fills in the pause time distribution of all collections of the given
+   * |type|, kGCTypeScavenge or kGCTypeMarkSweepCompact, since the isolate was
+   * created or the statistics were last reset. Returns false for other types.
+   */
+  bool GetGCLatencyStatistics(GCType type, GCLatencyStatistics* statistics);
+
+  /**
+   * Clears the statistics reported by GetGCLatencyStatistics.
+   */
+  void ResetGCLatencyStatistics();
+
   /**
    * Forcefully terminate the current thread of JavaScript execution
    * in the given isolate.
@@ -6751,6 +6933,69 @@ class V8_EXPORT V8 {
   friend class Context;
 };
 
+/**
+ * Helper class to create a snapshot data blob that includes the embedder's
+ * templates and fully initialized contexts, so that isolates created from it
+ * skip the embedder's bootstrapping.
+ */
+class V8_EXPORT SnapshotCreator {
+ public:
+  enum class FunctionCodeHandling { kClear, kKeep };
+
+  /**
+   * Creates and enters an isolate, and sets it up for serialization. The
+   * isolate is either created from scratch or from an existing snapshot.
+   * The caller keeps ownership of the existing snapshot.
+   * \param external_references a null-terminated array of the addresses of
+   *        all embedder callbacks reachable from the snapshot. Isolates created
+   *        from the blob must pass an equivalent array in
+   *        Isolate::CreateParams::external_references.
+   * \param existing_blob existing snapshot from which to create this one.
+   */
+  SnapshotCreator(intptr_t* external_references = NULL,
+                  StartupData* existing_blob = NULL);
+
+  ~SnapshotCreator();
+
+  /**
+   * \returns the isolate prepared by the snapshot creator.
+   */
+  Isolate* GetIsolate();
+
+  /**
+   * Adds a context to be included in the snapshot blob. The first context
+   * added is the one Context::New creates in isolates using the blob.
+   * \returns the index to pass to Context::FromSnapshot.
+   */
+  size_t AddContext(Local<Context> context);
+
+  /**
+   * Adds a template to be included in the snapshot blob.
+   * \returns the index to pass to FunctionTemplate::FromSnapshot or
+   *          ObjectTemplate::FromSnapshot.
+   */
+  size_t AddTemplate(Local<Template> template_obj);
+
+  /**
+   * Creates the snapshot data blob. Can be called only once, and at least one
+   * context has to have been added. Objects that are only referenced from
+   * handle scopes which are still open are not included.
+   * Embedder pointers in internal fields are not preserved.
+   * \param function_code_handling whether to include compiled function code
+   *        in the snapshot.
+   * \returns { NULL, 0 } on failure, and a startup snapshot on success. The
+   *        caller acquires ownership of the data array in the return value.
+   */
+  StartupData CreateBlob(FunctionCodeHandling function_code_handling);
+
+ private:
+  void* data_;
+
+  // Disallow copying and assigning.
+  SnapshotCreator(const SnapshotCreator&);
+  void operator=(const SnapshotCreator&);
+};
+
 
 /**
  * A simple Maybe type, representing an object which may or may not have a
@@ -7039,6 +7284,19 @@ class V8_EXPORT Context {
       Local<ObjectTemplate> global_template = Local<ObjectTemplate>(),
       Local<Value> global_object = Local<Value>());
 
+  /**
+   * Creates a new context from the context that was added to the snapshot
+   * the isolate was created from with SnapshotCreator::AddContext under
+   * |context_snapshot_index|. The global object is created anew, optionally
+   * from |global_template|, and receives the properties of the snapshotted
+   * global object. Returns an empty handle if there is no such context.
+   */
+  static MaybeLocal<Context> FromSnapshot(
+      Isolate* isolate, size_t context_snapshot_index,
+      ExtensionConfiguration* extensions = NULL,
+      Local<ObjectTemplate> global_template = Local<ObjectTemplate>(),
+      Local<Value> global_object = Local<Value>());
+
   /**
    * Sets the security token for the context.  To access an object in
    * another context, the security tokens must match.
@@ -37,6 +37,7 @@
 #include "src/execution.h"
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
+#include "src/heap/gc-tracer.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
@@ -57,6 +58,7 @@
 #include "src/runtime-profiler.h"
 #include "src/runtime/runtime.h"
 #include "src/simulator.h"
+#include "src/snapshot/builtin-serializer.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/snapshot.h"
 #include "src/startup-data-util.h"
@@ -383,14 +385,20 @@ bool RunExtraCode(Isolate* isolate, Local<Context> context,
   return true;
 }
 
-StartupData SerializeIsolateAndContext(
-    Isolate* isolate, Persistent<Context>* context,
+StartupData SerializeIsolateAndContexts(
+    Isolate* isolate, Global<Context>* contexts, int num_contexts,
     i::Snapshot::Metadata metadata,
     i::StartupSerializer::FunctionCodeHandling function_code_handling) {
-  if (context->IsEmpty()) return {NULL, 0};
+  for (int i = 0; i < num_contexts; i++) {
+    if (contexts[i].IsEmpty()) return {NULL, 0};
+  }
 
   i::Isolate* internal_isolate = reinterpret_cast<i::Isolate*>(isolate);
 
+  // The builtins that this isolate has not used yet are still in the
+  // snapshot it was created from.
+  i::Snapshot::EnsureBuiltinsAreDeserialized(internal_isolate);
+
   // If we don't do this then we end up with a stray root pointing at the
   // context even after we have disposed of the context.
   internal_isolate->heap()->CollectAllAvailableGarbage("mksnapshot");
@@ -415,20 +423,58 @@ StartupData SerializeIsolateAndContext(
     }
   }
 
-  i::Object* raw_context = *v8::Utils::OpenPersistent(*context);
-  context->Reset();
+  // The trampolines are only referenced from this scope until the snapshot
+  // is complete.
+  i::HandleScope scope(internal_isolate);
+  i::Handle<i::Code> trampolines[i::Builtins::builtin_count];
+  i::BuiltinSerializer::CreateTrampolines(internal_isolate, trampolines);
+
+  i::List<i::Object*> raw_contexts(num_contexts);
+  for (int i = 0; i < num_contexts; i++) {
+    raw_contexts.Add(*v8::Utils::OpenPersistent(contexts[i]));
+    contexts[i].Reset();
+  }
 
   i::SnapshotByteSink snapshot_sink;
   i::StartupSerializer ser(internal_isolate, &snapshot_sink,
                            function_code_handling);
+  ser.set_lazy_builtin_trampolines(trampolines);
   ser.SerializeStrongReferences();
 
-  i::SnapshotByteSink context_sink;
-  i::PartialSerializer context_ser(internal_isolate, &ser, &context_sink);
-  context_ser.Serialize(&raw_context);
+  // Every context gets its own partial serializer, so that it can be
+  // deserialized independently of the others.
+  i::List<i::SnapshotData*> context_snapshots(num_contexts);
+  for (int i = 0; i < num_contexts; i++) {
+    i::SnapshotByteSink context_sink;
+    i::PartialSerializer context_ser(internal_isolate, &ser, &context_sink);
+    context_ser.Serialize(&raw_contexts[i]);
+    context_snapshots.Add(new i::SnapshotData(context_ser));
+  }
+
+  // Builtins with a trampoline get a snapshot of their own. This adds to the
+  // partial snapshot cache, so it has to precede the weak references.
+  i::List<i::SnapshotData*> builtin_snapshots(i::Builtins::builtin_count);
+  for (int i = 0; i < i::Builtins::builtin_count; i++) {
+    if (trampolines[i].is_null()) {
+      builtin_snapshots.Add(NULL);
+      continue;
+    }
+    i::SnapshotByteSink builtin_sink;
+    i::BuiltinSerializer builtin_ser(internal_isolate, &ser, &builtin_sink);
+    builtin_ser.Serialize(internal_isolate->builtins()->builtin(
+        static_cast<i::Builtins::Name>(i)));
+    builtin_snapshots.Add(new i::SnapshotData(builtin_ser));
+  }
   ser.SerializeWeakReferencesAndDeferred();
 
-  return i::Snapshot::CreateSnapshotBlob(ser, context_ser, metadata);
+  i::SnapshotData startup_snapshot(ser);
+  StartupData result = i::Snapshot::CreateSnapshotBlob(
+      startup_snapshot, context_snapshots, builtin_snapshots, metadata);
+  for (int i = 0; i < num_contexts; i++) delete context_snapshots[i];
+  for (int i = 0; i < i::Builtins::builtin_count; i++) {
+    delete builtin_snapshots[i];
+  }
+  return result;
 }
 
 }  // namespace
@@ -449,7 +495,7 @@ StartupData V8::CreateSnapshotDataBlob(const char* embedded_source) {
   {
     Isolate::Scope isolate_scope(isolate);
     internal_isolate->Init(NULL);
-    Persistent<Context> context;
+    Global<Context> context;
     {
       HandleScope handle_scope(isolate);
       Local<Context> new_context = Context::New(isolate);
@@ -463,8 +509,9 @@ StartupData V8::CreateSnapshotDataBlob(const char* embedded_source) {
     i::Snapshot::Metadata metadata;
     metadata.set_embeds_script(embedded_source != NULL);
 
-    result = SerializeIsolateAndContext(
-        isolate, &context, metadata, i::StartupSerializer::CLEAR_FUNCTION_CODE);
+    result = SerializeIsolateAndContexts(
+        isolate, &context, 1, metadata,
+        i::StartupSerializer::CLEAR_FUNCTION_CODE);
     DCHECK(context.IsEmpty());
   }
   isolate->Dispose();
@@ -501,7 +548,7 @@ StartupData V8::WarmUpSnapshotDataBlob(StartupData cold_snapshot_blob,
   {
     Isolate::Scope isolate_scope(isolate);
     i::Snapshot::Initialize(internal_isolate);
-    Persistent<Context> context;
+    Global<Context> context;
     bool success;
     {
       HandleScope handle_scope(isolate);
@@ -518,8 +565,9 @@ StartupData V8::WarmUpSnapshotDataBlob(StartupData cold_snapshot_blob,
     i::Snapshot::Metadata metadata;
     metadata.set_embeds_script(i::Snapshot::EmbedsScript(internal_isolate));
 
-    result = SerializeIsolateAndContext(
-        isolate, &context, metadata, i::StartupSerializer::KEEP_FUNCTION_CODE);
+    result = SerializeIsolateAndContexts(
+        isolate, &context, 1, metadata,
+        i::StartupSerializer::KEEP_FUNCTION_CODE);
     DCHECK(context.IsEmpty());
   }
   isolate->Dispose();
@@ -532,6 +580,130 @@ StartupData V8::WarmUpSnapshotDataBlob(StartupData cold_snapshot_blob,
   return result;
 }
 
+namespace {
+
+struct SnapshotCreatorData {
+  explicit SnapshotCreatorData(Isolate* isolate)
+      : isolate_(isolate), created_(false) {}
+
+  static SnapshotCreatorData* cast(void* data) {
+    return reinterpret_cast<SnapshotCreatorData*>(data);
+  }
+
+  ArrayBufferAllocator allocator_;
+  Isolate* isolate_;
+  std::vector<Global<Context> > contexts_;
+  std::vector<Global<Template> > templates_;
+  bool created_;
+};
+
+}  // namespace
+
+SnapshotCreator::SnapshotCreator(intptr_t* external_references,
+                                 StartupData* existing_blob) {
+  i::Isolate* internal_isolate = new i::Isolate(true);
+  Isolate* isolate = reinterpret_cast<Isolate*>(internal_isolate);
+  SnapshotCreatorData* data = new SnapshotCreatorData(isolate);
+  internal_isolate->set_array_buffer_allocator(&data->allocator_);
+  internal_isolate->set_api_external_references(external_references);
+  isolate->Enter();
+  if (existing_blob != NULL) {
+    internal_isolate->set_snapshot_blob(existing_blob);
+    i::Snapshot::Initialize(internal_isolate);
+  } else {
+    internal_isolate->Init(NULL);
+  }
+  data_ = data;
+}
+
+SnapshotCreator::~SnapshotCreator() {
+  SnapshotCreatorData* data = SnapshotCreatorData::cast(data_);
+  Isolate* isolate = data->isolate_;
+  // The handles have to go before the isolate does.
+  data->contexts_.clear();
+  data->templates_.clear();
+  isolate->Exit();
+  isolate->Dispose();
+  delete data;
+}
+
+Isolate* SnapshotCreator::GetIsolate() {
+  return SnapshotCreatorData::cast(data_)->isolate_;
+}
+
+size_t SnapshotCreator::AddContext(Local<Context> context) {
+  DCHECK(!context.IsEmpty());
+  SnapshotCreatorData* data = SnapshotCreatorData::cast(data_);
+  DCHECK(!data->created_);
+  Isolate* isolate = data->isolate_;
+  CHECK_EQ(isolate, context->GetIsolate());
+  size_t index = data->contexts_.size();
+  data->contexts_.push_back(Global<Context>(isolate, context));
+  return index;
+}
+
+size_t SnapshotCreator::AddTemplate(Local<Template> template_obj) {
+  DCHECK(!template_obj.IsEmpty());
+  SnapshotCreatorData* data = SnapshotCreatorData::cast(data_);
+  DCHECK(!data->created_);
+  Isolate* isolate = data->isolate_;
+  i::Isolate* internal_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  CHECK_EQ(internal_isolate, Utils::OpenHandle(*template_obj)->GetIsolate());
+  // Templates of the snapshot the creator started from keep their indices.
+  size_t index =
+      internal_isolate->heap()->serialized_templates()->length() +
+      data->templates_.size();
+  data->templates_.push_back(Global<Template>(isolate, template_obj));
+  return index;
+}
+
+StartupData SnapshotCreator::CreateBlob(
+    SnapshotCreator::FunctionCodeHandling function_code_handling) {
+  SnapshotCreatorData* data = SnapshotCreatorData::cast(data_);
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(data->isolate_);
+  if (!Utils::ApiCheck(!data->created_, "v8::SnapshotCreator::CreateBlob",
+                       "A blob can only be created once") ||
+      !Utils::ApiCheck(!data->contexts_.empty(),
+                       "v8::SnapshotCreator::CreateBlob",
+                       "At least one context has to be added")) {
+    return {NULL, 0};
+  }
+
+  {
+    i::HandleScope scope(isolate);
+    i::Handle<i::FixedArray> existing(
+        isolate->heap()->serialized_templates(), isolate);
+    int num_existing = existing->length();
+    int num_added = static_cast<int>(data->templates_.size());
+    i::Handle<i::FixedArray> templates = isolate->factory()->NewFixedArray(
+        num_existing + num_added, i::TENURED);
+    for (int i = 0; i < num_existing; i++) {
+      templates->set(i, existing->get(i));
+    }
+    for (int i = 0; i < num_added; i++) {
+      templates->set(num_existing + i,
+                     *Utils::OpenPersistent(data->templates_[i]));
+    }
+    isolate->heap()->SetSerializedTemplates(*templates);
+    data->templates_.clear();
+  }
+
+  // Isolates created from the blob have to be deserialized from it, since
+  // nothing else can restore the embedder's state.
+  i::Snapshot::Metadata metadata;
+  metadata.set_embeds_script(true);
+
+  StartupData result = SerializeIsolateAndContexts(
+      data->isolate_, data->contexts_.data(),
+      static_cast<int>(data->contexts_.size()), metadata,
+      function_code_handling == FunctionCodeHandling::kKeep
+          ? i::StartupSerializer::KEEP_FUNCTION_CODE
+          : i::StartupSerializer::CLEAR_FUNCTION_CODE);
+  data->contexts_.clear();
+  data->created_ = true;
+  return result;
+}
+
 
 void V8::SetFlagsFromString(const char* str, int length) {
   i::FlagList::SetFlagsFromString(str, length);
@@ -1113,8 +1285,7 @@ static Local<FunctionTemplate> FunctionTemplateNew(
   obj->set_do_not_cache(do_not_cache);
   int next_serial_number = 0;
   if (!do_not_cache) {
-    next_serial_number = isolate->next_serial_number() + 1;
-    isolate->set_next_serial_number(next_serial_number);
+    next_serial_number = isolate->heap()->NextTemplateSerialNumber();
   }
   obj->set_serial_number(i::Smi::FromInt(next_serial_number));
   if (callback != 0) {
@@ -1139,9 +1310,6 @@ Local<FunctionTemplate> FunctionTemplate::New(Isolate* isolate,
                                               v8::Local<Signature> signature,
                                               int length) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
-  // Changes to the environment cannot be captured in the snapshot. Expect no
-  // function templates when the isolate is created for serialization.
-  DCHECK(!i_isolate->serializer_enabled());
   LOG_API(i_isolate, FunctionTemplate, New);
   ENTER_V8(i_isolate);
   return FunctionTemplateNew(i_isolate, callback, nullptr, data, signature,
@@ -1154,7 +1322,6 @@ Local<FunctionTemplate> FunctionTemplate::NewWithFastHandler(
     experimental::FastAccessorBuilder* fast_handler, v8::Local<Value> data,
     v8::Local<Signature> signature, int length) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
-  DCHECK(!i_isolate->serializer_enabled());
   LOG_API(i_isolate, FunctionTemplate, NewWithFastHandler);
   ENTER_V8(i_isolate);
   return FunctionTemplateNew(i_isolate, callback, fast_handler, data, signature,
@@ -1162,6 +1329,25 @@ Local<FunctionTemplate> FunctionTemplate::NewWithFastHandler(
 }
 
 
+static i::Object* GetSerializedTemplate(i::Isolate* isolate, size_t index) {
+  i::FixedArray* templates = isolate->heap()->serialized_templates();
+  if (index >= static_cast<size_t>(templates->length())) {
+    return isolate->heap()->undefined_value();
+  }
+  return templates->get(static_cast<int>(index));
+}
+
+
+MaybeLocal<FunctionTemplate> FunctionTemplate::FromSnapshot(Isolate* isolate,
+                                                            size_t index) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Object* info = GetSerializedTemplate(i_isolate, index);
+  if (!info->IsFunctionTemplateInfo()) return MaybeLocal<FunctionTemplate>();
+  return Utils::ToLocal(i::Handle<i::FunctionTemplateInfo>(
+      i::FunctionTemplateInfo::cast(info), i_isolate));
+}
+
+
 Local<Signature> Signature::New(Isolate* isolate,
                                 Local<FunctionTemplate> receiver) {
   return Utils::SignatureToLocal(Utils::OpenHandle(*receiver));
@@ -1336,9 +1522,6 @@ Local<ObjectTemplate> ObjectTemplate::New() {
 static Local<ObjectTemplate> ObjectTemplateNew(
     i::Isolate* isolate, v8::Local<FunctionTemplate> constructor,
     bool do_not_cache) {
-  // Changes to the environment cannot be captured in the snapshot. Expect no
-  // object templates when the isolate is created for serialization.
-  DCHECK(!isolate->serializer_enabled());
   LOG_API(isolate, ObjectTemplate, New);
   ENTER_V8(isolate);
   i::Handle<i::Struct> struct_obj =
@@ -1348,8 +1531,7 @@ static Local<ObjectTemplate> ObjectTemplateNew(
   InitializeTemplate(obj, Consts::OBJECT_TEMPLATE);
   int next_serial_number = 0;
   if (!do_not_cache) {
-    next_serial_number = isolate->next_serial_number() + 1;
-    isolate->set_next_serial_number(next_serial_number);
+    next_serial_number = isolate->heap()->NextTemplateSerialNumber();
   }
   obj->set_serial_number(i::Smi::FromInt(next_serial_number));
   if (!constructor.IsEmpty())
@@ -1363,6 +1545,16 @@ Local<ObjectTemplate> ObjectTemplate::New(
   return ObjectTemplateNew(isolate, constructor, false);
 }
 
+
+MaybeLocal<ObjectTemplate> ObjectTemplate::FromSnapshot(Isolate* isolate,
+                                                        size_t index) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Object* info = GetSerializedTemplate(i_isolate, index);
+  if (!info->IsObjectTemplateInfo()) return MaybeLocal<ObjectTemplate>();
+  return Utils::ToLocal(i::Handle<i::ObjectTemplateInfo>(
+      i::ObjectTemplateInfo::cast(info), i_isolate));
+}
+
 // Ensure that the object template has a constructor.  If no
 // constructor is available we create one.
 static i::Handle<i::FunctionTemplateInfo> EnsureConstructor(
@@ -5058,9 +5250,25 @@ class Utf8WriterVisitor {
       }
       // Write the characters to the stream.
       if (sizeof(Char) == 1) {
-        for (; i < fast_length; i++) {
-          buffer += unibrow::Utf8::EncodeOneByte(
-              buffer, static_cast<uint8_t>(*chars++));
+        while (i < fast_length) {
+          // ASCII characters are their own encoding, so copy runs of them
+          // in bulk.
+          int ascii_length = i::String::NonAsciiStart(
+              reinterpret_cast<const char*>(chars), fast_length - i);
+          i::MemCopy(buffer, chars, ascii_length);
+          buffer += ascii_length;
+          chars += ascii_length;
+          i += ascii_length;
+          if (i == fast_length) break;
+          // NonAsciiStart may stop at the start of a word that contains a
+          // non-ASCII character, so always encode at least one character.
+          do {
+            buffer += unibrow::Utf8::EncodeOneByte(
+                buffer, static_cast<uint8_t>(*chars++));
+            i++;
+          } while (i < fast_length &&
+                   static_cast<uint8_t>(*chars) >
+                       unibrow::Utf8::kMaxOneByteChar);
           DCHECK(capacity_ == -1 || (buffer - start_) <= capacity_);
         }
       } else {
@@ -5512,6 +5720,16 @@ HeapObjectStatistics::HeapObjectStatistics()
       object_size_(0) {}
 
 
+GCLatencyStatistics::GCLatencyStatistics()
+    : count_(0),
+      total_ms_(0),
+      max_ms_(0),
+      p50_ms_(0),
+      p90_ms_(0),
+      p99_ms_(0),
+      p999_ms_(0) {}
+
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -5536,7 +5754,7 @@ const char* v8::V8::GetVersion() {
 static i::Handle<i::Context> CreateEnvironment(
     i::Isolate* isolate, v8::ExtensionConfiguration* extensions,
     v8::Local<ObjectTemplate> global_template,
-    v8::Local<Value> maybe_global_proxy) {
+    v8::Local<Value> maybe_global_proxy, size_t context_snapshot_index) {
   i::Handle<i::Context> env;
 
   // Enter V8 via an ENTER_V8 scope.
@@ -5581,7 +5799,7 @@ static i::Handle<i::Context> CreateEnvironment(
     }
     // Create the environment.
     env = isolate->bootstrapper()->CreateEnvironment(
-        maybe_proxy, proxy_template, extensions);
+        maybe_proxy, proxy_template, extensions, context_snapshot_index);
 
     // Restore the access check info on the global template.
     if (!global_template.IsEmpty()) {
@@ -5598,17 +5816,19 @@ static i::Handle<i::Context> CreateEnvironment(
   return env;
 }
 
-Local<Context> v8::Context::New(v8::Isolate* external_isolate,
-                                v8::ExtensionConfiguration* extensions,
-                                v8::Local<ObjectTemplate> global_template,
-                                v8::Local<Value> global_object) {
+static Local<Context> NewContext(v8::Isolate* external_isolate,
+                                 v8::ExtensionConfiguration* extensions,
+                                 v8::Local<ObjectTemplate> global_template,
+                                 v8::Local<Value> global_object,
+                                 size_t context_snapshot_index) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(external_isolate);
   LOG_API(isolate, Context, New);
   i::HandleScope scope(isolate);
   ExtensionConfiguration no_extensions;
   if (extensions == NULL) extensions = &no_extensions;
   i::Handle<i::Context> env =
-      CreateEnvironment(isolate, extensions, global_template, global_object);
+      CreateEnvironment(isolate, extensions, global_template, global_object,
+                        context_snapshot_index);
   if (env.is_null()) {
     if (isolate->has_pending_exception()) {
       isolate->OptionalRescheduleException(true);
@@ -5618,6 +5838,28 @@ Local<Context> v8::Context::New(v8::Isolate* external_isolate,
   return Utils::ToLocal(scope.CloseAndEscape(env));
 }
 
+Local<Context> v8::Context::New(v8::Isolate* external_isolate,
+                                v8::ExtensionConfiguration* extensions,
+                                v8::Local<ObjectTemplate> global_template,
+                                v8::Local<Value> global_object) {
+  return NewContext(external_isolate, extensions, global_template,
+                    global_object, 0);
+}
+
+MaybeLocal<Context> v8::Context::FromSnapshot(
+    v8::Isolate* external_isolate, size_t context_snapshot_index,
+    v8::ExtensionConfiguration* extensions,
+    v8::Local<ObjectTemplate> global_template,
+    v8::Local<Value> global_object) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(external_isolate);
+  if (!isolate->initialized_from_snapshot() ||
+      !i::Snapshot::HasContextSnapshot(isolate, context_snapshot_index)) {
+    return MaybeLocal<Context>();
+  }
+  return NewContext(external_isolate, extensions, global_template,
+                    global_object, context_snapshot_index);
+}
+
 
 void v8::Context::SetSecurityToken(Local<Value> token) {
   i::Handle<i::Context> env = Utils::OpenHandle(this);
@@ -6155,6 +6397,8 @@ void v8::Date::DateTimeConfigurationChangeNotification(Isolate* isolate) {
   LOG_API(i_isolate, Date, DateTimeConfigurationChangeNotification);
   ENTER_V8(i_isolate);
   i_isolate->date_cache()->ResetDateCache();
+  // Cached date formatters use the old default time zone.
+  i_isolate->ClearICUObjectCache();
   if (!i_isolate->eternal_handles()->Exists(
           i::EternalHandles::DATE_CACHE_VERSION)) {
     return;
@@ -7166,6 +7410,42 @@ void Isolate::RemoveGCEpilogueCallback(GCCallback callback) {
 }
 
 
+void Isolate::SetGCEventCallback(GCEventCallback callback, void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->tracer()->SetGCEventCallback(callback, data);
+}
+
+
+bool Isolate::GetGCLatencyStatistics(GCType type,
+                                     GCLatencyStatistics* statistics) {
+  if (!statistics) return false;
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::GCTracer* tracer = isolate->heap()->tracer();
+  const i::LatencyHistogram* histogram;
+  if (type == kGCTypeScavenge) {
+    histogram = &tracer->scavenge_latency();
+  } else if (type == kGCTypeMarkSweepCompact) {
+    histogram = &tracer->mark_compact_latency();
+  } else {
+    return false;
+  }
+  statistics->count_ = histogram->count();
+  statistics->total_ms_ = histogram->total_ms();
+  statistics->max_ms_ = histogram->max_ms();
+  statistics->p50_ms_ = histogram->Percentile(0.5);
+  statistics->p90_ms_ = histogram->Percentile(0.9);
+  statistics->p99_ms_ = histogram->Percentile(0.99);
+  statistics->p999_ms_ = histogram->Percentile(0.999);
+  return true;
+}
+
+
+void Isolate::ResetGCLatencyStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->tracer()->ResetLatencyHistograms();
+}
+
+
 void V8::AddGCPrologueCallback(GCCallback callback, GCType gc_type) {
   i::Isolate* isolate = i::Isolate::Current();
   isolate->heap()->AddGCPrologueCallback(
@@ -7253,9 +7533,12 @@ Isolate* Isolate::New(const Isolate::CreateParams& params) {
   isolate->set_array_buffer_allocator(params.array_buffer_allocator);
   if (params.snapshot_blob != NULL) {
     isolate->set_snapshot_blob(params.snapshot_blob);
+    isolate->set_snapshot_blob_outlives_isolate(
+        params.snapshot_blob_outlives_isolate);
   } else {
     isolate->set_snapshot_blob(i::Snapshot::DefaultSnapshotBlob());
   }
+  isolate->set_api_external_references(params.external_references);
   if (params.entry_hook) {
     isolate->set_function_entry_hook(params.entry_hook);
   }
@@ -7431,6 +7714,12 @@ bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
 }
 
 
+void Isolate::SetTrackHeapObjectStatistics(bool track) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->set_track_object_stats(track);
+}
+
+
 size_t Isolate::NumberOfTrackedHeapObjectTypes() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = isolate->heap();
@@ -7441,10 +7730,10 @@ size_t Isolate::NumberOfTrackedHeapObjectTypes() {
 bool Isolate::GetHeapObjectStatisticsAtLastGC(
     HeapObjectStatistics* object_statistics, size_t type_index) {
   if (!object_statistics) return false;
-  if (!i::FLAG_track_gc_object_stats) return false;
 
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = isolate->heap();
+  if (!heap->ShouldTrackObjectStats()) return false;
   if (type_index >= heap->NumberOfTrackedHeapObjectTypes()) return false;
 
   const char* object_type;
@@ -7466,6 +7755,18 @@ bool Isolate::GetHeapObjectStatisticsAtLastGC(
 }
 
 
+void Isolate::GetRuntimeCallStats(RuntimeCallStatsVisitor* visitor) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->counters()->runtime_call_stats()->Visit(visitor);
+}
+
+
+void Isolate::ResetRuntimeCallStats() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->counters()->runtime_call_stats()->Reset();
+}
+
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
@@ -8310,6 +8611,17 @@ void CpuProfiler::StartProfiling(Local<String> title, bool record_samples) {
 }
 
 
+void CpuProfiler::StartStreamingProfiling(Local<String> title,
+                                          CpuProfileChunkListener* listener,
+                                          int chunk_interval_ms) {
+  DCHECK_NOT_NULL(listener);
+  DCHECK_GE(chunk_interval_ms, 0);
+  reinterpret_cast<i::CpuProfiler*>(this)->StartStreamingProfiling(
+      *Utils::OpenHandle(*title), listener,
+      base::TimeDelta::FromMilliseconds(chunk_interval_ms));
+}
+
+
 CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
   return reinterpret_cast<CpuProfile*>(
       reinterpret_cast<i::CpuProfiler*>(this)->StopProfiling(
@@ -8515,6 +8827,14 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(
 }
 
 
+bool HeapProfiler::TakeHeapSnapshotToStream(OutputStream* stream,
+                                            ActivityControl* control,
+                                            ObjectNameResolver* resolver) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshotToStream(
+      stream, control, resolver);
+}
+
+
 void HeapProfiler::StartTrackingHeapObjects(bool track_allocations) {
   reinterpret_cast<i::HeapProfiler*>(this)->StartHeapObjectsTracking(
       track_allocations);
@@ -287,7 +287,7 @@ OPEN_HANDLE_LIST(DECLARE_OPEN_HANDLE)
 
   template <class T>
   static inline v8::internal::Handle<v8::internal::Object> OpenPersistent(
-      const v8::Persistent<T>& persistent) {
+      const v8::PersistentBase<T>& persistent) {
     return v8::internal::Handle<v8::internal::Object>(
         reinterpret_cast<v8::internal::Object**>(persistent.val_));
   }
@@ -95,7 +95,7 @@ double ClobberDoubleRegisters(double x1, double x2, double x3, double x4);
                                                                               \
   Type Name(int args_length, Object** args_object, Isolate* isolate) {        \
     CLOBBER_DOUBLE_REGISTERS();                                               \
-    if (FLAG_runtime_call_stats) {                                            \
+    if (RuntimeCallStats::IsEnabled()) {                                      \
       return Stats_##Name(args_length, args_object, isolate);                 \
     }                                                                         \
     Arguments args(args_length, args_object);                                 \
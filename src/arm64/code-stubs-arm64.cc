@@ -1803,6 +1803,8 @@ void RegExpExecStub::Generate(MacroAssembler* masm) {
                       eq,
                       &exception);
   __ CompareAndBranch(w0, NativeRegExpMacroAssembler::RETRY, eq, &runtime);
+  __ CompareAndBranch(w0, NativeRegExpMacroAssembler::FALLBACK_TO_NFA, eq,
+                      &runtime);
 
   // Success: process the result from the native regexp code.
   Register number_of_capture_registers = x12;
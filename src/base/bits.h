@@ -303,6 +303,26 @@ inline uint32_t UnsignedMod32(uint32_t lhs, uint32_t rhs) {
 }
 
 
+// UnsignedMul128(lhs, rhs, high) multiplies two unsigned 64-bit values |lhs|
+// and |rhs|, stores the most significant 64 bits of the 128-bit product into
+// the variable pointed to by |high| and returns the least significant 64 bits.
+inline uint64_t UnsignedMul128(uint64_t lhs, uint64_t rhs, uint64_t* high) {
+  const uint64_t kMask32 = 0xffffffffu;
+  uint64_t lhs_high = lhs >> 32;
+  uint64_t lhs_low = lhs & kMask32;
+  uint64_t rhs_high = rhs >> 32;
+  uint64_t rhs_low = rhs & kMask32;
+  uint64_t low_low = lhs_low * rhs_low;
+  uint64_t high_low = lhs_high * rhs_low;
+  uint64_t low_high = lhs_low * rhs_high;
+  uint64_t middle =
+      (low_low >> 32) + (high_low & kMask32) + (low_high & kMask32);
+  *high = lhs_high * rhs_high + (high_low >> 32) + (low_high >> 32) +
+          (middle >> 32);
+  return (middle << 32) | (low_low & kMask32);
+}
+
+
 // Clamp |value| on overflow and underflow conditions.
 int64_t FromCheckedNumeric(const internal::CheckedNumeric<int64_t> value);
 
@@ -157,7 +157,7 @@ BUILTIN_LIST_C(DEF_ARG_TYPE)
                                                                                \
   MUST_USE_RESULT static Object* Builtin_##name(                               \
       int args_length, Object** args_object, Isolate* isolate) {               \
-    if (FLAG_runtime_call_stats) {                                             \
+    if (RuntimeCallStats::IsEnabled()) {                                       \
       return Builtin_Impl_Stats_##name(args_length, args_object, isolate);     \
     }                                                                          \
     name##ArgumentsType args(args_length, args_object);                        \
@@ -5038,6 +5038,7 @@ static void Generate_FrameDropper_LiveEdit(MacroAssembler* masm) {
 Builtins::Builtins() : initialized_(false) {
   memset(builtins_, 0, sizeof(builtins_[0]) * builtin_count);
   memset(names_, 0, sizeof(names_[0]) * builtin_count);
+  memset(lazy_, 0, sizeof(lazy_[0]) * builtin_count);
 }
 
 
@@ -5238,6 +5239,7 @@ void Builtins::SetUp(Isolate* isolate, bool create_heap_objects) {
       builtins_[i] = NULL;
     }
     names_[i] = functions[i].s_name;
+    lazy_[i] = false;
   }
 
   // Mark as initialized.
@@ -5255,6 +5257,46 @@ void Builtins::IterateBuiltins(ObjectVisitor* v) {
 }
 
 
+// static
+bool Builtins::IsLazyDeserializable(int index) {
+  DCHECK(index >= 0 && index < builtin_count);
+  switch (index) {
+    // These are looked up by identity, or installed on objects other than
+    // functions.
+    case kIllegal:
+    case kEmptyFunction:
+    case kHandleApiCall:
+    case kHandleApiCallAsFunction:
+    case kHandleApiCallAsConstructor:
+    case kRestrictedFunctionPropertiesThrower:
+    case kRestrictedStrictArgumentsPropertiesThrower:
+      return false;
+    default:
+      break;
+  }
+  // C++ builtins are entered through their adaptor with JS linkage, as are
+  // the builtins implemented in TurboFan.
+  switch (index) {
+#define CASE_C(name, ignore) case k##name:
+#define CASE_T(name, argc) case k##name:
+    BUILTIN_LIST_C(CASE_C)
+    BUILTIN_LIST_T(CASE_T)
+#undef CASE_C
+#undef CASE_T
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+void Builtins::InstallDeserializedCode(Name name, Code* code) {
+  DCHECK(lazy_[name]);
+  builtins_[name] = code;
+  lazy_[name] = false;
+}
+
+
 const char* Builtins::Lookup(byte* pc) {
   // may be called during initialization (disassembler!)
   if (initialized_) {
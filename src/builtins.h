@@ -234,6 +234,7 @@ inline bool operator&(BuiltinExtraArguments lhs, BuiltinExtraArguments rhs) {
   V(CompileBaseline, BUILTIN, UNINITIALIZED, kNoExtraICState)                  \
   V(CompileOptimized, BUILTIN, UNINITIALIZED, kNoExtraICState)                 \
   V(CompileOptimizedConcurrent, BUILTIN, UNINITIALIZED, kNoExtraICState)       \
+  V(DeserializeLazy, BUILTIN, UNINITIALIZED, kNoExtraICState)                  \
   V(NotifyDeoptimized, BUILTIN, UNINITIALIZED, kNoExtraICState)                \
   V(NotifySoftDeoptimized, BUILTIN, UNINITIALIZED, kNoExtraICState)            \
   V(NotifyLazyDeoptimized, BUILTIN, UNINITIALIZED, kNoExtraICState)            \
@@ -433,6 +434,17 @@ class Builtins {
 
   bool is_initialized() const { return initialized_; }
 
+  // Returns true if the builtin can be deserialized on first use. Until then
+  // a trampoline stands in for it, so it must have JS linkage and must never
+  // be compared by identity.
+  static bool IsLazyDeserializable(int index);
+
+  // A lazily deserialized builtin is represented by its trampoline in the
+  // builtins table until its code is installed.
+  bool IsDeserialized(Name name) const { return !lazy_[name]; }
+  void MarkAsLazy(Name name) { lazy_[name] = true; }
+  void InstallDeserializedCode(Name name, Code* code);
+
   MUST_USE_RESULT static MaybeHandle<Object> InvokeApiFunction(
       Handle<HeapObject> function, Handle<Object> receiver, int argc,
       Handle<Object> args[]);
@@ -448,6 +460,7 @@ class Builtins {
   // function f, we use an Object* array here.
   Object* builtins_[builtin_count];
   const char* names_[builtin_count];
+  bool lazy_[builtin_count];
 
   static void Generate_Adaptor(MacroAssembler* masm,
                                CFunctionId id,
@@ -460,6 +473,7 @@ class Builtins {
   static void Generate_InOptimizationQueue(MacroAssembler* masm);
   static void Generate_CompileOptimized(MacroAssembler* masm);
   static void Generate_CompileOptimizedConcurrent(MacroAssembler* masm);
+  static void Generate_DeserializeLazy(MacroAssembler* masm);
   static void Generate_JSConstructStubGeneric(MacroAssembler* masm);
   static void Generate_JSBuiltinsConstructStub(MacroAssembler* masm);
   static void Generate_JSBuiltinsConstructStubForDerived(MacroAssembler* masm);
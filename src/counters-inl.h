@@ -12,7 +12,7 @@ namespace internal {
 
 RuntimeCallTimerScope::RuntimeCallTimerScope(
     HeapObject* heap_object, RuntimeCallStats::CounterId counter_id) {
-  if (V8_UNLIKELY(FLAG_runtime_call_stats)) {
+  if (V8_UNLIKELY(RuntimeCallStats::IsEnabled())) {
     isolate_ = heap_object->GetIsolate();
     RuntimeCallStats::Enter(isolate_, &timer_, counter_id);
   }
@@ -277,7 +277,21 @@ void RuntimeCallStats::Enter(Isolate* isolate, RuntimeCallTimer* timer,
                              CounterId counter_id) {
   RuntimeCallStats* stats = isolate->counters()->runtime_call_stats();
   RuntimeCallCounter* counter = &(stats->*counter_id);
-  timer->Start(counter, stats->current_timer_);
+  bool timed = true;
+  if (!FLAG_runtime_call_stats) {
+    // Sampling mode: the timer is pushed either way to keep the stack intact,
+    // but only every n-th outermost call on average is timed, together with
+    // all calls nested in it. This way the own times of the sampled calls
+    // add up without having to know the time of unsampled ones.
+    RuntimeCallTimer* parent = stats->current_timer_;
+    if (parent == NULL) {
+      timed = --stats->sampling_countdown_ <= 0;
+      if (timed) stats->sampling_countdown_ = stats->NextSamplingInterval();
+    } else {
+      timed = parent->timer_.IsStarted();
+    }
+  }
+  timer->Start(counter, stats->current_timer_, timed);
   stats->current_timer_ = timer;
 }
 
@@ -297,6 +311,17 @@ void RuntimeCallStats::CorrectCurrentCounterId(Isolate* isolate,
   stats->current_timer_->counter_ = counter;
 }
 
+int RuntimeCallStats::NextSamplingInterval() {
+  // xorshift32, uniform in [1, 2 * rate - 1].
+  uint32_t x = sampling_state_;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  sampling_state_ = x;
+  uint32_t range = 2 * static_cast<uint32_t>(FLAG_runtime_call_stats_sampling);
+  return 1 + static_cast<int>(x % (range - 1));
+}
+
 void RuntimeCallStats::Print(std::ostream& os) {
   RuntimeCallStatEntries entries;
 
@@ -323,8 +348,39 @@ void RuntimeCallStats::Print(std::ostream& os) {
   entries.Print(os);
 }
 
+void RuntimeCallStats::Visit(v8::RuntimeCallStatsVisitor* visitor) {
+  int64_t scale = FLAG_runtime_call_stats
+                      ? 1
+                      : std::max(FLAG_runtime_call_stats_sampling, 1);
+  auto visit = [visitor, scale](RuntimeCallCounter* counter) {
+    if (counter->count == 0) return;
+    visitor->VisitCounter(counter->name, counter->count * scale,
+                          counter->time.InMicroseconds() * scale);
+  };
+
+#define VISIT_COUNTER(name) visit(&this->name);
+  FOR_EACH_MANUAL_COUNTER(VISIT_COUNTER)
+#undef VISIT_COUNTER
+
+#define VISIT_COUNTER(name, nargs, ressize) visit(&this->Runtime_##name);
+  FOR_EACH_INTRINSIC(VISIT_COUNTER)
+#undef VISIT_COUNTER
+
+#define VISIT_COUNTER(name, type) visit(&this->Builtin_##name);
+  BUILTIN_LIST_C(VISIT_COUNTER)
+#undef VISIT_COUNTER
+
+#define VISIT_COUNTER(name) visit(&this->API_##name);
+  FOR_EACH_API_COUNTER(VISIT_COUNTER)
+#undef VISIT_COUNTER
+
+#define VISIT_COUNTER(name) visit(&this->Handler_##name);
+  FOR_EACH_HANDLER_COUNTER(VISIT_COUNTER)
+#undef VISIT_COUNTER
+}
+
 void RuntimeCallStats::Reset() {
-  if (!FLAG_runtime_call_stats) return;
+  if (!IsEnabled()) return;
 #define RESET_COUNTER(name) this->name.Reset();
   FOR_EACH_MANUAL_COUNTER(RESET_COUNTER)
 #undef RESET_COUNTER
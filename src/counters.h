@@ -497,19 +497,24 @@ class RuntimeCallTimer {
  private:
   friend class RuntimeCallStats;
 
-  inline void Start(RuntimeCallCounter* counter, RuntimeCallTimer* parent) {
+  inline void Start(RuntimeCallCounter* counter, RuntimeCallTimer* parent,
+                    bool timed) {
     counter_ = counter;
     parent_ = parent;
-    timer_.Start();
+    if (timed) timer_.Start();
   }
 
   inline RuntimeCallTimer* Stop() {
+    // Calls skipped by sampling are not recorded. Their callers are never
+    // timed either, since calls are sampled as whole trees.
+    if (!timer_.IsStarted()) return parent_;
     base::TimeDelta delta = timer_.Elapsed();
     timer_.Stop();
     counter_->count++;
     counter_->time += delta;
     if (parent_ != NULL) {
       // Adjust parent timer so that it does not include sub timer's time.
+      DCHECK(parent_->timer_.IsStarted());
       parent_->counter_->time -= delta;
     }
     return parent_;
@@ -772,19 +777,37 @@ class RuntimeCallStats {
   // event kind when a runtime entry counter is too generic.
   static void CorrectCurrentCounterId(Isolate* isolate, CounterId counter_id);
 
+  // Returns whether runtime calls are measured, either all of them
+  // (--runtime-call-stats) or only a sample (--runtime-call-stats-sampling).
+  static bool IsEnabled() {
+    return FLAG_runtime_call_stats || FLAG_runtime_call_stats_sampling > 0;
+  }
+
   void Reset();
   void Print(std::ostream& os);
 
+  // Reports every counter with a non-zero count to |visitor|. In sampling
+  // mode counts and times are extrapolated from the sampled calls.
+  void Visit(v8::RuntimeCallStatsVisitor* visitor);
+
   RuntimeCallStats() { Reset(); }
 
  private:
+  // Returns the number of calls until the next one to be timed in sampling
+  // mode. The intervals are randomized around the sampling rate so that
+  // periodic call patterns do not skew the result.
+  int NextSamplingInterval();
+
   // Counter to track recursive time events.
   RuntimeCallTimer* current_timer_ = NULL;
+  // Calls left until the next timed one in sampling mode.
+  int sampling_countdown_ = 0;
+  uint32_t sampling_state_ = 0x9e3779b9;
 };
 
 #define TRACE_RUNTIME_CALL_STATS(isolate, counter_name) \
   do {                                                  \
-    if (FLAG_runtime_call_stats) {                      \
+    if (RuntimeCallStats::IsEnabled()) {                \
       RuntimeCallStats::CorrectCurrentCounterId(        \
           isolate, &RuntimeCallStats::counter_name);    \
     }                                                   \
@@ -799,7 +822,7 @@ class RuntimeCallTimerScope {
  public:
   inline RuntimeCallTimerScope(Isolate* isolate,
                                RuntimeCallStats::CounterId counter_id) {
-    if (V8_UNLIKELY(FLAG_runtime_call_stats)) {
+    if (V8_UNLIKELY(RuntimeCallStats::IsEnabled())) {
       isolate_ = isolate;
       RuntimeCallStats::Enter(isolate_, &timer_, counter_id);
     }
@@ -810,7 +833,7 @@ class RuntimeCallTimerScope {
                                RuntimeCallStats::CounterId counter_id);
 
   inline ~RuntimeCallTimerScope() {
-    if (V8_UNLIKELY(FLAG_runtime_call_stats)) {
+    if (V8_UNLIKELY(RuntimeCallStats::IsEnabled())) {
       RuntimeCallStats::Leave(isolate_, &timer_);
     }
   }
@@ -861,6 +884,11 @@ class RuntimeCallTimerScope {
   HT(compile_serialize, V8.CompileSerializeMicroSeconds, 100000, MICROSECOND)  \
   HT(compile_deserialize, V8.CompileDeserializeMicroSeconds, 1000000,          \
      MICROSECOND)                                                              \
+  /* Regexp compilation to bytecode and to native code. */                    \
+  HT(compile_regexp_bytecode, V8.RegExpCompileBytecodeMicroSeconds, 1000000,   \
+     MICROSECOND)                                                              \
+  HT(compile_regexp_native, V8.RegExpCompileNativeMicroSeconds, 1000000,       \
+     MICROSECOND)                                                              \
   /* Total compilation time incl. caching/parsing */                           \
   HT(compile_script, V8.CompileScriptMicroSeconds, 1000000, MICROSECOND)       \
   /* Total JavaScript execution time (including callbacks and runtime calls */ \
@@ -1013,6 +1041,12 @@ class RuntimeCallTimerScope {
   SC(string_compare_runtime, V8.StringCompareRuntime)                          \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(regexp_entry_native, V8.RegExpEntryNative)                                \
+  SC(regexp_entry_interpreted, V8.RegExpEntryInterpreted)                      \
+  SC(regexp_tier_up, V8.RegExpTierUp)                                          \
+  SC(regexp_entry_nfa, V8.RegExpEntryNfa)                                      \
+  SC(regexp_nfa_fallback, V8.RegExpNfaFallback)                                \
+  SC(regexp_prefilter_skips, V8.RegExpPrefilterSkips)                          \
+  SC(regexp_prefilter_rejections, V8.RegExpPrefilterRejections)                \
   SC(number_to_string_native, V8.NumberToStringNative)                         \
   SC(number_to_string_runtime, V8.NumberToStringRuntime)                       \
   SC(math_atan2_runtime, V8.MathAtan2Runtime)                                  \
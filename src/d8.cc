@@ -1939,6 +1939,15 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--throws") == 0) {
       options.expected_to_throw = true;
       argv[i] = NULL;
+    } else if (strcmp(argv[i], "--enable-tracing") == 0) {
+      options.trace_enabled = true;
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--trace-config=", 15) == 0) {
+      options.trace_config = argv[i] + 15;
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--trace-path=", 13) == 0) {
+      options.trace_path = argv[i] + 13;
+      argv[i] = NULL;
     } else if (strncmp(argv[i], "--icu-data-file=", 16) == 0) {
       options.icu_data_file = argv[i] + 16;
       argv[i] = NULL;
@@ -1974,6 +1983,13 @@ bool Shell::SetOptions(int argc, char* argv[]) {
 
   v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
 
+#ifndef V8_SHARED
+  if (options.trace_enabled && i::FLAG_verify_predictable) {
+    printf("--enable-tracing is not supported with --verify-predictable\n");
+    return false;
+  }
+#endif  // !V8_SHARED
+
   // Set up isolated source groups.
   options.isolate_sources = new SourceGroup[options.num_isolates];
   SourceGroup* current = options.isolate_sources;
@@ -2410,6 +2426,32 @@ int Shell::Main(int argc, char* argv[]) {
   g_platform = v8::platform::CreateDefaultPlatform();
 #endif  // !V8_SHARED
 
+  // Tracing has to be set up before V8 caches the enabled state of any
+  // category.
+  std::ofstream trace_file;
+  platform::tracing::TracingController* tracing_controller = NULL;
+  if (options.trace_enabled) {
+    const char* trace_path =
+        options.trace_path ? options.trace_path : "v8_trace.json";
+    trace_file.open(trace_path);
+    if (!trace_file.is_open()) {
+      printf("Error opening trace file '%s'\n", trace_path);
+      Exit(1);
+    }
+    platform::tracing::TraceBuffer* trace_buffer =
+        platform::tracing::TraceBuffer::CreateTraceBufferRingBuffer(
+            platform::tracing::TraceBuffer::kRingBufferChunks,
+            platform::tracing::TraceWriter::CreateJSONTraceWriter(trace_file));
+    tracing_controller = new platform::tracing::TracingController();
+    tracing_controller->Initialize(trace_buffer);
+    tracing_controller->StartTracing(
+        options.trace_config
+            ? platform::tracing::TraceConfig::CreateFromCategoryFilter(
+                  options.trace_config)
+            : platform::tracing::TraceConfig::CreateDefaultTraceConfig());
+    platform::SetTracingController(g_platform, tracing_controller);
+  }
+
   v8::V8::InitializePlatform(g_platform);
   v8::V8::Initialize();
   if (options.natives_blob || options.snapshot_blob) {
@@ -2518,6 +2560,7 @@ int Shell::Main(int argc, char* argv[]) {
   }
 #endif  // !V8_SHARED
   isolate->Dispose();
+  if (tracing_controller) tracing_controller->StopTracing();
   V8::Dispose();
   V8::ShutdownPlatform();
   delete g_platform;
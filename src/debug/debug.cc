@@ -539,7 +539,7 @@ bool Debug::Load() {
   ExtensionConfiguration no_extensions;
   Handle<Context> context = isolate_->bootstrapper()->CreateEnvironment(
       MaybeHandle<JSGlobalProxy>(), v8::Local<ObjectTemplate>(), &no_extensions,
-      DEBUG_CONTEXT);
+      0, DEBUG_CONTEXT);
 
   // Fail if no context could be created.
   if (context.is_null()) return false;
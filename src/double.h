@@ -118,6 +118,17 @@ class Double {
     return (d64 & kSignMask) == 0? 1: -1;
   }
 
+  // The boundary between a power of two and its predecessor is closer to the
+  // power of two than the boundary to its successor. Think of v = 1000e10 and
+  // v- = 9999e9: the lower boundary is not at a distance of 1e9 but of 1e8.
+  // The only exception is the smallest normal: the largest denormal is at the
+  // same distance as its successor.
+  bool LowerBoundaryIsCloser() const {
+    uint64_t d64 = AsUint64();
+    bool physical_significand_is_zero = (d64 & kSignificandMask) == 0;
+    return physical_significand_is_zero && (Exponent() != kDenormalExponent);
+  }
+
   // Precondition: the value encoded by this Double must be greater or equal
   // than +0.0.
   DiyFp UpperBoundary() const {
@@ -132,16 +143,9 @@ class Double {
   void NormalizedBoundaries(DiyFp* out_m_minus, DiyFp* out_m_plus) const {
     DCHECK(value() > 0.0);
     DiyFp v = this->AsDiyFp();
-    bool significand_is_zero = (v.f() == kHiddenBit);
     DiyFp m_plus = DiyFp::Normalize(DiyFp((v.f() << 1) + 1, v.e() - 1));
     DiyFp m_minus;
-    if (significand_is_zero && v.e() != kDenormalExponent) {
-      // The boundary is closer. Think of v = 1000e10 and v- = 9999e9.
-      // Then the boundary (== (v - v-)/2) is not just at a distance of 1e9 but
-      // at a distance of 1e8.
-      // The only exception is for the smallest normal: the largest denormal is
-      // at the same distance as its successor.
-      // Note: denormals have the same exponent as the smallest normals.
+    if (LowerBoundaryIsCloser()) {
       m_minus = DiyFp((v.f() << 2) - 1, v.e() - 2);
     } else {
       m_minus = DiyFp((v.f() << 1) - 1, v.e() - 1);
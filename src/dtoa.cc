@@ -13,6 +13,7 @@
 #include "src/double.h"
 #include "src/fast-dtoa.h"
 #include "src/fixed-dtoa.h"
+#include "src/ryu-dtoa.h"
 
 namespace v8 {
 namespace internal {
@@ -55,11 +56,14 @@ void DoubleToAscii(double v, DtoaMode mode, int requested_digits,
     return;
   }
 
+  if (mode == DTOA_SHORTEST) {
+    // Ryu never needs the bignum fallback.
+    RyuDtoa(v, buffer, length, point);
+    return;
+  }
+
   bool fast_worked;
   switch (mode) {
-    case DTOA_SHORTEST:
-      fast_worked = FastDtoa(v, FAST_DTOA_SHORTEST, 0, buffer, length, point);
-      break;
     case DTOA_FIXED:
       fast_worked = FastFixedDtoa(v, requested_digits, buffer, length, point);
       break;
@@ -36,8 +36,8 @@ const int kBase10MaximalLength = 17;
 //   identity requirement is still satisfied. If the digits are printed
 //   (together with the correct exponent) then reading this number will give
 //   'v' again. The buffer will choose the representation that is closest to
-//   'v'. If there are two at the same distance, than the one farther away
-//   from 0 is chosen (halfway cases - ending with 5 - are rounded up).
+//   'v'. If there are two at the same distance, than the one with an even
+//   last digit is chosen.
 //   In this mode the 'requested_digits' parameter is ignored.
 //  - FIXED: produces digits necessary to print a given number with
 //   'requested_digits' digits after the decimal point. The produced digits
@@ -366,6 +366,15 @@ ExternalReferenceTable::ExternalReferenceTable(Isolate* isolate) {
         Deoptimizer::CALCULATE_ENTRY_ADDRESS);
     Add(address, "lazy_deopt");
   }
+
+  // Embedder references go last, so that V8's own references keep their
+  // encoding no matter which embedder references are registered.
+  intptr_t* api_references = isolate->api_external_references();
+  if (api_references != NULL) {
+    for (; *api_references != 0; api_references++) {
+      Add(reinterpret_cast<Address>(*api_references), "<embedder>");
+    }
+  }
 }
 
 }  // namespace internal
@@ -274,6 +274,19 @@ MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
                  length - non_ascii_start);
   int utf16_length = static_cast<int>(decoder->Utf16Length());
   DCHECK(utf16_length > 0);
+  if (decoder->IsOneByte()) {
+    // Latin-1 input still fits in a one-byte string.
+    Handle<SeqOneByteString> result;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate(), result,
+        NewRawOneByteString(non_ascii_start + utf16_length, pretenure),
+        String);
+    DisallowHeapAllocation no_gc;
+    uint8_t* data = result->GetChars();
+    CopyChars(data, reinterpret_cast<const uint8_t*>(start), non_ascii_start);
+    decoder->WriteOneByte(data + non_ascii_start, utf16_length);
+    return result;
+  }
   // Allocate string.
   Handle<SeqTwoByteString> result;
   ASSIGN_RETURN_ON_EXCEPTION(
@@ -281,13 +294,11 @@ MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
       NewRawTwoByteString(non_ascii_start + utf16_length, pretenure),
       String);
   // Copy ASCII portion.
+  DisallowHeapAllocation no_gc;
   uint16_t* data = result->GetChars();
-  const char* ascii_data = string.start();
-  for (int i = 0; i < non_ascii_start; i++) {
-    *data++ = *ascii_data++;
-  }
+  CopyChars(data, reinterpret_cast<const uint8_t*>(start), non_ascii_start);
   // Now write the remainder.
-  decoder->WriteUtf16(data, utf16_length);
+  decoder->WriteUtf16(data + non_ascii_start, utf16_length);
   return result;
 }
 
@@ -2380,6 +2391,18 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpMaxRegisterCountIndex, Smi::FromInt(0));
   store->set(JSRegExp::kIrregexpCaptureCountIndex,
              Smi::FromInt(capture_count));
+  store->set(JSRegExp::kIrregexpLatin1BytecodeIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpUC16BytecodeIndex, uninitialized);
+  int ticks_until_tier_up =
+      FLAG_regexp_tier_up ? Max(0, FLAG_regexp_tier_up_ticks) : 0;
+  store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+             Smi::FromInt(ticks_until_tier_up));
+  store->set(JSRegExp::kIrregexpNfaProgramIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpRequiredLiteralIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpRequiredLiteralMinOffsetIndex,
+             Smi::FromInt(0));
+  store->set(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex,
+             Smi::FromInt(-1));
   regexp->set_data(*store);
 }
 
@@ -745,6 +745,9 @@ DEFINE_BOOL(trace_object_groups, false,
 // heap-snapshot-generator.cc
 DEFINE_BOOL(heap_profiler_trace_objects, false,
             "Dump heap object allocations/movements/size_updates")
+DEFINE_INT(heap_snapshot_streaming_buffer, 1 << 20,
+           "number of edges and strings kept in memory while writing out a "
+           "streamed heap snapshot")
 
 
 // sampling-heap-profiler.cc
@@ -836,15 +839,41 @@ DEFINE_BOOL(trace_rail, false, "trace RAIL mode")
 
 // runtime.cc
 DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
+DEFINE_INT(runtime_call_stats_sampling, 0,
+           "measure only 1 in n outermost runtime calls and the calls nested "
+           "in them, to be queried through the API (0 disables sampling)")
 
 // snapshot-common.cc
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(lazy_deserialization, true,
+            "Deserialize builtins from the snapshot on first use.")
 
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
+DEFINE_BOOL(regexp_tier_up, true,
+            "interpret regexp bytecode first and compile to native code "
+            "once the regexp is hot")
+DEFINE_INT(regexp_tier_up_ticks, 1,
+           "number of interpreted executions before a regexp is compiled "
+           "to native code")
+DEFINE_INT(regexp_tier_up_subject_length, 1000,
+           "subject length from which a regexp is compiled to native code "
+           "right away")
+DEFINE_BOOL(regexp_nfa, false,
+            "execute regexps with the linear-time automaton whenever the "
+            "pattern allows it")
+DEFINE_BOOL(regexp_nfa_on_excessive_backtracks, true,
+            "switch regexps to the linear-time automaton when executing "
+            "them backtracks too much")
+DEFINE_INT(regexp_backtracks_before_nfa, 50000,
+           "number of backtracks of a regexp execution before switching to "
+           "the linear-time automaton")
+DEFINE_BOOL(regexp_prefilter, true,
+            "search for a literal that every match must contain before "
+            "running a regexp")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
@@ -1027,9 +1056,19 @@ DEFINE_BOOL(prof_cpp, false, "Like --prof, but ignore generated code.")
 DEFINE_IMPLICATION(prof, prof_cpp)
 DEFINE_BOOL(prof_browser_mode, true,
             "Used with --prof, turns on browser-compatible mode for profiling.")
+DEFINE_BOOL(prof_cpu_timers, true,
+            "Used with --prof on Linux, samples every thread after it has "
+            "used up the sampling interval in CPU time, instead of signalling "
+            "it from a sampler thread.")
 DEFINE_BOOL(log_regexp, false, "Log regular expression execution.")
 DEFINE_STRING(logfile, "v8.log", "Specify the name of the log file.")
 DEFINE_BOOL(logfile_per_isolate, true, "Separate log files for each isolate.")
+DEFINE_BOOL(log_async, true,
+            "Buffer the log file in memory and write it on a background "
+            "thread. The last lines may be lost if the process crashes.")
+DEFINE_BOOL(log_binary, false,
+            "Use a compact binary format for code creation and tick events "
+            "in the log file.")
 DEFINE_BOOL(ll_prof, false, "Enable low-level linux profiler.")
 DEFINE_BOOL(perf_basic_prof, false,
             "Enable perf linux profiler (basic support).")
@@ -1039,9 +1078,12 @@ DEFINE_BOOL(perf_basic_prof_only_functions, false,
 DEFINE_IMPLICATION(perf_basic_prof_only_functions, perf_basic_prof)
 DEFINE_BOOL(perf_prof, false,
             "Enable perf linux profiler (experimental annotate support).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 DEFINE_BOOL(perf_prof_debug_info, false,
             "Enable debug info for perf linux profiler (experimental).")
+DEFINE_BOOL(perf_prof_unwinding_info, false,
+            "Enable unwinding info for perf linux profiler (experimental, "
+            "x64 only).")
+DEFINE_IMPLICATION(perf_prof_unwinding_info, perf_prof)
 DEFINE_STRING(gc_fake_mmap, "/tmp/__v8_gc__",
               "Specify the name of the file for fake gc mmap used in ll_prof")
 DEFINE_BOOL(log_internal_timer_events, false, "Time internal events.")
@@ -4,6 +4,8 @@
 
 #include "src/heap/gc-tracer.h"
 
+#include <cmath>
+
 #include "src/counters.h"
 #include "src/heap/heap-inl.h"
 #include "src/isolate.h"
@@ -21,11 +23,55 @@ static intptr_t CountTotalHolesSize(Heap* heap) {
 }
 
 
+const double LatencyHistogram::kMinMs = 0.01;
+
+
+void LatencyHistogram::Record(double duration_ms) {
+  int bucket = 0;
+  if (duration_ms > kMinMs) {
+    bucket = static_cast<int>(
+        std::ceil(kBucketsPerDoubling * std::log2(duration_ms / kMinMs)));
+    bucket = Min(bucket, kBuckets - 1);
+  }
+  buckets_[bucket]++;
+  count_++;
+  total_ms_ += duration_ms;
+  max_ms_ = Max(max_ms_, duration_ms);
+}
+
+
+double LatencyHistogram::Percentile(double fraction) const {
+  if (count_ == 0) return 0;
+  size_t rank = static_cast<size_t>(std::ceil(fraction * count_));
+  rank = Max<size_t>(rank, 1);
+  size_t seen = 0;
+  for (int i = 0; i < kBuckets - 1; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) return Min(UpperBound(i), max_ms_);
+  }
+  return max_ms_;
+}
+
+
+void LatencyHistogram::Reset() {
+  for (int i = 0; i < kBuckets; i++) buckets_[i] = 0;
+  count_ = 0;
+  total_ms_ = 0;
+  max_ms_ = 0;
+}
+
+
+double LatencyHistogram::UpperBound(int bucket) {
+  return kMinMs * std::pow(2.0, static_cast<double>(bucket) /
+                                    kBucketsPerDoubling);
+}
+
+
 GCTracer::Scope::Scope(GCTracer* tracer, ScopeId scope)
     : tracer_(tracer), scope_(scope) {
   start_time_ = tracer_->heap_->MonotonicallyIncreasingTimeInMs();
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (FLAG_runtime_call_stats) {
+  if (RuntimeCallStats::IsEnabled()) {
     RuntimeCallStats::Enter(tracer_->heap_->isolate(), &timer_,
                             &RuntimeCallStats::GC);
   }
@@ -37,7 +83,7 @@ GCTracer::Scope::~Scope() {
   tracer_->current_.scopes[scope_] +=
       tracer_->heap_->MonotonicallyIncreasingTimeInMs() - start_time_;
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (FLAG_runtime_call_stats) {
+  if (RuntimeCallStats::IsEnabled()) {
     RuntimeCallStats::Leave(tracer_->heap_->isolate(), &timer_);
   }
 }
@@ -129,7 +175,9 @@ GCTracer::GCTracer(Heap* heap)
       new_space_allocation_in_bytes_since_gc_(0),
       old_generation_allocation_in_bytes_since_gc_(0),
       combined_mark_compact_speed_cache_(0.0),
-      start_counter_(0) {
+      start_counter_(0),
+      gc_event_callback_(nullptr),
+      gc_event_callback_data_(nullptr) {
   current_ = Event(Event::START, NULL, NULL);
   current_.end_time = heap_->MonotonicallyIncreasingTimeInMs();
   previous_ = previous_incremental_mark_compactor_event_ = current_;
@@ -207,7 +255,7 @@ void GCTracer::Start(GarbageCollector collector, const char* gc_reason,
   heap_->isolate()->counters()->aggregated_memory_heap_used()->AddSample(
       start_time, used_memory);
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (FLAG_runtime_call_stats) {
+  if (RuntimeCallStats::IsEnabled()) {
     RuntimeCallStats::Enter(heap_->isolate(), &timer_, &RuntimeCallStats::GC);
   }
 }
@@ -301,6 +349,13 @@ void GCTracer::Stop(GarbageCollector collector) {
   heap_->UpdateCumulativeGCStatistics(duration, spent_in_mutator,
                                       current_.scopes[Scope::MC_MARK]);
 
+  if (current_.type == Event::SCAVENGER) {
+    scavenge_latency_.Record(duration);
+  } else {
+    mark_compact_latency_.Record(duration);
+  }
+  if (gc_event_callback_ != nullptr) NotifyGCEvent(duration);
+
   if (current_.type == Event::SCAVENGER && FLAG_trace_gc_ignore_scavenger)
     return;
 
@@ -317,12 +372,51 @@ void GCTracer::Stop(GarbageCollector collector) {
   cumulative_incremental_marking_finalization_steps_ = 0;
   cumulative_incremental_marking_finalization_duration_ = 0.0;
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (FLAG_runtime_call_stats) {
+  if (RuntimeCallStats::IsEnabled()) {
     RuntimeCallStats::Leave(heap_->isolate(), &timer_);
   }
 }
 
 
+void GCTracer::NotifyGCEvent(double duration) const {
+  static const char* const kScopeNames[] = {
+#define SCOPE_NAME(scope) "V8.GC_" #scope,
+      TRACER_SCOPES(SCOPE_NAME)
+#undef SCOPE_NAME
+  };
+  const double* scopes = current_.scopes;
+  v8::GCEvent event;
+  event.type = current_.type == Event::SCAVENGER ? v8::kGCTypeScavenge
+                                                 : v8::kGCTypeMarkSweepCompact;
+  event.incremental = current_.type == Event::INCREMENTAL_MARK_COMPACTOR;
+  event.reason = current_.gc_reason != nullptr ? current_.gc_reason : "";
+  event.start_time_ms = current_.start_time;
+  event.duration_ms = duration;
+  event.incremental_marking_ms = current_.incremental_marking_duration;
+  event.scavenge_ms = scopes[Scope::SCAVENGER_SCAVENGE];
+  event.mark_ms = scopes[Scope::MC_MARK];
+  event.sweep_ms = scopes[Scope::MC_SWEEP];
+  event.evacuate_ms = scopes[Scope::MC_EVACUATE];
+  event.clear_ms = scopes[Scope::MC_CLEAR];
+  event.scope_count = Scope::NUMBER_OF_SCOPES;
+  event.scope_names = kScopeNames;
+  event.scope_times_ms = scopes;
+  event.promoted_bytes = static_cast<size_t>(heap_->promoted_objects_size());
+  event.semi_space_copied_bytes =
+      static_cast<size_t>(heap_->semi_space_copied_object_size());
+  event.promotion_ratio = heap_->promotion_ratio_;
+  event.semi_space_copied_rate = heap_->semi_space_copied_rate_;
+  event.promotion_rate = heap_->promotion_rate_;
+  event.heap_used_before = static_cast<size_t>(current_.start_object_size);
+  event.heap_used_after = static_cast<size_t>(current_.end_object_size);
+  event.heap_committed_before =
+      static_cast<size_t>(current_.start_memory_size);
+  event.heap_committed_after = static_cast<size_t>(current_.end_memory_size);
+  gc_event_callback_(reinterpret_cast<v8::Isolate*>(heap_->isolate()), event,
+                     gc_event_callback_data_);
+}
+
+
 void GCTracer::SampleAllocation(double current_ms,
                                 size_t new_space_counter_bytes,
                                 size_t old_generation_counter_bytes) {
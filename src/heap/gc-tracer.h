@@ -57,6 +57,40 @@ inline BytesAndDuration MakeBytesAndDuration(uint64_t bytes, double duration) {
   return std::make_pair(bytes, duration);
 }
 
+// Log-scale histogram of pause times in milliseconds. Bucket 0 holds pauses
+// of up to kMinMs and bucket i > 0 those of up to kMinMs * 2^(i / 4) that do
+// not fit the previous bucket. The last bucket takes all longer pauses.
+class LatencyHistogram {
+ public:
+  static const int kBuckets = 96;
+  static const int kBucketsPerDoubling = 4;
+  static const double kMinMs;
+
+  LatencyHistogram() { Reset(); }
+
+  void Record(double duration_ms);
+
+  // Returns an upper bound of the duration below which the given fraction of
+  // the recorded pauses lie, or 0 if nothing was recorded.
+  double Percentile(double fraction) const;
+
+  size_t count() const { return count_; }
+  double total_ms() const { return total_ms_; }
+  double max_ms() const { return max_ms_; }
+
+  void Reset();
+
+ private:
+  static double UpperBound(int bucket);
+
+  size_t buckets_[kBuckets];
+  size_t count_;
+  double total_ms_;
+  double max_ms_;
+
+  DISALLOW_COPY_AND_ASSIGN(LatencyHistogram);
+};
+
 enum ScavengeSpeedMode { kForAllObjects, kForSurvivedObjects };
 
 #define TRACER_SCOPES(F)                           \
@@ -374,7 +408,27 @@ class GCTracer {
 
   void ResetForTesting();
 
+  // Installs the embedder callback that receives a v8::GCEvent in Stop().
+  void SetGCEventCallback(v8::GCEventCallback callback, void* data) {
+    gc_event_callback_ = callback;
+    gc_event_callback_data_ = data;
+  }
+
+  // Pause times of all scavenges and mark-compacts since the last reset.
+  const LatencyHistogram& scavenge_latency() const { return scavenge_latency_; }
+  const LatencyHistogram& mark_compact_latency() const {
+    return mark_compact_latency_;
+  }
+
+  void ResetLatencyHistograms() {
+    scavenge_latency_.Reset();
+    mark_compact_latency_.Reset();
+  }
+
  private:
+  // Reports the current event to the embedder's GC event callback.
+  void NotifyGCEvent(double duration) const;
+
   // Print one detailed trace line in name=value format.
   // TODO(ernstm): Move to Heap.
   void PrintNVP() const;
@@ -493,6 +547,12 @@ class GCTracer {
   RingBuffer<double> recorded_context_disposal_times_;
   RingBuffer<double> recorded_survival_ratios_;
 
+  LatencyHistogram scavenge_latency_;
+  LatencyHistogram mark_compact_latency_;
+
+  v8::GCEventCallback gc_event_callback_;
+  void* gc_event_callback_data_;
+
   DISALLOW_COPY_AND_ASSIGN(GCTracer);
 };
 }  // namespace internal
@@ -685,6 +685,12 @@ int Heap::NextScriptId() {
   return last_id;
 }
 
+int Heap::NextTemplateSerialNumber() {
+  int next = next_template_serial_number()->value() + 1;
+  set_next_template_serial_number(Smi::FromInt(next));
+  return next;
+}
+
 void Heap::SetArgumentsAdaptorDeoptPCOffset(int pc_offset) {
   DCHECK(arguments_adaptor_deopt_pc_offset() == Smi::FromInt(0));
   set_arguments_adaptor_deopt_pc_offset(Smi::FromInt(pc_offset));
@@ -141,6 +141,7 @@ Heap::Heap()
       gc_idle_time_handler_(nullptr),
       memory_reducer_(nullptr),
       object_stats_(nullptr),
+      track_object_stats_(false),
       scavenge_job_(nullptr),
       idle_scavenge_observer_(nullptr),
       full_codegen_bytes_generated_(0),
@@ -893,6 +894,7 @@ void Heap::CollectAllAvailableGarbage(const char* gc_reason) {
     isolate()->optimizing_compile_dispatcher()->Flush();
   }
   isolate()->ClearSerializerData();
+  isolate()->ClearICUObjectCache();
   set_current_gc_flags(kMakeHeapIterableMask | kReduceMemoryFootprintMask);
   isolate_->compilation_cache()->Clear();
   const int kMaxNumberOfAttempts = 7;
@@ -1225,6 +1227,18 @@ void Heap::ClearNormalizedMapCaches() {
 }
 
 
+void Heap::ClearJsonParseFeedback() {
+  // The feedback holds on to maps, which should not be kept alive by it
+  // beyond the next full GC.
+  Object* context = native_contexts_list();
+  while (!context->IsUndefined()) {
+    Context::cast(context)->set(Context::JSON_PARSE_FEEDBACK_INDEX,
+                                undefined_value());
+    context = Context::cast(context)->next_context_link();
+  }
+}
+
+
 void Heap::UpdateSurvivalStatistics(int start_new_space_size) {
   if (start_new_space_size == 0) return;
 
@@ -1467,6 +1481,7 @@ void Heap::MarkCompactPrologue() {
 
   FlushNumberStringCache();
   ClearNormalizedMapCaches();
+  ClearJsonParseFeedback();
 }
 
 
@@ -2867,6 +2882,9 @@ void Heap::CreateInitialObjects() {
 
   set_noscript_shared_function_infos(Smi::FromInt(0));
 
+  set_serialized_templates(empty_fixed_array());
+  set_next_template_serial_number(Smi::FromInt(0));
+
   // Initialize keyed lookup cache.
   isolate_->keyed_lookup_cache()->Clear();
 
@@ -2900,6 +2918,7 @@ bool Heap::RootCanBeWrittenAfterInitialization(Heap::RootListIndex root_index) {
     case kRetainedMapsRootIndex:
     case kNoScriptSharedFunctionInfosRootIndex:
     case kWeakStackTraceListRootIndex:
+    case kSerializedTemplatesRootIndex:
 // Smi values
 #define SMI_ENTRY(type, name, Name) case k##Name##RootIndex:
       SMI_ROOT_LIST(SMI_ENTRY)
@@ -2920,6 +2939,12 @@ bool Heap::RootCanBeTreatedAsConstant(RootListIndex root_index) {
 }
 
 
+void Heap::SetSerializedTemplates(FixedArray* templates) {
+  DCHECK(isolate()->serializer_enabled());
+  set_serialized_templates(templates);
+}
+
+
 int Heap::FullSizeNumberStringCacheLength() {
   // Compute the size of the number string cache based on the max newspace size.
   // The number string cache has a minimum size based on twice the initial cache
@@ -4433,6 +4458,7 @@ void Heap::CheckMemoryPressure() {
 }
 
 void Heap::CollectGarbageOnMemoryPressure(const char* source) {
+  isolate()->ClearICUObjectCache();
   CollectAllGarbage(kReduceMemoryFootprintMask | kAbortIncrementalMarkingMask,
                     source);
 }
@@ -195,7 +195,8 @@ using v8::MemoryPressureLevel;
   V(Map, bytecode_array_map, BytecodeArrayMap)                                 \
   V(WeakCell, empty_weak_cell, EmptyWeakCell)                                  \
   V(PropertyCell, has_instance_protector, HasInstanceProtector)                \
-  V(Cell, species_protector, SpeciesProtector)
+  V(Cell, species_protector, SpeciesProtector)                                 \
+  V(FixedArray, serialized_templates, SerializedTemplates)
 
 // Entries in this list are limited to Smis and are not visited during GC.
 #define SMI_ROOT_LIST(V)                                                   \
@@ -206,7 +207,8 @@ using v8::MemoryPressureLevel;
   V(Smi, construct_stub_deopt_pc_offset, ConstructStubDeoptPCOffset)       \
   V(Smi, getter_stub_deopt_pc_offset, GetterStubDeoptPCOffset)             \
   V(Smi, setter_stub_deopt_pc_offset, SetterStubDeoptPCOffset)             \
-  V(Smi, interpreter_entry_return_pc_offset, InterpreterEntryReturnPCOffset)
+  V(Smi, interpreter_entry_return_pc_offset, InterpreterEntryReturnPCOffset) \
+  V(Smi, next_template_serial_number, NextTemplateSerialNumber)
 
 #define ROOT_LIST(V)  \
   STRONG_ROOT_LIST(V) \
@@ -781,6 +783,8 @@ class Heap {
 
   void ClearNormalizedMapCaches();
 
+  void ClearJsonParseFeedback();
+
   void IncrementDeferredCount(v8::Isolate::UseCounterFeature feature);
 
   inline bool OldGenerationAllocationLimitReached();
@@ -793,6 +797,11 @@ class Heap {
 
   inline int NextScriptId();
 
+  // Returns the serial number for a new cacheable template. Kept in the root
+  // list, so templates created after deserialization do not collide with the
+  // ones in the snapshot.
+  inline int NextTemplateSerialNumber();
+
   inline void SetArgumentsAdaptorDeoptPCOffset(int pc_offset);
   inline void SetConstructStubDeoptPCOffset(int pc_offset);
   inline void SetGetterStubDeoptPCOffset(int pc_offset);
@@ -1003,6 +1012,10 @@ class Heap {
     roots_[kNoScriptSharedFunctionInfosRootIndex] = value;
   }
 
+  // Sets the templates that FunctionTemplate::FromSnapshot and
+  // ObjectTemplate::FromSnapshot look up in isolates created from a snapshot.
+  void SetSerializedTemplates(FixedArray* templates);
+
   // Set the stack limit in the roots_ array.  Some architectures generate
   // code that looks here, because it is faster than loading from the static
   // jslimit_/real_jslimit_ variable in the StackGuard.
@@ -1165,6 +1178,13 @@ class Heap {
   // Object statistics tracking. ===============================================
   // ===========================================================================
 
+  // Object statistics are tracked during major GCs if enabled either for this
+  // heap or for all heaps with --track-gc-object-stats.
+  void set_track_object_stats(bool track) { track_object_stats_ = track; }
+  bool ShouldTrackObjectStats() const {
+    return FLAG_track_gc_object_stats || track_object_stats_;
+  }
+
   // Returns the number of buckets used by object statistics tracking during a
   // major GC. Note that the following methods fail gracefully when the bounds
   // are exceeded though.
@@ -2170,6 +2190,7 @@ class Heap {
   MemoryReducer* memory_reducer_;
 
   ObjectStats* object_stats_;
+  bool track_object_stats_;
 
   ScavengeJob* scavenge_job_;
 
@@ -2254,7 +2275,6 @@ class Heap {
   friend class MarkCompactCollector;
   friend class MarkCompactMarkingVisitor;
   friend class NewSpace;
-  friend class ObjectStatsVisitor;
   friend class Page;
   friend class Scavenger;
   friend class StoreBuffer;
@@ -509,9 +509,10 @@ void MarkCompactCollector::Sweeper::StartSweeping() {
 void MarkCompactCollector::Sweeper::StartSweepingHelper(
     AllocationSpace space_to_start) {
   num_sweeping_tasks_++;
-  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+  V8::GetCurrentPlatform()->CallPrioritizedOnBackgroundThread(
+      reinterpret_cast<v8::Isolate*>(heap_->isolate()),
       new SweeperTask(this, &pending_sweeper_tasks_semaphore_, space_to_start),
-      v8::Platform::kShortRunningTask);
+      v8::Platform::kUserVisibleTask);
 }
 
 void MarkCompactCollector::Sweeper::SweepOrWaitUntilSweepingCompleted(
@@ -1301,10 +1302,6 @@ void MarkCompactMarkingVisitor::Initialize() {
   StaticMarkingVisitor<MarkCompactMarkingVisitor>::Initialize();
 
   table_.Register(kVisitJSRegExp, &VisitRegExpAndFlushCode);
-
-  if (FLAG_track_gc_object_stats) {
-    ObjectStatsVisitor::Initialize(&table_);
-  }
 }
 
 
@@ -2336,7 +2333,8 @@ void MarkCompactCollector::MarkLiveObjects() {
     heap_->tracer()->AddMarkingTime(heap_->MonotonicallyIncreasingTimeInMs() -
                                     start_time);
   }
-  if (FLAG_track_gc_object_stats) {
+  if (heap()->ShouldTrackObjectStats()) {
+    heap()->object_stats_->CollectLiveObjectStats();
     if (FLAG_trace_gc_object_stats) {
       heap()->object_stats_->TraceObjectStats();
     }
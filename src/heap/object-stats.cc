@@ -6,6 +6,8 @@
 
 #include "src/counters.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/mark-compact-inl.h"
+#include "src/heap/spaces-inl.h"
 #include "src/isolate.h"
 #include "src/utils.h"
 
@@ -135,112 +137,93 @@ void ObjectStats::CheckpointObjectStats() {
 Isolate* ObjectStats::isolate() { return heap()->isolate(); }
 
 
-void ObjectStatsVisitor::CountFixedArray(
-    FixedArrayBase* fixed_array, FixedArraySubInstanceType fast_type,
-    FixedArraySubInstanceType dictionary_type) {
-  Heap* heap = fixed_array->map()->GetHeap();
-  if (fixed_array->map() != heap->fixed_cow_array_map() &&
-      fixed_array->map() != heap->fixed_double_array_map() &&
-      fixed_array != heap->empty_fixed_array()) {
-    if (fixed_array->IsDictionary()) {
-      heap->object_stats_->RecordFixedArraySubTypeStats(dictionary_type,
-                                                        fixed_array->Size());
-    } else {
-      heap->object_stats_->RecordFixedArraySubTypeStats(fast_type,
-                                                        fixed_array->Size());
-    }
+void ObjectStats::CollectLiveObjectStats() {
+  CollectLiveObjectStats(heap()->old_space());
+  CollectLiveObjectStats(heap()->code_space());
+  CollectLiveObjectStats(heap()->map_space());
+  CollectLiveObjectStats(heap()->new_space());
+  LargeObjectIterator it(heap()->lo_space());
+  for (HeapObject* obj = it.Next(); obj != NULL; obj = it.Next()) {
+    if (Marking::IsBlack(Marking::MarkBitFrom(obj))) RecordObject(obj);
   }
 }
 
 
-void ObjectStatsVisitor::VisitBase(VisitorId id, Map* map, HeapObject* obj) {
-  Heap* heap = map->GetHeap();
-  int object_size = obj->Size();
-  heap->object_stats_->RecordObjectStats(map->instance_type(), object_size);
-  table_.GetVisitorById(id)(map, obj);
-  if (obj->IsJSObject()) {
-    JSObject* object = JSObject::cast(obj);
-    CountFixedArray(object->elements(), DICTIONARY_ELEMENTS_SUB_TYPE,
-                    FAST_ELEMENTS_SUB_TYPE);
-    CountFixedArray(object->properties(), DICTIONARY_PROPERTIES_SUB_TYPE,
-                    FAST_PROPERTIES_SUB_TYPE);
+void ObjectStats::CollectLiveObjectStats(PagedSpace* space) {
+  PageIterator it(space);
+  while (it.has_next()) {
+    Page* page = it.next();
+    HeapObject* obj;
+    if (page->IsFlagSet(Page::BLACK_PAGE)) {
+      HeapObjectIterator objects(page);
+      while ((obj = objects.Next()) != nullptr) RecordObject(obj);
+    } else {
+      LiveObjectIterator<kBlackObjects> objects(page);
+      while ((obj = objects.Next()) != nullptr) RecordObject(obj);
+    }
   }
 }
 
 
-template <ObjectStatsVisitor::VisitorId id>
-void ObjectStatsVisitor::Visit(Map* map, HeapObject* obj) {
-  VisitBase(id, map, obj);
-}
-
-
-template <>
-void ObjectStatsVisitor::Visit<ObjectStatsVisitor::kVisitMap>(Map* map,
-                                                              HeapObject* obj) {
-  Heap* heap = map->GetHeap();
-  Map* map_obj = Map::cast(obj);
-  DCHECK(map->instance_type() == MAP_TYPE);
-  DescriptorArray* array = map_obj->instance_descriptors();
-  if (map_obj->owns_descriptors() && array != heap->empty_descriptor_array()) {
-    int fixed_array_size = array->Size();
-    heap->object_stats_->RecordFixedArraySubTypeStats(DESCRIPTOR_ARRAY_SUB_TYPE,
-                                                      fixed_array_size);
+void ObjectStats::CollectLiveObjectStats(NewSpace* space) {
+  NewSpacePageIterator it(space->bottom(), space->top());
+  while (it.has_next()) {
+    LiveObjectIterator<kBlackObjects> objects(it.next());
+    HeapObject* obj;
+    while ((obj = objects.Next()) != nullptr) RecordObject(obj);
   }
-  if (map_obj->has_code_cache()) {
-    FixedArray* cache = FixedArray::cast(map_obj->code_cache());
-    heap->object_stats_->RecordFixedArraySubTypeStats(MAP_CODE_CACHE_SUB_TYPE,
-                                                      cache->Size());
-  }
-  VisitBase(kVisitMap, map, obj);
 }
 
 
-template <>
-void ObjectStatsVisitor::Visit<ObjectStatsVisitor::kVisitCode>(
-    Map* map, HeapObject* obj) {
-  Heap* heap = map->GetHeap();
-  int object_size = obj->Size();
-  DCHECK(map->instance_type() == CODE_TYPE);
-  Code* code_obj = Code::cast(obj);
-  heap->object_stats_->RecordCodeSubTypeStats(code_obj->kind(),
-                                              code_obj->GetAge(), object_size);
-  VisitBase(kVisitCode, map, obj);
-}
-
-
-template <>
-void ObjectStatsVisitor::Visit<ObjectStatsVisitor::kVisitSharedFunctionInfo>(
-    Map* map, HeapObject* obj) {
-  Heap* heap = map->GetHeap();
-  SharedFunctionInfo* sfi = SharedFunctionInfo::cast(obj);
-  if (sfi->scope_info() != heap->empty_fixed_array()) {
-    heap->object_stats_->RecordFixedArraySubTypeStats(
-        SCOPE_INFO_SUB_TYPE, FixedArray::cast(sfi->scope_info())->Size());
+void ObjectStats::RecordFixedArray(FixedArrayBase* fixed_array,
+                                   FixedArraySubInstanceType fast_type,
+                                   FixedArraySubInstanceType dictionary_type) {
+  if (fixed_array->map() != heap()->fixed_cow_array_map() &&
+      fixed_array->map() != heap()->fixed_double_array_map() &&
+      fixed_array != heap()->empty_fixed_array()) {
+    if (fixed_array->IsDictionary()) {
+      RecordFixedArraySubTypeStats(dictionary_type, fixed_array->Size());
+    } else {
+      RecordFixedArraySubTypeStats(fast_type, fixed_array->Size());
+    }
   }
-  VisitBase(kVisitSharedFunctionInfo, map, obj);
 }
 
 
-template <>
-void ObjectStatsVisitor::Visit<ObjectStatsVisitor::kVisitFixedArray>(
-    Map* map, HeapObject* obj) {
-  Heap* heap = map->GetHeap();
-  FixedArray* fixed_array = FixedArray::cast(obj);
-  if (fixed_array == heap->string_table()) {
-    heap->object_stats_->RecordFixedArraySubTypeStats(STRING_TABLE_SUB_TYPE,
-                                                      fixed_array->Size());
+void ObjectStats::RecordObject(HeapObject* obj) {
+  Map* map = obj->map();
+  int object_size = obj->SizeFromMap(map);
+  RecordObjectStats(map->instance_type(), object_size);
+  if (obj->IsJSObject()) {
+    JSObject* object = JSObject::cast(obj);
+    RecordFixedArray(object->elements(), FAST_ELEMENTS_SUB_TYPE,
+                     DICTIONARY_ELEMENTS_SUB_TYPE);
+    RecordFixedArray(object->properties(), FAST_PROPERTIES_SUB_TYPE,
+                     DICTIONARY_PROPERTIES_SUB_TYPE);
+  } else if (obj->IsMap()) {
+    Map* map_obj = Map::cast(obj);
+    DescriptorArray* array = map_obj->instance_descriptors();
+    if (map_obj->owns_descriptors() &&
+        array != heap()->empty_descriptor_array()) {
+      RecordFixedArraySubTypeStats(DESCRIPTOR_ARRAY_SUB_TYPE, array->Size());
+    }
+    if (map_obj->has_code_cache()) {
+      FixedArray* cache = FixedArray::cast(map_obj->code_cache());
+      RecordFixedArraySubTypeStats(MAP_CODE_CACHE_SUB_TYPE, cache->Size());
+    }
+  } else if (obj->IsCode()) {
+    Code* code_obj = Code::cast(obj);
+    RecordCodeSubTypeStats(code_obj->kind(), code_obj->GetAge(), object_size);
+  } else if (obj->IsSharedFunctionInfo()) {
+    SharedFunctionInfo* sfi = SharedFunctionInfo::cast(obj);
+    if (sfi->scope_info() != heap()->empty_fixed_array()) {
+      RecordFixedArraySubTypeStats(
+          SCOPE_INFO_SUB_TYPE, FixedArray::cast(sfi->scope_info())->Size());
+    }
+  } else if (obj == heap()->string_table()) {
+    RecordFixedArraySubTypeStats(STRING_TABLE_SUB_TYPE,
+                                 FixedArray::cast(obj)->Size());
   }
-  VisitBase(kVisitFixedArray, map, obj);
-}
-
-
-void ObjectStatsVisitor::Initialize(VisitorDispatchTable<Callback>* original) {
-  // Copy the original visitor table to make call-through possible. After we
-  // preserved a copy locally, we patch the original table to call us.
-  table_.CopyFrom(original);
-#define COUNT_FUNCTION(id) original->Register(kVisit##id, Visit<kVisit##id>);
-  VISITOR_ID_LIST(COUNT_FUNCTION)
-#undef COUNT_FUNCTION
 }
 
 }  // namespace internal
@@ -6,7 +6,6 @@
 #define V8_HEAP_OBJECT_STATS_H_
 
 #include "src/heap/heap.h"
-#include "src/heap/objects-visiting.h"
 #include "src/objects.h"
 
 namespace v8 {
@@ -30,6 +29,10 @@ class ObjectStats {
 
   void ClearObjectStats(bool clear_last_time_stats = false);
 
+  // Records the type and size of every object that the current mark-compact
+  // has marked live. Must be called between marking and sweeping.
+  void CollectLiveObjectStats();
+
   void TraceObjectStats();
   void TraceObjectStat(const char* name, int count, int size, double time);
   void CheckpointObjectStats();
@@ -72,6 +75,13 @@ class ObjectStats {
   Heap* heap() { return heap_; }
 
  private:
+  void CollectLiveObjectStats(PagedSpace* space);
+  void CollectLiveObjectStats(NewSpace* space);
+  void RecordObject(HeapObject* obj);
+  void RecordFixedArray(FixedArrayBase* fixed_array,
+                        FixedArraySubInstanceType fast_type,
+                        FixedArraySubInstanceType dictionary_type);
+
   Heap* heap_;
 
   // Object counts and used memory by InstanceType
@@ -81,21 +91,6 @@ class ObjectStats {
   size_t object_sizes_last_time_[OBJECT_STATS_COUNT];
 };
 
-
-class ObjectStatsVisitor : public StaticMarkingVisitor<ObjectStatsVisitor> {
- public:
-  static void Initialize(VisitorDispatchTable<Callback>* original);
-
-  static void VisitBase(VisitorId id, Map* map, HeapObject* obj);
-
-  static void CountFixedArray(FixedArrayBase* fixed_array,
-                              FixedArraySubInstanceType fast_type,
-                              FixedArraySubInstanceType dictionary_type);
-
-  template <VisitorId id>
-  static inline void Visit(Map* map, HeapObject* obj);
-};
-
 }  // namespace internal
 }  // namespace v8
 
@@ -92,8 +92,9 @@ class PageParallelJob {
                             pending_tasks_, per_task_data_callback(i));
       task_ids[i] = task->id();
       if (i > 0) {
-        V8::GetCurrentPlatform()->CallOnBackgroundThread(
-            task, v8::Platform::kShortRunningTask);
+        V8::GetCurrentPlatform()->CallPrioritizedOnBackgroundThread(
+            reinterpret_cast<v8::Isolate*>(heap_->isolate()), task,
+            v8::Platform::kUserBlockingTask);
       } else {
         main_task = task;
       }
@@ -7,6 +7,7 @@
 #include "src/base/bits.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/semaphore.h"
+#include "src/cancelable-task.h"
 #include "src/full-codegen/full-codegen.h"
 #include "src/heap/slot-set.h"
 #include "src/macro-assembler.h"
@@ -347,13 +348,14 @@ void MemoryAllocator::TearDown() {
   code_range_ = nullptr;
 }
 
-class MemoryAllocator::Unmapper::UnmapFreeMemoryTask : public v8::Task {
+class MemoryAllocator::Unmapper::UnmapFreeMemoryTask : public CancelableTask {
  public:
-  explicit UnmapFreeMemoryTask(Unmapper* unmapper) : unmapper_(unmapper) {}
+  UnmapFreeMemoryTask(Isolate* isolate, Unmapper* unmapper)
+      : CancelableTask(isolate), unmapper_(unmapper) {}
 
  private:
-  // v8::Task overrides.
-  void Run() override {
+  // CancelableTask overrides.
+  void RunInternal() override {
     unmapper_->PerformFreeMemoryOnQueuedChunks();
     unmapper_->pending_unmapping_tasks_semaphore_.Signal();
   }
@@ -364,22 +366,41 @@ class MemoryAllocator::Unmapper::UnmapFreeMemoryTask : public v8::Task {
 
 void MemoryAllocator::Unmapper::FreeQueuedChunks() {
   if (FLAG_concurrent_sweeping) {
-    V8::GetCurrentPlatform()->CallOnBackgroundThread(
-        new UnmapFreeMemoryTask(this), v8::Platform::kShortRunningTask);
-    concurrent_unmapping_tasks_active_++;
+    if (concurrent_unmapping_tasks_active_ >= kMaxUnmapperTasks) {
+      // No task slot is left. Free the queued chunks on this thread, which
+      // also retires the posted tasks so that later calls can post again.
+      WaitUntilCompleted();
+      return;
+    }
+    UnmapFreeMemoryTask* task =
+        new UnmapFreeMemoryTask(allocator_->isolate_, this);
+    task_ids_[concurrent_unmapping_tasks_active_++] = task->id();
+    V8::GetCurrentPlatform()->CallPrioritizedOnBackgroundThread(
+        reinterpret_cast<v8::Isolate*>(allocator_->isolate_), task,
+        v8::Platform::kBestEffortTask);
   } else {
     PerformFreeMemoryOnQueuedChunks();
   }
 }
 
 bool MemoryAllocator::Unmapper::WaitUntilCompleted() {
-  bool waited = false;
-  while (concurrent_unmapping_tasks_active_ > 0) {
+  // The tasks run at best-effort priority, so rather than waiting for a
+  // worker to pick them up, cancel the ones that have not started and free
+  // the chunks on this thread. Only tasks that are already running are
+  // waited for.
+  CancelableTaskManager* task_manager =
+      allocator_->isolate_->cancelable_task_manager();
+  int running_tasks = 0;
+  for (int i = 0; i < concurrent_unmapping_tasks_active_; i++) {
+    if (!task_manager->TryAbort(task_ids_[i])) running_tasks++;
+  }
+  bool had_tasks = concurrent_unmapping_tasks_active_ > 0;
+  concurrent_unmapping_tasks_active_ = 0;
+  if (had_tasks) PerformFreeMemoryOnQueuedChunks();
+  for (int i = 0; i < running_tasks; i++) {
     pending_unmapping_tasks_semaphore_.Wait();
-    concurrent_unmapping_tasks_active_--;
-    waited = true;
   }
-  return waited;
+  return running_tasks > 0;
 }
 
 void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
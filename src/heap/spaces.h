@@ -1338,6 +1338,8 @@ class MemoryAllocator {
     bool WaitUntilCompleted();
 
    private:
+    static const int kMaxUnmapperTasks = 24;
+
     enum ChunkQueueType {
       kRegular,     // Pages of kPageSize that do not live in a CodeRange and
                     // can thus be used for stealing.
@@ -1368,6 +1370,7 @@ class MemoryAllocator {
     std::list<MemoryChunk*> chunks_[kNumberOfChunkQueues];
     base::Semaphore pending_unmapping_tasks_semaphore_;
     intptr_t concurrent_unmapping_tasks_active_;
+    uint32_t task_ids_[kMaxUnmapperTasks];
 
     friend class MemoryAllocator;
   };
@@ -8,6 +8,7 @@
 #include "src/api.h"
 #include "src/factory.h"
 #include "src/isolate.h"
+#include "src/keys.h"
 #include "unicode/brkiter.h"
 #include "unicode/calendar.h"
 #include "unicode/coll.h"
@@ -695,6 +696,73 @@ void SetResolvedBreakIteratorSettings(Isolate* isolate,
   }
 }
 
+
+// Converts a BCP47 language tag into an ICU locale. Returns false if ICU
+// cannot parse the tag.
+bool ToICULocale(Handle<String> locale, icu::Locale* icu_locale) {
+  UErrorCode status = U_ZERO_ERROR;
+  char icu_result[ULOC_FULLNAME_CAPACITY];
+  int icu_length = 0;
+  v8::String::Utf8Value bcp47_locale(v8::Utils::ToLocal(locale));
+  if (bcp47_locale.length() != 0) {
+    uloc_forLanguageTag(*bcp47_locale, icu_result, ULOC_FULLNAME_CAPACITY,
+                        &icu_length, &status);
+    if (U_FAILURE(status) || icu_length == 0) return false;
+    *icu_locale = icu::Locale(icu_result);
+  }
+  return true;
+}
+
+
+// Builds the ICUObjectCache key for the requested locale and options. The
+// options object is created by the Intl JavaScript code and only holds data
+// properties with primitive values, so this has no observable side effects.
+std::string ICUObjectCacheKey(Isolate* isolate, Handle<String> locale,
+                              Handle<JSObject> options) {
+  std::string key(locale->ToCString().get());
+  Handle<FixedArray> names =
+      KeyAccumulator::GetKeys(options, OWN_ONLY, ENUMERABLE_STRINGS,
+                              CONVERT_TO_STRING)
+          .ToHandleChecked();
+  for (int i = 0; i < names->length(); i++) {
+    Handle<String> name(String::cast(names->get(i)), isolate);
+    Handle<Object> value = JSReceiver::GetDataProperty(options, name);
+    Handle<String> value_string =
+        Object::ToString(isolate, value).ToHandleChecked();
+    key += '\0';
+    key += name->ToCString().get();
+    key += '=';
+    key += value_string->ToCString().get();
+  }
+  return key;
+}
+
+
+template <typename T>
+T* GetCachedICUObject(Isolate* isolate, ICUObjectCache::Type type,
+                      Handle<String> locale, Handle<JSObject> options,
+                      T* (*create)(Isolate*, const icu::Locale&,
+                                   Handle<JSObject>)) {
+  ICUObjectCache* cache = isolate->icu_object_cache();
+  std::string key = ICUObjectCacheKey(isolate, locale, options);
+  icu::UObject* cached = cache->Get(type, key);
+  if (cached != NULL) return static_cast<T*>(cached);
+
+  icu::Locale icu_locale;
+  if (!ToICULocale(locale, &icu_locale)) return NULL;
+  T* object = create(isolate, icu_locale, options);
+  if (object == NULL) {
+    // Remove extensions and try again.
+    icu::Locale no_extension_locale(icu_locale.getBaseName());
+    object = create(isolate, no_extension_locale, options);
+    if (object == NULL) {
+      FATAL("Failed to create ICU object, are ICU data files missing?");
+    }
+  }
+  cache->Put(type, key, object);
+  return object;
+}
+
 }  // namespace
 
 
@@ -710,6 +778,39 @@ Handle<ObjectTemplateInfo> I18N::GetTemplate2(Isolate* isolate) {
 }
 
 
+icu::UObject* ICUObjectCache::Get(Type type, const std::string& key) {
+  for (std::list<Entry>::iterator it = entries_.begin(); it != entries_.end();
+       ++it) {
+    if (it->type == type && it->key == key) {
+      // Move the entry to the front.
+      entries_.splice(entries_.begin(), entries_, it);
+      return it->object;
+    }
+  }
+  return NULL;
+}
+
+
+void ICUObjectCache::Put(Type type, const std::string& key,
+                         icu::UObject* object) {
+  if (entries_.size() >= kMaxSize) {
+    delete entries_.back().object;
+    entries_.pop_back();
+  }
+  Entry entry = {type, key, object};
+  entries_.push_front(entry);
+}
+
+
+void ICUObjectCache::Clear() {
+  for (std::list<Entry>::iterator it = entries_.begin(); it != entries_.end();
+       ++it) {
+    delete it->object;
+  }
+  entries_.clear();
+}
+
+
 // static
 icu::SimpleDateFormat* DateFormat::InitializeDateTimeFormat(
     Isolate* isolate,
@@ -768,6 +869,27 @@ icu::SimpleDateFormat* DateFormat::UnpackDateFormat(
   return NULL;
 }
 
+// static
+icu::SimpleDateFormat* DateFormat::GetCachedDateFormat(
+    Isolate* isolate, Handle<String> locale, Handle<JSObject> options) {
+  return GetCachedICUObject(isolate, ICUObjectCache::kDateFormat, locale,
+                            options, CreateICUDateFormat);
+}
+
+
+// static
+bool DateFormat::HasUnknownTimeZone(icu::SimpleDateFormat* date_format) {
+  // Mirrors the time zone reported by SetResolvedDateSettings.
+  UErrorCode status = U_ZERO_ERROR;
+  icu::UnicodeString time_zone;
+  date_format->getCalendar()->getTimeZone().getID(time_zone);
+  icu::UnicodeString canonical_time_zone;
+  icu::TimeZone::getCanonicalID(time_zone, canonical_time_zone, status);
+  return U_SUCCESS(status) &&
+         canonical_time_zone == UNICODE_STRING_SIMPLE("Etc/Unknown");
+}
+
+
 void DateFormat::DeleteDateFormat(const v8::WeakCallbackInfo<void>& data) {
   delete reinterpret_cast<icu::SimpleDateFormat*>(data.GetInternalField(0));
   GlobalHandles::Destroy(reinterpret_cast<Object**>(data.GetParameter()));
@@ -831,6 +953,14 @@ icu::DecimalFormat* NumberFormat::UnpackNumberFormat(
   return NULL;
 }
 
+// static
+icu::DecimalFormat* NumberFormat::GetCachedNumberFormat(
+    Isolate* isolate, Handle<String> locale, Handle<JSObject> options) {
+  return GetCachedICUObject(isolate, ICUObjectCache::kNumberFormat, locale,
+                            options, CreateICUNumberFormat);
+}
+
+
 void NumberFormat::DeleteNumberFormat(const v8::WeakCallbackInfo<void>& data) {
   delete reinterpret_cast<icu::DecimalFormat*>(data.GetInternalField(0));
   GlobalHandles::Destroy(reinterpret_cast<Object**>(data.GetParameter()));
@@ -890,6 +1020,15 @@ icu::Collator* Collator::UnpackCollator(Isolate* isolate,
   return NULL;
 }
 
+// static
+icu::Collator* Collator::GetCachedCollator(Isolate* isolate,
+                                           Handle<String> locale,
+                                           Handle<JSObject> options) {
+  return GetCachedICUObject(isolate, ICUObjectCache::kCollator, locale,
+                            options, CreateICUCollator);
+}
+
+
 void Collator::DeleteCollator(const v8::WeakCallbackInfo<void>& data) {
   delete reinterpret_cast<icu::Collator*>(data.GetInternalField(0));
   GlobalHandles::Destroy(reinterpret_cast<Object**>(data.GetParameter()));
@@ -6,6 +6,9 @@
 #ifndef V8_I18N_H_
 #define V8_I18N_H_
 
+#include <list>
+#include <string>
+
 #include "src/handles.h"
 #include "unicode/uversion.h"
 
@@ -14,6 +17,7 @@ class BreakIterator;
 class Collator;
 class DecimalFormat;
 class SimpleDateFormat;
+class UObject;
 }
 
 namespace v8 {
@@ -35,6 +39,43 @@ class I18N {
 };
 
 
+// A per-isolate cache of the ICU formatters and collators used by the
+// toLocaleString family of methods, which format without creating an Intl
+// object. Entries are keyed by the requested locale and the resolved options.
+// The least recently used entry is evicted once the cache is full, and the
+// cache is cleared on memory pressure and when the time zone changes.
+class ICUObjectCache {
+ public:
+  enum Type { kCollator, kDateFormat, kNumberFormat };
+
+  ICUObjectCache() {}
+  ~ICUObjectCache() { Clear(); }
+
+  // Returns the object cached for the key, or NULL. The object stays owned by
+  // the cache and is only valid until the next call to Put or Clear.
+  icu::UObject* Get(Type type, const std::string& key);
+
+  // Adds an object for the key and takes ownership of it.
+  void Put(Type type, const std::string& key, icu::UObject* object);
+
+  void Clear();
+
+  static const size_t kMaxSize = 16;
+
+ private:
+  struct Entry {
+    Type type;
+    std::string key;
+    icu::UObject* object;
+  };
+
+  // Ordered from the most to the least recently used.
+  std::list<Entry> entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(ICUObjectCache);
+};
+
+
 class DateFormat {
  public:
   // Create a formatter for the specificied locale and options. Returns the
@@ -49,6 +90,15 @@ class DateFormat {
   static icu::SimpleDateFormat* UnpackDateFormat(Isolate* isolate,
                                                  Handle<JSObject> obj);
 
+  // Returns a formatter for the locale and options from the isolate's
+  // ICUObjectCache, creating it if needed. Returns NULL for invalid locales.
+  static icu::SimpleDateFormat* GetCachedDateFormat(Isolate* isolate,
+                                                    Handle<String> locale,
+                                                    Handle<JSObject> options);
+
+  // Whether ICU did not recognize the time zone of the formatter.
+  static bool HasUnknownTimeZone(icu::SimpleDateFormat* date_format);
+
   // Release memory we allocated for the DateFormat once the JS object that
   // holds the pointer gets garbage collected.
   static void DeleteDateFormat(const v8::WeakCallbackInfo<void>& data);
@@ -72,6 +122,12 @@ class NumberFormat {
   static icu::DecimalFormat* UnpackNumberFormat(Isolate* isolate,
                                                 Handle<JSObject> obj);
 
+  // Returns a formatter for the locale and options from the isolate's
+  // ICUObjectCache, creating it if needed. Returns NULL for invalid locales.
+  static icu::DecimalFormat* GetCachedNumberFormat(Isolate* isolate,
+                                                   Handle<String> locale,
+                                                   Handle<JSObject> options);
+
   // Release memory we allocated for the NumberFormat once the JS object that
   // holds the pointer gets garbage collected.
   static void DeleteNumberFormat(const v8::WeakCallbackInfo<void>& data);
@@ -94,6 +150,12 @@ class Collator {
   // Unpacks collator object from corresponding JavaScript object.
   static icu::Collator* UnpackCollator(Isolate* isolate, Handle<JSObject> obj);
 
+  // Returns a collator for the locale and options from the isolate's
+  // ICUObjectCache, creating it if needed. Returns NULL for invalid locales.
+  static icu::Collator* GetCachedCollator(Isolate* isolate,
+                                          Handle<String> locale,
+                                          Handle<JSObject> options);
+
   // Release memory we allocated for the Collator once the JS object that holds
   // the pointer gets garbage collected.
   static void DeleteCollator(const v8::WeakCallbackInfo<void>& data);
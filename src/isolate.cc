@@ -41,6 +41,10 @@
 #include "src/vm-state-inl.h"
 #include "src/wasm/wasm-module.h"
 
+#ifdef V8_I18N_SUPPORT
+#include "src/i18n.h"
+#endif  // V8_I18N_SUPPORT
+
 namespace v8 {
 namespace internal {
 
@@ -1868,6 +1872,7 @@ Isolate::Isolate(bool enable_serializer)
       has_installed_extensions_(false),
       regexp_stack_(NULL),
       date_cache_(NULL),
+      icu_object_cache_(NULL),
       call_descriptor_data_(NULL),
       // TODO(bmeurer) Initialized lazily because it depends on flags; can
       // be fixed once the default isolate cleanup is done.
@@ -2068,6 +2073,11 @@ Isolate::~Isolate() {
   delete date_cache_;
   date_cache_ = NULL;
 
+#ifdef V8_I18N_SUPPORT
+  delete icu_object_cache_;
+  icu_object_cache_ = NULL;
+#endif  // V8_I18N_SUPPORT
+
   delete[] call_descriptor_data_;
   call_descriptor_data_ = NULL;
 
@@ -2507,6 +2517,19 @@ CodeTracer* Isolate::GetCodeTracer() {
   return code_tracer();
 }
 
+#ifdef V8_I18N_SUPPORT
+ICUObjectCache* Isolate::icu_object_cache() {
+  if (icu_object_cache_ == NULL) icu_object_cache_ = new ICUObjectCache();
+  return icu_object_cache_;
+}
+#endif  // V8_I18N_SUPPORT
+
+void Isolate::ClearICUObjectCache() {
+#ifdef V8_I18N_SUPPORT
+  if (icu_object_cache_ != NULL) icu_object_cache_->Clear();
+#endif  // V8_I18N_SUPPORT
+}
+
 Map* Isolate::get_initial_js_array_map(ElementsKind kind) {
   if (IsFastElementsKind(kind)) {
     DisallowHeapAllocation no_gc;
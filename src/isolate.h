@@ -62,6 +62,7 @@ class HandleScopeImplementer;
 class HeapProfiler;
 class HStatistics;
 class HTracer;
+class ICUObjectCache;
 class InlineRuntimeFunctionsTable;
 class InnerPointerToCodeCache;
 class Logger;
@@ -398,15 +399,14 @@ typedef List<HeapObject*> DebugObjectCache;
   V(FatalErrorCallback, exception_behavior, NULL)                              \
   V(LogEventCallback, event_logger, NULL)                                      \
   V(AllowCodeGenerationFromStringsCallback, allow_code_gen_callback, NULL)     \
-  /* To distinguish the function templates, so that we can find them in the */ \
-  /* function cache of the native context. */                                  \
-  V(int, next_serial_number, 0)                                                \
   V(ExternalReferenceRedirectorPointer*, external_reference_redirector, NULL)  \
   /* State for Relocatable. */                                                 \
   V(Relocatable*, relocatable_top, NULL)                                       \
   V(DebugObjectCache*, string_stream_debug_object_cache, NULL)                 \
   V(Object*, string_stream_current_security_token, NULL)                       \
   V(ExternalReferenceTable*, external_reference_table, NULL)                   \
+  /* Null-terminated array of embedder addresses for the snapshot. */          \
+  V(intptr_t*, api_external_references, NULL)                                  \
   V(HashMap*, external_reference_map, NULL)                                    \
   V(HashMap*, root_index_map, NULL)                                            \
   V(int, pending_microtask_count, 0)                                           \
@@ -418,6 +418,7 @@ typedef List<HeapObject*> DebugObjectCache;
   V(uint32_t, per_isolate_assert_data, 0xFFFFFFFFu)                            \
   V(PromiseRejectCallback, promise_reject_callback, NULL)                      \
   V(const v8::StartupData*, snapshot_blob, NULL)                               \
+  V(bool, snapshot_blob_outlives_isolate, false)                               \
   ISOLATE_INIT_SIMULATOR_LIST(V)
 
 #define THREAD_LOCAL_TOP_ACCESSOR(type, name)                        \
@@ -969,6 +970,14 @@ class Isolate {
     date_cache_ = date_cache;
   }
 
+#ifdef V8_I18N_SUPPORT
+  // Created on first use.
+  ICUObjectCache* icu_object_cache();
+#endif  // V8_I18N_SUPPORT
+
+  // Drops cached ICU objects, which are recreated on demand.
+  void ClearICUObjectCache();
+
   Map* get_initial_js_array_map(ElementsKind kind);
 
   static const int kArrayProtectorValid = 1;
@@ -1305,6 +1314,7 @@ class Isolate {
       regexp_macro_assembler_canonicalize_;
   RegExpStack* regexp_stack_;
   DateCache* date_cache_;
+  ICUObjectCache* icu_object_cache_;
   CallInterfaceDescriptorData* call_descriptor_data_;
   base::RandomNumberGenerator* random_number_generator_;
   RAILMode rail_mode_;
@@ -1413,6 +1423,7 @@ class Isolate {
   friend class ThreadId;
   friend class v8::Isolate;
   friend class v8::Locker;
+  friend class v8::SnapshotCreator;
   friend class v8::Unlocker;
   friend v8::StartupData v8::V8::CreateSnapshotDataBlob(const char*);
   friend v8::StartupData v8::V8::WarmUpSnapshotDataBlob(v8::StartupData,
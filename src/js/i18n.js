@@ -895,22 +895,16 @@ var resolvedAccessor = {
 };
 
 /**
- * Initializes the given object so it's a valid Collator instance.
- * Useful for subclassing.
+ * Resolves the locale and options of a collator. Fills in the options for
+ * the ICU collator and returns the locale to create it for.
  */
-function initializeCollator(collator, locales, options) {
-  if (%IsInitializedIntlObject(collator)) {
-    throw MakeTypeError(kReinitializeIntl, "Collator");
-  }
-
+function resolveCollator(locales, options, internalOptions) {
   if (IS_UNDEFINED(options)) {
     options = {};
   }
 
   var getOption = getGetOption(options, 'collator');
 
-  var internalOptions = {};
-
   defineWEProperty(internalOptions, 'usage', getOption(
     'usage', 'string', ['sort', 'search'], 'sort'));
 
@@ -968,7 +962,21 @@ function initializeCollator(collator, locales, options) {
   }
   defineWEProperty(internalOptions, 'collation', collation);
 
-  var requestedLocale = locale.locale + extension;
+  return locale.locale + extension;
+}
+
+
+/**
+ * Initializes the given object so it's a valid Collator instance.
+ * Useful for subclassing.
+ */
+function initializeCollator(collator, locales, options) {
+  if (%IsInitializedIntlObject(collator)) {
+    throw MakeTypeError(kReinitializeIntl, "Collator");
+  }
+
+  var internalOptions = {};
+  var requestedLocale = resolveCollator(locales, options, internalOptions);
 
   // We define all properties C++ code may produce, to prevent security
   // problems. If malicious user decides to redefine Object.prototype.locale
@@ -1123,14 +1131,10 @@ var patternAccessor = {
 };
 
 /**
- * Initializes the given object so it's a valid NumberFormat instance.
- * Useful for subclassing.
+ * Resolves the locale and options of a number format. Fills in the options
+ * for the ICU formatter and returns the locale to create it for.
  */
-function initializeNumberFormat(numberFormat, locales, options) {
-  if (%IsInitializedIntlObject(numberFormat)) {
-    throw MakeTypeError(kReinitializeIntl, "NumberFormat");
-  }
-
+function resolveNumberFormat(locales, options, internalOptions) {
   if (IS_UNDEFINED(options)) {
     options = {};
   }
@@ -1139,7 +1143,6 @@ function initializeNumberFormat(numberFormat, locales, options) {
 
   var locale = resolveLocale('numberformat', locales, options);
 
-  var internalOptions = {};
   defineWEProperty(internalOptions, 'style', getOption(
     'style', 'string', ['decimal', 'percent', 'currency'], 'decimal'));
 
@@ -1207,7 +1210,23 @@ function initializeNumberFormat(numberFormat, locales, options) {
   var extension = setOptions(options, extensionMap, NUMBER_FORMAT_KEY_MAP,
                              getOption, internalOptions);
 
-  var requestedLocale = locale.locale + extension;
+  return locale.locale + extension;
+}
+
+
+/**
+ * Initializes the given object so it's a valid NumberFormat instance.
+ * Useful for subclassing.
+ */
+function initializeNumberFormat(numberFormat, locales, options) {
+  if (%IsInitializedIntlObject(numberFormat)) {
+    throw MakeTypeError(kReinitializeIntl, "NumberFormat");
+  }
+
+  var internalOptions = {};
+  var requestedLocale =
+      resolveNumberFormat(locales, options, internalOptions);
+
   var resolved = %object_define_properties({}, {
     currency: {writable: true},
     currencyDisplay: {writable: true},
@@ -1232,7 +1251,7 @@ function initializeNumberFormat(numberFormat, locales, options) {
 
   if (internalOptions.style === 'currency') {
     %object_define_property(resolved, 'currencyDisplay',
-        {value: currencyDisplay, writable: true});
+        {value: internalOptions.currencyDisplay, writable: true});
   }
 
   %MarkAsInitializedIntlObjectOfType(numberFormat, 'numberformat', formatter);
@@ -1552,15 +1571,11 @@ function toDateTimeOptions(options, required, defaults) {
 
 
 /**
- * Initializes the given object so it's a valid DateTimeFormat instance.
- * Useful for subclassing.
+ * Resolves the locale and options of a date format. Fills in the skeleton
+ * and time zone for the ICU formatter and returns the locale to create it
+ * for.
  */
-function initializeDateTimeFormat(dateFormat, locales, options) {
-
-  if (%IsInitializedIntlObject(dateFormat)) {
-    throw MakeTypeError(kReinitializeIntl, "DateTimeFormat");
-  }
-
+function resolveDateTimeFormat(locales, options, formatOptions) {
   if (IS_UNDEFINED(options)) {
     options = {};
   }
@@ -1601,7 +1616,28 @@ function initializeDateTimeFormat(dateFormat, locales, options) {
   var extension = setOptions(options, extensionMap, DATETIME_FORMAT_KEY_MAP,
                              getOption, internalOptions);
 
-  var requestedLocale = locale.locale + extension;
+  defineWEProperty(formatOptions, 'skeleton', ldmlString);
+  defineWEProperty(formatOptions, 'timeZone', tz);
+
+  return locale.locale + extension;
+}
+
+
+/**
+ * Initializes the given object so it's a valid DateTimeFormat instance.
+ * Useful for subclassing.
+ */
+function initializeDateTimeFormat(dateFormat, locales, options) {
+
+  if (%IsInitializedIntlObject(dateFormat)) {
+    throw MakeTypeError(kReinitializeIntl, "DateTimeFormat");
+  }
+
+  var formatOptions = {};
+  var requestedLocale =
+      resolveDateTimeFormat(locales, options, formatOptions);
+  var tz = formatOptions.timeZone;
+
   var resolved = %object_define_properties({}, {
     calendar: {writable: true},
     day: {writable: true},
@@ -1622,8 +1658,8 @@ function initializeDateTimeFormat(dateFormat, locales, options) {
     year: {writable: true}
   });
 
-  var formatter = %CreateDateTimeFormat(
-    requestedLocale, {skeleton: ldmlString, timeZone: tz}, resolved);
+  var formatter =
+      %CreateDateTimeFormat(requestedLocale, formatOptions, resolved);
 
   if (resolved.timeZone === "Etc/Unknown") {
     throw MakeRangeError(kUnsupportedTimeZone, tz);
@@ -2010,19 +2046,16 @@ function checkDateCacheCurrent() {
 }
 
 /**
- * Returns cached or newly created instance of a given service.
- * We cache only default instances (where no locales or options are provided).
+ * Returns the cached default instance (created with undefined locales and
+ * options) of a given service. Other locales and options are handled by the
+ * cache of ICU objects in C++, without creating an instance.
  */
-function cachedOrNewService(service, locales, options, defaults) {
-  var useOptions = (IS_UNDEFINED(defaults)) ? options : defaults;
-  if (IS_UNDEFINED(locales) && IS_UNDEFINED(options)) {
-    checkDateCacheCurrent();
-    if (IS_UNDEFINED(defaultObjects[service])) {
-      defaultObjects[service] = new savedObjects[service](locales, useOptions);
-    }
-    return defaultObjects[service];
+function defaultService(service, defaults) {
+  checkDateCacheCurrent();
+  if (IS_UNDEFINED(defaultObjects[service])) {
+    defaultObjects[service] = new savedObjects[service](UNDEFINED, defaults);
   }
-  return new savedObjects[service](locales, useOptions);
+  return defaultObjects[service];
 }
 
 function LocaleConvertCase(s, locales, isToUpper) {
@@ -2071,8 +2104,13 @@ OverrideFunction(GlobalString.prototype, 'localeCompare', function(that) {
 
     var locales = arguments[1];
     var options = arguments[2];
-    var collator = cachedOrNewService('collator', locales, options);
-    return compare(collator, this, that);
+    if (IS_UNDEFINED(locales) && IS_UNDEFINED(options)) {
+      return compare(defaultService('collator'), this, that);
+    }
+    var internalOptions = {};
+    var requestedLocale = resolveCollator(locales, options, internalOptions);
+    return %CachedCompare(requestedLocale, internalOptions,
+                          GlobalString(this), GlobalString(that));
   }
 );
 
@@ -2174,8 +2212,15 @@ OverrideFunction(GlobalNumber.prototype, 'toLocaleString', function() {
 
     var locales = arguments[0];
     var options = arguments[1];
-    var numberFormat = cachedOrNewService('numberformat', locales, options);
-    return formatNumber(numberFormat, this);
+    if (IS_UNDEFINED(locales) && IS_UNDEFINED(options)) {
+      return formatNumber(defaultService('numberformat'), this);
+    }
+    var internalOptions = {};
+    var requestedLocale =
+        resolveNumberFormat(locales, options, internalOptions);
+    // Spec treats -0 and +0 as 0.
+    return %CachedNumberFormat(requestedLocale, internalOptions,
+                               TO_NUMBER(this) + 0);
   }
 );
 
@@ -2192,10 +2237,15 @@ function toLocaleDateTime(date, locales, options, required, defaults, service) {
 
   var internalOptions = toDateTimeOptions(options, required, defaults);
 
-  var dateFormat =
-      cachedOrNewService(service, locales, options, internalOptions);
+  if (IS_UNDEFINED(locales) && IS_UNDEFINED(options)) {
+    return formatDate(defaultService(service, internalOptions), date);
+  }
+
+  var formatOptions = {};
+  var requestedLocale =
+      resolveDateTimeFormat(locales, internalOptions, formatOptions);
 
-  return formatDate(dateFormat, date);
+  return %CachedDateFormat(requestedLocale, formatOptions, date);
 }
 
 
@@ -18,6 +18,35 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// The only whitespace characters allowed between JSON tokens are tab,
+// carriage-return, newline and space.
+inline bool IsJsonWhitespace(uc32 c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Returns the index of the first non-whitespace character in
+// chars[start, end), or end if there is none. Runs of spaces, the usual
+// indentation of pretty-printed JSON, are skipped a machine word at a time.
+int FindJsonNonWhitespaceChar(const uint8_t* chars, int start, int end) {
+  const uintptr_t kSpaces = kOneInEveryByte * ' ';
+  int pos = start;
+  while (pos < end) {
+    if (end - pos >= kIntptrSize &&
+        ReadUnalignedValue<uintptr_t>(chars + pos) == kSpaces) {
+      pos += kIntptrSize;
+    } else if (IsJsonWhitespace(chars[pos])) {
+      pos++;
+    } else {
+      break;
+    }
+  }
+  return pos;
+}
+
+}  // namespace
+
 template <bool seq_one_byte>
 JsonParser<seq_one_byte>::JsonParser(Handle<String> source)
     : source_(source),
@@ -27,6 +56,7 @@ JsonParser<seq_one_byte>::JsonParser(Handle<String> source)
       zone_(isolate_->allocator()),
       object_constructor_(isolate_->native_context()->object_function(),
                           isolate_),
+      object_depth_(0),
       position_(-1) {
   source_ = String::Flatten(source_);
   pretenure_ = (source_length_ >= kPretenureTreshold) ? TENURED : NOT_TENURED;
@@ -34,6 +64,16 @@ JsonParser<seq_one_byte>::JsonParser(Handle<String> source)
   // Optimized fast case where we only have Latin1 characters.
   if (seq_one_byte) {
     seq_source_ = Handle<SeqOneByteString>::cast(source_);
+    // Shape feedback is kept on the native context across calls, until the
+    // next mark-compact clears it.
+    Handle<Context> native_context = isolate_->native_context();
+    if (native_context->json_parse_feedback()->IsFixedArray()) {
+      feedback_paths_ = handle(
+          FixedArray::cast(native_context->json_parse_feedback()), isolate_);
+    } else {
+      feedback_paths_ = factory_->NewFixedArray(kMaxFeedbackDepth, TENURED);
+      native_context->set_json_parse_feedback(*feedback_paths_);
+    }
   }
 }
 
@@ -104,16 +144,21 @@ void JsonParser<seq_one_byte>::Advance() {
 
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::AdvanceSkipWhitespace() {
-  do {
-    Advance();
-  } while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r');
+  Advance();
+  SkipWhitespace();
 }
 
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::SkipWhitespace() {
-  while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r') {
+  if (seq_one_byte) {
+    if (!IsJsonWhitespace(c0_)) return;
+    position_ = FindJsonNonWhitespaceChar(seq_source_->GetChars(),
+                                          position_ + 1, source_length_) -
+                1;
     Advance();
+    return;
   }
+  while (IsJsonWhitespace(c0_)) Advance();
 }
 
 template <bool seq_one_byte>
@@ -249,6 +294,9 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
   int descriptor = 0;
   ZoneList<Handle<Object> > properties(8, zone());
   DCHECK_EQ(c0_, '{');
+  // A failed parse is abandoned as a whole, so the depth only needs to be
+  // restored on success.
+  int depth = object_depth_++;
 
   bool transitioning = true;
 
@@ -278,18 +326,29 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       // Try to follow existing transitions as long as possible. Once we stop
       // transitioning, no transition can be found anymore.
       DCHECK(transitioning);
-      // First check whether there is a single expected transition. If so, try
-      // to parse it first.
+      // First check whether the previous object at this depth or a single
+      // expected transition predicts the key. If so, try to parse it first.
       bool follow_expected = false;
       Handle<Map> target;
       if (seq_one_byte) {
-        key = TransitionArray::ExpectedTransitionKey(map);
-        follow_expected = !key.is_null() && ParseJsonString(key);
+        Map* expected = ExpectedMapOnFeedbackPath(depth, map, descriptor);
+        if (expected != nullptr) {
+          key = handle(
+              String::cast(expected->instance_descriptors()->GetKey(descriptor)),
+              isolate());
+          follow_expected = ParseJsonString(key);
+          if (follow_expected) target = handle(expected, isolate());
+        }
+        if (!follow_expected) {
+          key = TransitionArray::ExpectedTransitionKey(map);
+          follow_expected = !key.is_null() && ParseJsonString(key);
+          // If the expected transition hits, follow it.
+          if (follow_expected) {
+            target = TransitionArray::ExpectedTransitionTarget(map);
+          }
+        }
       }
-      // If the expected transition hits, follow it.
-      if (follow_expected) {
-        target = TransitionArray::ExpectedTransitionTarget(map);
-      } else {
+      if (!follow_expected) {
         // If the expected transition failed, parse an internalized string and
         // try to find a matching transition.
         key = ParseJsonInternalizedString();
@@ -344,6 +403,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
     // If we transitioned until the very end, transition the map now.
     if (transitioning) {
       CommitStateToJsonObject(json_object, map, &properties);
+      if (seq_one_byte) RecordFeedbackPath(depth, map);
     } else {
       while (MatchSkipWhiteSpace(',')) {
         HandleScope local_scope(isolate());
@@ -385,9 +445,61 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
     }
   }
   AdvanceSkipWhitespace();
+  object_depth_--;
   return scope.CloseAndEscape(json_object);
 }
 
+template <bool seq_one_byte>
+Map* JsonParser<seq_one_byte>::ExpectedMapOnFeedbackPath(int depth,
+                                                         Handle<Map> map,
+                                                         int descriptor) {
+  DisallowHeapAllocation no_gc;
+  if (depth >= kMaxFeedbackDepth) return nullptr;
+  Object* path = feedback_paths_->get(depth);
+  if (!path->IsFixedArray()) return nullptr;
+  if (descriptor >= FixedArray::cast(path)->length()) return nullptr;
+  Map* expected = Map::cast(FixedArray::cast(path)->get(descriptor));
+  // Only follow the path while the object is still on it.
+  if (expected->GetBackPointer() != *map) return nullptr;
+  if (expected->is_deprecated()) return nullptr;
+  return expected;
+}
+
+template <bool seq_one_byte>
+void JsonParser<seq_one_byte>::RecordFeedbackPath(int depth, Handle<Map> map) {
+  if (depth >= kMaxFeedbackDepth) return;
+  int length = map->NumberOfOwnDescriptors();
+  Object* previous = feedback_paths_->get(depth);
+  if (previous->IsFixedArray() &&
+      FixedArray::cast(previous)->length() == length &&
+      (length == 0 || FixedArray::cast(previous)->get(length - 1) == *map)) {
+    return;
+  }
+  if (length == 0) {
+    feedback_paths_->set_undefined(depth);
+    return;
+  }
+  Handle<FixedArray> path = factory()->NewFixedArray(length, TENURED);
+  DisallowHeapAllocation no_gc;
+  Map* current = *map;
+  for (int i = length - 1; i >= 0; i--) {
+    // Every step of the path has to add exactly one data field with default
+    // attributes and a string key.
+    Object* back_pointer = current->GetBackPointer();
+    if (current->NumberOfOwnDescriptors() != i + 1 ||
+        current->GetLastDescriptorDetails().type() != DATA ||
+        current->GetLastDescriptorDetails().attributes() != NONE ||
+        !current->instance_descriptors()->GetKey(i)->IsString() ||
+        !back_pointer->IsMap()) {
+      feedback_paths_->set_undefined(depth);
+      return;
+    }
+    path->set(i, current);
+    current = Map::cast(back_pointer);
+  }
+  feedback_paths_->set(depth, *path);
+}
+
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::CommitStateToJsonObject(
     Handle<JSObject> json_object, Handle<Map> map,
@@ -554,8 +666,21 @@ Handle<String> JsonParser<seq_one_byte>::SlowScanJsonString(
       // Latin1 characters, there's no need to test whether we can store the
       // character. Otherwise check whether the UC16 source character can fit
       // in the Latin1 sink.
-      if (sizeof(SinkChar) == kUC16Size || seq_one_byte ||
-          c0_ <= String::kMaxOneByteCharCode) {
+      if (seq_one_byte) {
+        // Copy the whole run of unescaped characters, bounded by the space
+        // left in seq_string, in one go.
+        const uint8_t* chars = seq_source_->GetChars();
+        int run_end = FindJsonStringSpecialChar(
+            chars, position_, Min(source_length_, position_ + length - count));
+        int run_length = run_end - position_;
+        DCHECK_LT(0, run_length);
+        CopyChars(seq_string->GetChars() + count, chars + position_,
+                  run_length);
+        count += run_length;
+        position_ = run_end - 1;
+        Advance();
+      } else if (sizeof(SinkChar) == kUC16Size ||
+                 c0_ <= String::kMaxOneByteCharCode) {
         SeqStringSet(seq_string, count++, c0_);
         Advance();
       } else {
@@ -637,24 +762,25 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
     // Fast path for existing internalized strings.  If the the string being
     // parsed is not a known internalized string, contains backslashes or
     // unexpectedly reaches the end of string, return with an empty handle.
+    const uint8_t* chars = seq_source_->GetChars();
+    int position =
+        FindJsonStringSpecialChar(chars, position_, source_length_);
+    if (position >= source_length_) return Handle<String>::null();
+    uc32 c0 = chars[position];
+    if (c0 == '\\') {
+      c0_ = c0;
+      int beg_pos = position_;
+      position_ = position;
+      return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
+                                                           position_);
+    }
+    if (c0 < 0x20) return Handle<String>::null();
+    DCHECK_EQ('"', c0);
     uint32_t running_hash = isolate()->heap()->HashSeed();
-    int position = position_;
-    uc32 c0 = c0_;
-    do {
-      if (c0 == '\\') {
-        c0_ = c0;
-        int beg_pos = position_;
-        position_ = position;
-        return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
-                                                             position_);
-      }
-      if (c0 < 0x20) return Handle<String>::null();
-      running_hash = StringHasher::AddCharacterCore(running_hash,
-                                                    static_cast<uint16_t>(c0));
-      position++;
-      if (position >= source_length_) return Handle<String>::null();
-      c0 = seq_source_->SeqOneByteStringGet(position);
-    } while (c0 != '"');
+    for (int i = position_; i < position; i++) {
+      running_hash = StringHasher::AddCharacterCore(
+          running_hash, static_cast<uint16_t>(chars[i]));
+    }
     int length = position - position_;
     uint32_t hash = (length <= String::kMaxHashCalcLength)
                         ? StringHasher::GetHashCore(running_hash)
@@ -694,8 +820,15 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
   }
 
   int beg_pos = position_;
+  if (seq_one_byte) {
+    // Skip ahead to the closing quote, a backslash or a control character.
+    position_ = FindJsonStringSpecialChar(seq_source_->GetChars(), position_,
+                                          source_length_) -
+                1;
+    Advance();
+  }
   // Fast case for Latin1 only without escape characters.
-  do {
+  while (c0_ != '"') {
     // Check for control character (0x00-0x1f) or unterminated string (<0).
     if (c0_ < 0x20) return Handle<String>::null();
     if (c0_ != '\\') {
@@ -709,7 +842,7 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
       return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
                                                            position_);
     }
-  } while (c0_ != '"');
+  }
   int length = position_ - beg_pos;
   Handle<String> result =
       factory()->NewRawOneByteString(length, pretenure_).ToHandleChecked();
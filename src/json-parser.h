@@ -120,6 +120,19 @@ class JsonParser BASE_EMBEDDED {
   void CommitStateToJsonObject(Handle<JSObject> json_object, Handle<Map> map,
                                ZoneList<Handle<Object> >* properties);
 
+  // Objects at the same nesting depth (e.g. the elements of an array of
+  // records) usually share their shape. For each depth we remember the
+  // transition path, i.e. the maps with one, two, ... own descriptors, that
+  // led to the map of the last fully transitioned object. The next object at
+  // that depth compares its keys byte-wise against the keys along this path
+  // and follows it without hashing or transition lookups. The paths live on
+  // the native context, so that repeated parses of the same kind of payload
+  // start out with them.
+  Map* ExpectedMapOnFeedbackPath(int depth, Handle<Map> map, int descriptor);
+  void RecordFeedbackPath(int depth, Handle<Map> map);
+
+  static const int kMaxFeedbackDepth = 16;
+
   Handle<String> source_;
   int source_length_;
   Handle<SeqOneByteString> seq_source_;
@@ -129,6 +142,8 @@ class JsonParser BASE_EMBEDDED {
   Factory* factory_;
   Zone zone_;
   Handle<JSFunction> object_constructor_;
+  Handle<FixedArray> feedback_paths_;
+  int object_depth_;
   uc32 c0_;
   int position_;
 };
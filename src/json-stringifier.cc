@@ -8,6 +8,7 @@
 #include "src/lookup.h"
 #include "src/messages.h"
 #include "src/objects-inl.h"
+#include "src/prototype.h"
 #include "src/utils.h"
 
 namespace v8 {
@@ -84,6 +85,7 @@ const char* const JsonStringifier::JsonEscapeTable =
 JsonStringifier::JsonStringifier(Isolate* isolate)
     : isolate_(isolate), builder_(isolate), gap_(nullptr), indent_(0) {
   tojson_string_ = factory()->toJSON_string();
+  no_tojson_cache_ = factory()->NewFixedArray(kNoToJsonCacheSize * 2);
   stack_ = factory()->NewJSArray(8);
 }
 
@@ -194,11 +196,16 @@ bool JsonStringifier::InitializeGap(Handle<Object> gap) {
 MaybeHandle<Object> JsonStringifier::ApplyToJsonFunction(Handle<Object> object,
                                                          Handle<Object> key) {
   HandleScope scope(isolate_);
+  Handle<JSReceiver> receiver = Handle<JSReceiver>::cast(object);
+  if (IsKnownToHaveNoToJson(receiver)) return object;
   LookupIterator it(object, tojson_string_,
                     LookupIterator::PROTOTYPE_CHAIN_SKIP_INTERCEPTOR);
   Handle<Object> fun;
   ASSIGN_RETURN_ON_EXCEPTION(isolate_, fun, Object::GetProperty(&it), Object);
-  if (!fun->IsCallable()) return object;
+  if (!fun->IsCallable()) {
+    if (it.state() == LookupIterator::NOT_FOUND) RecordHasNoToJson(receiver);
+    return object;
+  }
 
   // Call toJSON function.
   if (key->IsSmi()) key = factory()->NumberToString(key);
@@ -209,6 +216,47 @@ MaybeHandle<Object> JsonStringifier::ApplyToJsonFunction(Handle<Object> object,
   return scope.CloseAndEscape(object);
 }
 
+int JsonStringifier::ToJsonCacheIndex(Map* map) {
+  return (ComputePointerHash(map) & (kNoToJsonCacheSize - 1)) * 2;
+}
+
+bool JsonStringifier::IsKnownToHaveNoToJson(Handle<JSReceiver> object) {
+  DisallowHeapAllocation no_gc;
+  Map* map = object->map();
+  int index = ToJsonCacheIndex(map);
+  if (no_tojson_cache_->get(index) != map) return false;
+  Cell* validity_cell = Cell::cast(no_tojson_cache_->get(index + 1));
+  return validity_cell->value() == Smi::FromInt(Map::kPrototypeChainValid);
+}
+
+void JsonStringifier::RecordHasNoToJson(Handle<JSReceiver> object) {
+  Handle<Map> map(object->map(), isolate_);
+  // The absence of toJSON is only stable while neither the receiver nor any
+  // of its prototypes can gain the property without a map change.
+  if (!object->IsJSObject() || map->is_dictionary_map() ||
+      map->has_named_interceptor() || map->is_access_check_needed()) {
+    return;
+  }
+  {
+    DisallowHeapAllocation no_gc;
+    for (PrototypeIterator iter(*map); !iter.IsAtEnd(); iter.Advance()) {
+      if (!iter.GetCurrent()->IsJSObject()) return;
+      Map* prototype_map = iter.GetCurrent<JSObject>()->map();
+      if (prototype_map->is_dictionary_map() ||
+          prototype_map->has_named_interceptor() ||
+          prototype_map->is_access_check_needed()) {
+        return;
+      }
+    }
+  }
+  Handle<Cell> validity_cell =
+      Map::GetOrCreatePrototypeChainValidityCell(map, isolate_);
+  if (validity_cell.is_null()) return;
+  int index = ToJsonCacheIndex(*map);
+  no_tojson_cache_->set(index, *map);
+  no_tojson_cache_->set(index + 1, *validity_cell);
+}
+
 MaybeHandle<Object> JsonStringifier::ApplyReplacerFunction(
     Handle<Object> object, Handle<Object> key) {
   HandleScope scope(isolate_);
@@ -611,6 +659,22 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
 
+  if (sizeof(SrcChar) == 1) {
+    // Copy runs of characters that need no escaping in bulk.
+    const uint8_t* chars = reinterpret_cast<const uint8_t*>(src.start());
+    int length = src.length();
+    int i = 0;
+    while (i < length) {
+      int run_end = FindJsonStringSpecialChar(chars, i, length);
+      dest->AppendChars(chars + i, run_end - i);
+      if (run_end == length) break;
+      dest->AppendCString(
+          &JsonEscapeTable[chars[run_end] * kJsonEscapeTableEntrySize]);
+      i = run_end + 1;
+    }
+    return;
+  }
+
   for (int i = 0; i < src.length(); i++) {
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
@@ -653,12 +717,12 @@ void JsonStringifier::SerializeString_(Handle<String> string) {
 
 template <>
 bool JsonStringifier::DoNotEscape(uint8_t c) {
-  return c >= '#' && c <= '~' && c != '\\';
+  return !IsJsonStringSpecialChar(c);
 }
 
 template <>
 bool JsonStringifier::DoNotEscape(uint16_t c) {
-  return c >= '#' && c != '\\' && c != 0x7f;
+  return !IsJsonStringSpecialChar(c);
 }
 
 void JsonStringifier::NewLine() {
@@ -30,6 +30,13 @@ class JsonStringifier BASE_EMBEDDED {
   MUST_USE_RESULT MaybeHandle<Object> ApplyToJsonFunction(
       Handle<Object> object,
       Handle<Object> key);
+
+  // Receivers whose map and prototype chain are known not to have a toJSON
+  // property are recorded in a small cache keyed by map, together with the
+  // prototype chain validity cell that guards the absence on the prototypes.
+  bool IsKnownToHaveNoToJson(Handle<JSReceiver> object);
+  void RecordHasNoToJson(Handle<JSReceiver> object);
+  static int ToJsonCacheIndex(Map* map);
   MUST_USE_RESULT MaybeHandle<Object> ApplyReplacerFunction(
       Handle<Object> object, Handle<Object> key);
 
@@ -109,12 +116,14 @@ class JsonStringifier BASE_EMBEDDED {
   Isolate* isolate_;
   IncrementalStringBuilder builder_;
   Handle<String> tojson_string_;
+  Handle<FixedArray> no_tojson_cache_;
   Handle<JSArray> stack_;
   Handle<FixedArray> property_list_;
   Handle<JSReceiver> replacer_function_;
   uc16* gap_;
   int indent_;
 
+  static const int kNoToJsonCacheSize = 8;
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
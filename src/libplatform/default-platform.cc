@@ -17,8 +17,9 @@ namespace v8 {
 namespace platform {
 
 
-v8::Platform* CreateDefaultPlatform(int thread_pool_size) {
-  DefaultPlatform* platform = new DefaultPlatform();
+v8::Platform* CreateDefaultPlatform(int thread_pool_size,
+                                    IdleTaskSupport idle_task_support) {
+  DefaultPlatform* platform = new DefaultPlatform(idle_task_support);
   platform->SetThreadPoolSize(thread_pool_size);
   platform->EnsureInitialized();
   return platform;
@@ -29,16 +30,36 @@ bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate) {
   return reinterpret_cast<DefaultPlatform*>(platform)->PumpMessageLoop(isolate);
 }
 
+void RunIdleTasks(v8::Platform* platform, v8::Isolate* isolate,
+                  double idle_time_in_seconds) {
+  reinterpret_cast<DefaultPlatform*>(platform)->RunIdleTasks(
+      isolate, idle_time_in_seconds);
+}
+
+void SetTracingController(
+    v8::Platform* platform,
+    v8::platform::tracing::TracingController* tracing_controller) {
+  reinterpret_cast<DefaultPlatform*>(platform)->SetTracingController(
+      tracing_controller);
+}
+
+void GetBackgroundTaskStats(v8::Platform* platform,
+                            BackgroundTaskStats* stats) {
+  reinterpret_cast<DefaultPlatform*>(platform)->GetBackgroundTaskStats(stats);
+}
+
 const int DefaultPlatform::kMaxThreadPoolSize = 8;
 
-DefaultPlatform::DefaultPlatform()
-    : initialized_(false), thread_pool_size_(0) {}
+DefaultPlatform::DefaultPlatform(IdleTaskSupport idle_task_support)
+    : initialized_(false),
+      thread_pool_size_(0),
+      idle_task_support_(idle_task_support) {}
 
 
 DefaultPlatform::~DefaultPlatform() {
   base::LockGuard<base::Mutex> guard(&lock_);
-  queue_.Terminate();
   if (initialized_) {
+    queue_->Terminate();
     for (auto i = thread_pool_.begin(); i != thread_pool_.end(); ++i) {
       delete *i;
     }
@@ -57,6 +78,13 @@ DefaultPlatform::~DefaultPlatform() {
       i->second.pop();
     }
   }
+  for (auto i = main_thread_idle_queue_.begin();
+       i != main_thread_idle_queue_.end(); ++i) {
+    while (!i->second.empty()) {
+      delete i->second.front();
+      i->second.pop();
+    }
+  }
 }
 
 
@@ -76,8 +104,15 @@ void DefaultPlatform::EnsureInitialized() {
   if (initialized_) return;
   initialized_ = true;
 
+  queue_.reset(new TaskQueue(std::max(thread_pool_size_, 1)));
   for (int i = 0; i < thread_pool_size_; ++i)
-    thread_pool_.push_back(new WorkerThread(&queue_));
+    thread_pool_.push_back(new WorkerThread(queue_.get(), i));
+}
+
+
+void DefaultPlatform::GetBackgroundTaskStats(BackgroundTaskStats* stats) {
+  EnsureInitialized();
+  queue_->GetStats(stats);
 }
 
 
@@ -107,6 +142,17 @@ Task* DefaultPlatform::PopTaskInMainThreadDelayedQueue(v8::Isolate* isolate) {
 }
 
 
+IdleTask* DefaultPlatform::PopTaskInMainThreadIdleQueue(v8::Isolate* isolate) {
+  auto it = main_thread_idle_queue_.find(isolate);
+  if (it == main_thread_idle_queue_.end() || it->second.empty()) {
+    return NULL;
+  }
+  IdleTask* task = it->second.front();
+  it->second.pop();
+  return task;
+}
+
+
 bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate) {
   Task* task = NULL;
   {
@@ -131,10 +177,46 @@ bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate) {
 }
 
 
+void DefaultPlatform::RunIdleTasks(v8::Isolate* isolate,
+                                   double idle_time_in_seconds) {
+  DCHECK(IdleTaskSupport::kEnabled == idle_task_support_);
+  double deadline_in_seconds =
+      MonotonicallyIncreasingTime() + idle_time_in_seconds;
+  // Idle tasks posted by other idle tasks run in the same idle period if
+  // there is time left.
+  while (deadline_in_seconds > MonotonicallyIncreasingTime()) {
+    IdleTask* task;
+    {
+      base::LockGuard<base::Mutex> guard(&lock_);
+      task = PopTaskInMainThreadIdleQueue(isolate);
+    }
+    if (task == NULL) return;
+    task->Run(deadline_in_seconds);
+    delete task;
+  }
+}
+
+
 void DefaultPlatform::CallOnBackgroundThread(Task *task,
                                              ExpectedRuntime expected_runtime) {
   EnsureInitialized();
-  queue_.Append(task);
+  queue_->Append(task);
+}
+
+
+void DefaultPlatform::CallPrioritizedOnBackgroundThread(
+    Isolate* isolate, Task* task, TaskPriority priority) {
+  EnsureInitialized();
+  queue_->Append(task, priority, isolate);
+}
+
+
+void DefaultPlatform::CallDelayedOnBackgroundThread(Isolate* isolate,
+                                                    Task* task,
+                                                    double delay_in_seconds) {
+  EnsureInitialized();
+  queue_->AppendDelayed(task, delay_in_seconds, Platform::kUserVisibleTask,
+                        isolate);
 }
 
 
@@ -155,11 +237,15 @@ void DefaultPlatform::CallDelayedOnForegroundThread(Isolate* isolate,
 
 void DefaultPlatform::CallIdleOnForegroundThread(Isolate* isolate,
                                                  IdleTask* task) {
-  UNREACHABLE();
+  DCHECK(IdleTaskSupport::kEnabled == idle_task_support_);
+  base::LockGuard<base::Mutex> guard(&lock_);
+  main_thread_idle_queue_[isolate].push(task);
 }
 
 
-bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) { return false; }
+bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) {
+  return idle_task_support_ == IdleTaskSupport::kEnabled;
+}
 
 
 double DefaultPlatform::MonotonicallyIncreasingTime() {
@@ -173,15 +259,28 @@ uint64_t DefaultPlatform::AddTraceEvent(
     const char* scope, uint64_t id, uint64_t bind_id, int num_args,
     const char** arg_names, const uint8_t* arg_types,
     const uint64_t* arg_values, unsigned int flags) {
+  if (tracing_controller_) {
+    return tracing_controller_->AddTraceEvent(
+        phase, category_enabled_flag, name, scope, id, bind_id, num_args,
+        arg_names, arg_types, arg_values, flags);
+  }
   return 0;
 }
 
 
 void DefaultPlatform::UpdateTraceEventDuration(
-    const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {}
+    const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {
+  if (tracing_controller_) {
+    tracing_controller_->UpdateTraceEventDuration(category_enabled_flag, name,
+                                                  handle);
+  }
+}
 
 
 const uint8_t* DefaultPlatform::GetCategoryGroupEnabled(const char* name) {
+  if (tracing_controller_) {
+    return tracing_controller_->GetCategoryGroupEnabled(name);
+  }
   static uint8_t no = 0;
   return &no;
 }
@@ -190,10 +289,20 @@ const uint8_t* DefaultPlatform::GetCategoryGroupEnabled(const char* name) {
 const char* DefaultPlatform::GetCategoryGroupName(
     const uint8_t* category_enabled_flag) {
   static const char dummy[] = "dummy";
+  if (tracing_controller_) {
+    return tracing::TracingController::GetCategoryGroupName(
+        category_enabled_flag);
+  }
   return dummy;
 }
 
 
+void DefaultPlatform::SetTracingController(
+    tracing::TracingController* tracing_controller) {
+  tracing_controller_.reset(tracing_controller);
+}
+
+
 size_t DefaultPlatform::NumberOfAvailableBackgroundThreads() {
   return static_cast<size_t>(thread_pool_size_);
 }
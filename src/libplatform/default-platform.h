@@ -7,9 +7,12 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <queue>
 #include <vector>
 
+#include "include/libplatform/libplatform.h"
+#include "include/libplatform/v8-tracing.h"
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
@@ -24,7 +27,8 @@ class WorkerThread;
 
 class DefaultPlatform : public Platform {
  public:
-  DefaultPlatform();
+  explicit DefaultPlatform(
+      IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled);
   virtual ~DefaultPlatform();
 
   void SetThreadPoolSize(int thread_pool_size);
@@ -33,10 +37,20 @@ class DefaultPlatform : public Platform {
 
   bool PumpMessageLoop(v8::Isolate* isolate);
 
+  void RunIdleTasks(v8::Isolate* isolate, double idle_time_in_seconds);
+
+  void SetTracingController(tracing::TracingController* tracing_controller);
+
+  void GetBackgroundTaskStats(BackgroundTaskStats* stats);
+
   // v8::Platform implementation.
   size_t NumberOfAvailableBackgroundThreads() override;
   void CallOnBackgroundThread(Task* task,
                               ExpectedRuntime expected_runtime) override;
+  void CallPrioritizedOnBackgroundThread(Isolate* isolate, Task* task,
+                                         TaskPriority priority) override;
+  void CallDelayedOnBackgroundThread(Isolate* isolate, Task* task,
+                                     double delay_in_seconds) override;
   void CallOnForegroundThread(v8::Isolate* isolate, Task* task) override;
   void CallDelayedOnForegroundThread(Isolate* isolate, Task* task,
                                      double delay_in_seconds) override;
@@ -61,12 +75,14 @@ class DefaultPlatform : public Platform {
 
   Task* PopTaskInMainThreadQueue(v8::Isolate* isolate);
   Task* PopTaskInMainThreadDelayedQueue(v8::Isolate* isolate);
+  IdleTask* PopTaskInMainThreadIdleQueue(v8::Isolate* isolate);
 
   base::Mutex lock_;
   bool initialized_;
   int thread_pool_size_;
+  IdleTaskSupport idle_task_support_;
   std::vector<WorkerThread*> thread_pool_;
-  TaskQueue queue_;
+  std::unique_ptr<TaskQueue> queue_;
   std::map<v8::Isolate*, std::queue<Task*> > main_thread_queue_;
 
   typedef std::pair<double, Task*> DelayedEntry;
@@ -74,6 +90,9 @@ class DefaultPlatform : public Platform {
            std::priority_queue<DelayedEntry, std::vector<DelayedEntry>,
                                std::greater<DelayedEntry> > >
       main_thread_delayed_queue_;
+  std::map<v8::Isolate*, std::queue<IdleTask*> > main_thread_idle_queue_;
+
+  std::unique_ptr<tracing::TracingController> tracing_controller_;
 
   DISALLOW_COPY_AND_ASSIGN(DefaultPlatform);
 };
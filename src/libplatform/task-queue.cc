@@ -4,54 +4,232 @@
 
 #include "src/libplatform/task-queue.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "src/base/logging.h"
 
 namespace v8 {
 namespace platform {
 
-TaskQueue::TaskQueue() : process_queue_semaphore_(0), terminated_(false) {}
+TaskQueue::Worker::Worker() : running_slot(-1), running_priority(-1) {
+  memset(&stats, 0, sizeof(stats));
+}
+
+
+TaskQueue::TaskQueue(int num_workers)
+    : process_queue_semaphore_(0),
+      max_running_best_effort_(std::max(num_workers - 1, 1)),
+      terminated_(false) {
+  DCHECK_LT(0, num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.push_back(std::unique_ptr<Worker>(new Worker()));
+  }
+}
 
 
 TaskQueue::~TaskQueue() {
-  base::LockGuard<base::Mutex> guard(&lock_);
-  DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+  DCHECK(terminated_.Value());
+  for (auto& worker : workers_) {
+    base::LockGuard<base::Mutex> guard(&worker->lock);
+    for (int i = 0; i < kNumPriorities; ++i) {
+      DCHECK(worker->lanes[i].empty());
+    }
+  }
+  base::LockGuard<base::Mutex> guard(&delayed_lock_);
+  while (!delayed_tasks_.empty()) {
+    delete delayed_tasks_.top().task;
+    delayed_tasks_.pop();
+  }
 }
 
 
 void TaskQueue::Append(Task* task) {
-  base::LockGuard<base::Mutex> guard(&lock_);
-  DCHECK(!terminated_);
-  task_queue_.push(task);
+  Append(task, Platform::kUserVisibleTask, NULL);
+}
+
+
+void TaskQueue::Append(Task* task, Platform::TaskPriority priority,
+                       Isolate* isolate) {
+  DCHECK(!terminated_.Value());
+  DCHECK(priority >= 0 && priority < kNumPriorities);
+  int index = next_worker_.Increment(1) % static_cast<int>(workers_.size());
+  if (index < 0) index += static_cast<int>(workers_.size());
+  Entry entry = {task, IsolateSlot(isolate), base::TimeTicks::Now()};
+  {
+    Worker* worker = workers_[index].get();
+    base::LockGuard<base::Mutex> guard(&worker->lock);
+    worker->lanes[priority].push_back(entry);
+  }
+  pending_[priority].Increment(1);
   process_queue_semaphore_.Signal();
 }
 
 
-Task* TaskQueue::GetNext() {
+void TaskQueue::AppendDelayed(Task* task, double delay_in_seconds,
+                              Platform::TaskPriority priority,
+                              Isolate* isolate) {
+  DCHECK(!terminated_.Value());
+  base::TimeTicks deadline =
+      base::TimeTicks::Now() +
+      base::TimeDelta::FromMicroseconds(static_cast<int64_t>(
+          delay_in_seconds * base::Time::kMicrosecondsPerSecond));
+  DelayedEntry entry = {deadline, task, priority, isolate};
+  {
+    base::LockGuard<base::Mutex> guard(&delayed_lock_);
+    delayed_tasks_.push(entry);
+  }
+  num_delayed_.Increment(1);
+  // Make a waiting worker pick up the new deadline.
+  process_queue_semaphore_.Signal();
+}
+
+
+Task* TaskQueue::GetNext(int worker_id) {
+  DCHECK(worker_id >= 0 && worker_id < static_cast<int>(workers_.size()));
+  FinishTask(worker_id);
   for (;;) {
-    {
-      base::LockGuard<base::Mutex> guard(&lock_);
-      if (!task_queue_.empty()) {
-        Task* result = task_queue_.front();
-        task_queue_.pop();
-        return result;
-      }
-      if (terminated_) {
-        process_queue_semaphore_.Signal();
-        return NULL;
-      }
+    base::TimeDelta next_delay;
+    bool has_delayed = num_delayed_.Value() > 0 && !terminated_.Value() &&
+                       PromoteDelayedTasks(&next_delay);
+    Entry entry;
+    int priority;
+    if (TryTake(worker_id, &entry, &priority)) return entry.task;
+    if (terminated_.Value()) {
+      process_queue_semaphore_.Signal();
+      return NULL;
+    }
+    if (has_delayed) {
+      // Wake up in time for the next delayed task.
+      USE(process_queue_semaphore_.WaitFor(next_delay));
+    } else {
+      process_queue_semaphore_.Wait();
     }
-    process_queue_semaphore_.Wait();
   }
 }
 
 
 void TaskQueue::Terminate() {
-  base::LockGuard<base::Mutex> guard(&lock_);
-  DCHECK(!terminated_);
-  terminated_ = true;
+  bool was_terminated = !terminated_.TrySetValue(false, true);
+  DCHECK(!was_terminated);
+  USE(was_terminated);
   process_queue_semaphore_.Signal();
 }
 
+
+void TaskQueue::GetStats(BackgroundTaskStats* stats) {
+  memset(stats, 0, sizeof(*stats));
+  for (auto& worker : workers_) {
+    base::LockGuard<base::Mutex> guard(&worker->lock);
+    for (int i = 0; i < kNumPriorities; ++i) {
+      stats->tasks_run[i] += worker->stats.tasks_run[i];
+      stats->total_queue_time_in_seconds[i] +=
+          worker->stats.total_queue_time_in_seconds[i];
+      stats->max_queue_time_in_seconds[i] =
+          std::max(stats->max_queue_time_in_seconds[i],
+                   worker->stats.max_queue_time_in_seconds[i]);
+    }
+    stats->tasks_stolen += worker->stats.tasks_stolen;
+  }
+}
+
+
+bool TaskQueue::PromoteDelayedTasks(base::TimeDelta* next_delay) {
+  base::LockGuard<base::Mutex> guard(&delayed_lock_);
+  base::TimeTicks now = base::TimeTicks::Now();
+  while (!delayed_tasks_.empty() && delayed_tasks_.top().deadline <= now) {
+    const DelayedEntry& entry = delayed_tasks_.top();
+    Append(entry.task, entry.priority, entry.isolate);
+    delayed_tasks_.pop();
+    num_delayed_.Increment(-1);
+  }
+  if (delayed_tasks_.empty()) return false;
+  *next_delay = delayed_tasks_.top().deadline - now;
+  return true;
+}
+
+
+int TaskQueue::IsolateSlot(Isolate* isolate) {
+  uintptr_t hash = reinterpret_cast<uintptr_t>(isolate);
+  hash ^= hash >> 12;
+  hash ^= hash >> 6;
+  return static_cast<int>(hash % kIsolateSlots);
+}
+
+
+bool TaskQueue::TryTake(int worker_id, Entry* entry, int* priority) {
+  int num_workers = static_cast<int>(workers_.size());
+  for (int i = 0; i < kNumPriorities; ++i) {
+    if (pending_[i].Value() <= 0) continue;
+    if (i == Platform::kBestEffortTask &&
+        running_best_effort_.Value() >= max_running_best_effort_) {
+      continue;
+    }
+    // Look at the worker's own deque first, then steal from the others.
+    for (int j = 0; j < num_workers; ++j) {
+      int victim = (worker_id + j) % num_workers;
+      if (TryTakeFrom(workers_[victim].get(), i, entry)) {
+        *priority = i;
+        StartTask(worker_id, *entry, i, j != 0);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+
+bool TaskQueue::TryTakeFrom(Worker* victim, int priority, Entry* entry) {
+  base::LockGuard<base::Mutex> guard(&victim->lock);
+  std::deque<Entry>& lane = victim->lanes[priority];
+  if (lane.empty()) return false;
+  auto best = lane.begin();
+  int best_running = running_per_isolate_[best->isolate_slot].Value();
+  auto end = lane.begin() + std::min<size_t>(lane.size(), kFairnessWindow);
+  for (auto it = best + 1; it != end && best_running > 0; ++it) {
+    int running = running_per_isolate_[it->isolate_slot].Value();
+    if (running < best_running) {
+      best = it;
+      best_running = running;
+    }
+  }
+  *entry = *best;
+  lane.erase(best);
+  pending_[priority].Increment(-1);
+  running_per_isolate_[entry->isolate_slot].Increment(1);
+  if (priority == Platform::kBestEffortTask) running_best_effort_.Increment(1);
+  return true;
+}
+
+
+void TaskQueue::StartTask(int worker_id, const Entry& entry, int priority,
+                          bool stolen) {
+  double queue_time = (base::TimeTicks::Now() - entry.append_time).InSecondsF();
+  Worker* worker = workers_[worker_id].get();
+  base::LockGuard<base::Mutex> guard(&worker->lock);
+  DCHECK_EQ(-1, worker->running_slot);
+  worker->running_slot = entry.isolate_slot;
+  worker->running_priority = priority;
+  BackgroundTaskStats& stats = worker->stats;
+  stats.tasks_run[priority]++;
+  stats.total_queue_time_in_seconds[priority] += queue_time;
+  stats.max_queue_time_in_seconds[priority] =
+      std::max(stats.max_queue_time_in_seconds[priority], queue_time);
+  if (stolen) stats.tasks_stolen++;
+}
+
+
+void TaskQueue::FinishTask(int worker_id) {
+  Worker* worker = workers_[worker_id].get();
+  base::LockGuard<base::Mutex> guard(&worker->lock);
+  if (worker->running_slot == -1) return;
+  running_per_isolate_[worker->running_slot].Increment(-1);
+  if (worker->running_priority == Platform::kBestEffortTask) {
+    running_best_effort_.Increment(-1);
+  }
+  worker->running_slot = -1;
+  worker->running_priority = -1;
+}
+
 }  // namespace platform
 }  // namespace v8
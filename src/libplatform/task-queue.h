@@ -5,38 +5,131 @@
 #ifndef V8_LIBPLATFORM_TASK_QUEUE_H_
 #define V8_LIBPLATFORM_TASK_QUEUE_H_
 
+#include <deque>
+#include <functional>
+#include <memory>
 #include <queue>
+#include <vector>
 
+#include "include/libplatform/libplatform.h"
+#include "include/v8-platform.h"
+#include "src/base/atomic-utils.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
 
 namespace v8 {
 
+class Isolate;
 class Task;
 
 namespace platform {
 
+// Queue of background tasks shared by a fixed number of workers. Every worker
+// owns a deque with one lane per task priority and takes tasks from the
+// deques of the other workers when its own has nothing of the highest
+// pending priority. Appended tasks are spread over the deques, so appending
+// and taking tasks rarely contend on the same lock.
 class TaskQueue {
  public:
-  TaskQueue();
+  static const int kNumPriorities = BackgroundTaskStats::kNumPriorities;
+
+  explicit TaskQueue(int num_workers = 1);
   ~TaskQueue();
 
-  // Appends a task to the queue. The queue takes ownership of |task|.
+  // Appends a user-visible task to the queue. The queue takes ownership of
+  // |task|.
   void Append(Task* task);
 
-  // Returns the next task to process. Blocks if no task is available. Returns
-  // NULL if the queue is terminated.
-  Task* GetNext();
+  // Appends a task for |isolate|, which may be NULL, with the given
+  // |priority|. The queue takes ownership of |task|.
+  void Append(Task* task, Platform::TaskPriority priority, Isolate* isolate);
+
+  // Appends a task that becomes available to the workers |delay_in_seconds|
+  // from now. Tasks that are not due when the queue is terminated are never
+  // run, and are deleted with the queue.
+  void AppendDelayed(Task* task, double delay_in_seconds,
+                     Platform::TaskPriority priority, Isolate* isolate);
+
+  // Returns the next task for worker |worker_id| to process, and considers
+  // the task it returned previously as finished. Tasks of higher priority go
+  // first, and among tasks of the same priority those of isolates with fewer
+  // running tasks are preferred. Best-effort tasks never occupy all workers.
+  // Blocks if no task is available. Returns NULL if the queue is terminated.
+  // A worker id must not be used by more than one thread at a time.
+  Task* GetNext(int worker_id = 0);
 
   // Terminate the queue.
   void Terminate();
 
+  void GetStats(BackgroundTaskStats* stats);
+
  private:
+  struct Entry {
+    Task* task;
+    int isolate_slot;
+    base::TimeTicks append_time;
+  };
+
+  struct DelayedEntry {
+    base::TimeTicks deadline;
+    Task* task;
+    Platform::TaskPriority priority;
+    Isolate* isolate;
+
+    bool operator>(const DelayedEntry& other) const {
+      return deadline > other.deadline;
+    }
+  };
+
+  struct Worker {
+    Worker();
+
+    base::Mutex lock;
+    std::deque<Entry> lanes[kNumPriorities];
+
+    // Isolate slot and priority of the task the worker runs, or -1.
+    int running_slot;
+    int running_priority;
+
+    BackgroundTaskStats stats;
+  };
+
+  // Running tasks are counted per isolate in a small table indexed by a hash
+  // of the isolate. Collisions only make the scheduling less fair.
+  static const int kIsolateSlots = 64;
+
+  // Number of tasks at the front of a lane that are considered when choosing
+  // the isolate with the fewest running tasks.
+  static const int kFairnessWindow = 8;
+
+  static int IsolateSlot(Isolate* isolate);
+
+  // Appends the delayed tasks that are due. Returns false if there are no
+  // delayed tasks left, and the time until the next one is due otherwise.
+  bool PromoteDelayedTasks(base::TimeDelta* next_delay);
+
+  bool TryTake(int worker_id, Entry* entry, int* priority);
+  bool TryTakeFrom(Worker* victim, int priority, Entry* entry);
+  void StartTask(int worker_id, const Entry& entry, int priority,
+                 bool stolen);
+  void FinishTask(int worker_id);
+
   base::Semaphore process_queue_semaphore_;
-  base::Mutex lock_;
-  std::queue<Task*> task_queue_;
-  bool terminated_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  int max_running_best_effort_;
+  base::AtomicNumber<int> next_worker_;
+  base::AtomicNumber<int> pending_[kNumPriorities];
+  base::AtomicNumber<int> running_per_isolate_[kIsolateSlots];
+  base::AtomicNumber<int> running_best_effort_;
+  base::AtomicValue<bool> terminated_;
+
+  base::Mutex delayed_lock_;
+  std::priority_queue<DelayedEntry, std::vector<DelayedEntry>,
+                      std::greater<DelayedEntry> >
+      delayed_tasks_;
+  base::AtomicNumber<int> num_delayed_;
 
   DISALLOW_COPY_AND_ASSIGN(TaskQueue);
 };
@@ -0,0 +1,191 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/tracing/trace-buffer.h"
+
+#include <limits>
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+class TraceBufferRingBuffer::WriterThread : public base::Thread {
+ public:
+  explicit WriterThread(TraceBufferRingBuffer* buffer)
+      : Thread(Options("V8 TraceWriter")), buffer_(buffer) {}
+
+  void Run() override { buffer_->WriteRetiredChunks(); }
+
+ private:
+  TraceBufferRingBuffer* buffer_;
+};
+
+TraceBufferRingBuffer::TraceBufferRingBuffer(size_t max_chunks,
+                                             TraceWriter* trace_writer)
+    : max_chunks_(max_chunks),
+      thread_chunk_key_(base::Thread::CreateThreadLocalKey()),
+      trace_writer_(trace_writer),
+      chunks_(max_chunks),
+      chunk_in_use_(max_chunks, false) {
+  // Handles keep the event's position in the lower 32 bits.
+  CHECK_GT(max_chunks, 0u);
+  CHECK_LE(max_chunks, std::numeric_limits<uint32_t>::max() /
+                           TraceBufferChunk::kChunkSize);
+  writer_thread_.reset(new WriterThread(this));
+  writer_thread_->Start();
+}
+
+TraceBufferRingBuffer::~TraceBufferRingBuffer() {
+  if (writer_thread_) {
+    {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      flushing_ = true;
+      chunk_retired_.NotifyOne();
+    }
+    writer_thread_->Join();
+  }
+  base::Thread::DeleteThreadLocalKey(thread_chunk_key_);
+}
+
+size_t TraceBufferRingBuffer::ThreadChunkIndex() const {
+  int value = base::Thread::GetThreadLocalInt(thread_chunk_key_);
+  return value == 0 ? kNoChunk : static_cast<size_t>(value - 1);
+}
+
+TraceObject* TraceBufferRingBuffer::AddTraceEvent(uint64_t* handle) {
+  size_t chunk_index = ThreadChunkIndex();
+  if (chunk_index == kNoChunk || chunks_[chunk_index]->IsFull()) {
+    chunk_index = SwapChunk(chunk_index);
+    base::Thread::SetThreadLocalInt(
+        thread_chunk_key_,
+        chunk_index == kNoChunk ? 0 : static_cast<int>(chunk_index + 1));
+    if (chunk_index == kNoChunk) return nullptr;
+  }
+  TraceBufferChunk* chunk = chunks_[chunk_index].get();
+  size_t event_index;
+  TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
+  *handle = MakeHandle(chunk_index, chunk->seq(), event_index);
+  return trace_object;
+}
+
+TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
+  size_t chunk_index, event_index;
+  uint32_t chunk_seq;
+  ExtractHandle(handle, &chunk_index, &chunk_seq, &event_index);
+  // Once the thread has moved on from the chunk, the writer thread may be
+  // reading it.
+  if (chunk_index != ThreadChunkIndex()) return nullptr;
+  TraceBufferChunk* chunk = chunks_[chunk_index].get();
+  if (chunk->seq() != chunk_seq || event_index >= chunk->size()) {
+    return nullptr;
+  }
+  return chunk->GetEventAt(event_index);
+}
+
+size_t TraceBufferRingBuffer::SwapChunk(size_t full_chunk_index) {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  if (flushing_) return kNoChunk;
+  if (full_chunk_index != kNoChunk) {
+    chunk_in_use_[full_chunk_index] = false;
+    retired_chunks_.push_back(full_chunk_index);
+    chunk_retired_.NotifyOne();
+  }
+  size_t chunk_index;
+  if (!free_chunks_.empty()) {
+    chunk_index = free_chunks_.back();
+    free_chunks_.pop_back();
+  } else if (num_allocated_chunks_ < max_chunks_) {
+    chunk_index = num_allocated_chunks_++;
+    chunks_[chunk_index].reset(new TraceBufferChunk(0));
+  } else if (!retired_chunks_.empty()) {
+    // The writer thread has fallen behind; drop the oldest retired chunk.
+    chunk_index = retired_chunks_.front();
+    retired_chunks_.pop_front();
+  } else {
+    return kNoChunk;
+  }
+  chunks_[chunk_index]->Reset(++current_chunk_seq_);
+  chunk_in_use_[chunk_index] = true;
+  return chunk_index;
+}
+
+void TraceBufferRingBuffer::WriteRetiredChunks() {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  while (true) {
+    while (retired_chunks_.empty() && !flushing_) chunk_retired_.Wait(&mutex_);
+    if (retired_chunks_.empty()) return;
+    size_t chunk_index = retired_chunks_.front();
+    retired_chunks_.pop_front();
+    // While the chunk is on neither list, no thread can recycle it.
+    mutex_.Unlock();
+    WriteChunk(chunks_[chunk_index].get());
+    mutex_.Lock();
+    free_chunks_.push_back(chunk_index);
+  }
+}
+
+void TraceBufferRingBuffer::WriteChunk(TraceBufferChunk* chunk) {
+  for (size_t i = 0; i < chunk->size(); ++i) {
+    trace_writer_->AppendTraceEvent(chunk->GetEventAt(i));
+  }
+}
+
+bool TraceBufferRingBuffer::Flush() {
+  if (!writer_thread_) return false;
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    flushing_ = true;
+    chunk_retired_.NotifyOne();
+  }
+  writer_thread_->Join();
+  writer_thread_.reset();
+  // All retired chunks have been written; add the ones still being filled.
+  for (size_t i = 0; i < max_chunks_; ++i) {
+    if (chunk_in_use_[i]) WriteChunk(chunks_[i].get());
+  }
+  trace_writer_->Flush();
+  trace_writer_.reset();
+  return true;
+}
+
+uint64_t TraceBufferRingBuffer::MakeHandle(size_t chunk_index,
+                                           uint32_t chunk_seq,
+                                           size_t event_index) const {
+  return static_cast<uint64_t>(chunk_seq) << 32 |
+         (chunk_index * TraceBufferChunk::kChunkSize + event_index);
+}
+
+void TraceBufferRingBuffer::ExtractHandle(uint64_t handle, size_t* chunk_index,
+                                          uint32_t* chunk_seq,
+                                          size_t* event_index) const {
+  *chunk_seq = static_cast<uint32_t>(handle >> 32);
+  uint32_t position = static_cast<uint32_t>(handle);
+  *chunk_index = position / TraceBufferChunk::kChunkSize;
+  *event_index = position % TraceBufferChunk::kChunkSize;
+}
+
+const size_t TraceBufferChunk::kChunkSize;
+
+TraceBufferChunk::TraceBufferChunk(uint32_t seq) : seq_(seq) {}
+
+void TraceBufferChunk::Reset(uint32_t new_seq) {
+  next_free_ = 0;
+  seq_ = new_seq;
+}
+
+TraceObject* TraceBufferChunk::AddTraceEvent(size_t* event_index) {
+  *event_index = next_free_++;
+  return &chunk_[*event_index];
+}
+
+TraceBuffer* TraceBuffer::CreateTraceBufferRingBuffer(
+    size_t max_chunks, TraceWriter* trace_writer) {
+  return new TraceBufferRingBuffer(max_chunks, trace_writer);
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
@@ -0,0 +1,77 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SRC_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
+#define SRC_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "include/libplatform/v8-tracing.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+// Every thread owns the chunk it is filling, found through a thread-local
+// slot, so adding an event takes no locks. The mutex is only taken to hand a
+// full chunk to the writer thread and to get an empty one in exchange.
+class TraceBufferRingBuffer : public TraceBuffer {
+ public:
+  TraceBufferRingBuffer(size_t max_chunks, TraceWriter* trace_writer);
+  ~TraceBufferRingBuffer();
+
+  TraceObject* AddTraceEvent(uint64_t* handle) override;
+  TraceObject* GetEventByHandle(uint64_t handle) override;
+  bool Flush() override;
+
+ private:
+  class WriterThread;
+
+  uint64_t MakeHandle(size_t chunk_index, uint32_t chunk_seq,
+                      size_t event_index) const;
+  void ExtractHandle(uint64_t handle, size_t* chunk_index, uint32_t* chunk_seq,
+                     size_t* event_index) const;
+
+  // Returns the index of the chunk the calling thread is filling, or
+  // kNoChunk.
+  size_t ThreadChunkIndex() const;
+
+  // Retires the calling thread's full chunk, if any, and hands out a new one.
+  // Returns kNoChunk if every chunk is in use.
+  size_t SwapChunk(size_t full_chunk_index);
+
+  // Body of the writer thread: writes retired chunks until Flush() is called.
+  void WriteRetiredChunks();
+  void WriteChunk(TraceBufferChunk* chunk);
+
+  static const size_t kNoChunk = static_cast<size_t>(-1);
+
+  const size_t max_chunks_;
+  const base::Thread::LocalStorageKey thread_chunk_key_;
+  std::unique_ptr<TraceWriter> trace_writer_;
+  std::unique_ptr<WriterThread> writer_thread_;
+
+  base::Mutex mutex_;
+  base::ConditionVariable chunk_retired_;
+  // Chunks are allocated on demand, up to max_chunks_.
+  std::vector<std::unique_ptr<TraceBufferChunk>> chunks_;
+  size_t num_allocated_chunks_ = 0;
+  // Whether a thread is currently filling the chunk at the same index.
+  std::vector<bool> chunk_in_use_;
+  std::vector<size_t> free_chunks_;
+  std::deque<size_t> retired_chunks_;
+  uint32_t current_chunk_seq_ = 0;
+  bool flushing_ = false;
+};
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
+
+#endif  // SRC_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
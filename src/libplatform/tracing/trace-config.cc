@@ -0,0 +1,111 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string.h>
+
+#include "include/libplatform/v8-tracing.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+namespace {
+
+const char kDisabledByDefaultPrefix[] = "disabled-by-default-";
+
+// Matches a single category against a pattern that may end in '*'.
+bool MatchesPattern(const std::string& category, const std::string& pattern) {
+  if (!pattern.empty() && pattern.back() == '*') {
+    return category.compare(0, pattern.size() - 1, pattern, 0,
+                            pattern.size() - 1) == 0;
+  }
+  return category == pattern;
+}
+
+bool IsDisabledByDefault(const std::string& category) {
+  return category.compare(0, sizeof(kDisabledByDefaultPrefix) - 1,
+                          kDisabledByDefaultPrefix) == 0;
+}
+
+// Disabled-by-default categories are only matched by patterns that name them
+// explicitly, so that e.g. "*" does not turn on expensive instrumentation.
+bool MatchesAny(const std::string& category,
+                const TraceConfig::StringList& patterns) {
+  bool disabled_by_default = IsDisabledByDefault(category);
+  for (const std::string& pattern : patterns) {
+    if (disabled_by_default && !IsDisabledByDefault(pattern)) continue;
+    if (MatchesPattern(category, pattern)) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+TraceConfig* TraceConfig::CreateDefaultTraceConfig() {
+  TraceConfig* trace_config = new TraceConfig();
+  trace_config->included_categories_.push_back("v8");
+  return trace_config;
+}
+
+TraceConfig* TraceConfig::CreateFromCategoryFilter(const char* filter) {
+  TraceConfig* trace_config = new TraceConfig();
+  const char* start = filter;
+  while (true) {
+    const char* end = strchr(start, ',');
+    std::string category =
+        end ? std::string(start, end - start) : std::string(start);
+    // Ignore surrounding whitespace and empty entries.
+    size_t first = category.find_first_not_of(" \t");
+    size_t last = category.find_last_not_of(" \t");
+    if (first != std::string::npos) {
+      category = category.substr(first, last - first + 1);
+      if (category[0] == '-') {
+        // A lone '-' names no category to exclude.
+        size_t name = category.find_first_not_of(" \t", 1);
+        if (name != std::string::npos) {
+          trace_config->AddExcludedCategory(category.c_str() + name);
+        }
+      } else {
+        trace_config->AddIncludedCategory(category.c_str());
+      }
+    }
+    if (end == nullptr) break;
+    start = end + 1;
+  }
+  return trace_config;
+}
+
+void TraceConfig::AddIncludedCategory(const char* included_category) {
+  DCHECK(included_category != NULL && strlen(included_category) > 0);
+  included_categories_.push_back(included_category);
+}
+
+void TraceConfig::AddExcludedCategory(const char* excluded_category) {
+  DCHECK(excluded_category != NULL && strlen(excluded_category) > 0);
+  excluded_categories_.push_back(excluded_category);
+}
+
+bool TraceConfig::IsCategoryGroupEnabled(const char* category_group) const {
+  // A category group is a comma-separated list of categories, and is enabled
+  // if any of them is.
+  const char* start = category_group;
+  while (true) {
+    const char* end = strchr(start, ',');
+    std::string category =
+        end ? std::string(start, end - start) : std::string(start);
+    if (!MatchesAny(category, excluded_categories_)) {
+      if (MatchesAny(category, included_categories_)) return true;
+      if (included_categories_.empty() && !IsDisabledByDefault(category)) {
+        return true;
+      }
+    }
+    if (end == nullptr) return false;
+    start = end + 1;
+  }
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
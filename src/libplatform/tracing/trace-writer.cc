@@ -0,0 +1,179 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/tracing/trace-writer.h"
+
+#include <string.h>
+
+#include <cmath>
+
+#include "base/trace_event/common/trace_event_common.h"
+#include "src/base/format-macros.h"
+#include "src/base/logging.h"
+#include "src/base/platform/platform.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+// Writes the given string, escaping characters that cannot appear in a JSON
+// string literal.
+void JSONTraceWriter::AppendString(const char* str) {
+  stream_ << "\"";
+  for (const char* c = str; *c != '\0'; ++c) {
+    switch (*c) {
+      case '\b':
+        stream_ << "\\b";
+        break;
+      case '\f':
+        stream_ << "\\f";
+        break;
+      case '\n':
+        stream_ << "\\n";
+        break;
+      case '\r':
+        stream_ << "\\r";
+        break;
+      case '\t':
+        stream_ << "\\t";
+        break;
+      case '\"':
+        stream_ << "\\\"";
+        break;
+      case '\\':
+        stream_ << "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(*c) < 0x20) {
+          char buffer[8];
+          base::OS::SNPrintF(buffer, sizeof(buffer), "\\u%04x",
+                             static_cast<unsigned char>(*c));
+          stream_ << buffer;
+        } else {
+          stream_ << *c;
+        }
+        break;
+    }
+  }
+  stream_ << "\"";
+}
+
+void JSONTraceWriter::AppendHex(uint64_t value) {
+  char buffer[24];
+  base::OS::SNPrintF(buffer, sizeof(buffer), "\"0x%" PRIx64 "\"", value);
+  stream_ << buffer;
+}
+
+void JSONTraceWriter::AppendArgValue(uint8_t type,
+                                     TraceObject::ArgValue value) {
+  switch (type) {
+    case TRACE_VALUE_TYPE_BOOL:
+      stream_ << (value.as_bool ? "true" : "false");
+      break;
+    case TRACE_VALUE_TYPE_UINT:
+      stream_ << value.as_uint;
+      break;
+    case TRACE_VALUE_TYPE_INT:
+      stream_ << value.as_int;
+      break;
+    case TRACE_VALUE_TYPE_DOUBLE: {
+      double val = value.as_double;
+      if (std::isfinite(val)) {
+        // Print enough digits to read the same value back, and keep a
+        // decimal point so that it reads back as a double.
+        char buffer[32];
+        base::OS::SNPrintF(buffer, sizeof(buffer), "%.17g", val);
+        stream_ << buffer;
+        if (strpbrk(buffer, ".eE") == nullptr) stream_ << ".0";
+      } else if (std::isnan(val)) {
+        // The JSON spec doesn't allow NaN and Infinity (since these are
+        // objects in EcmaScript). Use strings instead.
+        stream_ << "\"NaN\"";
+      } else {
+        stream_ << (val < 0 ? "\"-Infinity\"" : "\"Infinity\"");
+      }
+      break;
+    }
+    case TRACE_VALUE_TYPE_POINTER:
+      AppendHex(reinterpret_cast<uintptr_t>(value.as_pointer));
+      break;
+    case TRACE_VALUE_TYPE_STRING:
+    case TRACE_VALUE_TYPE_COPY_STRING:
+      if (value.as_string == nullptr) {
+        stream_ << "\"NULL\"";
+      } else {
+        AppendString(value.as_string);
+      }
+      break;
+    default:
+      UNREACHABLE();
+      break;
+  }
+}
+
+JSONTraceWriter::JSONTraceWriter(std::ostream& stream) : stream_(stream) {
+  stream_ << "{\"traceEvents\":[";
+}
+
+JSONTraceWriter::~JSONTraceWriter() { stream_ << "]}"; }
+
+void JSONTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
+  if (append_comma_) stream_ << ",";
+  append_comma_ = true;
+  stream_ << "{\"pid\":" << trace_event->pid()
+          << ",\"tid\":" << trace_event->tid()
+          << ",\"ts\":" << trace_event->ts()
+          << ",\"tts\":" << trace_event->tts() << ",\"ph\":\""
+          << trace_event->phase() << "\",\"cat\":";
+  AppendString(TracingController::GetCategoryGroupName(
+      trace_event->category_enabled_flag()));
+  stream_ << ",\"name\":";
+  AppendString(trace_event->name());
+  if (trace_event->phase() == TRACE_EVENT_PHASE_COMPLETE) {
+    stream_ << ",\"dur\":" << trace_event->duration()
+            << ",\"tdur\":" << trace_event->cpu_duration();
+  }
+  if (trace_event->flags() & TRACE_EVENT_FLAG_HAS_ID) {
+    if (trace_event->scope() != nullptr) {
+      stream_ << ",\"scope\":";
+      AppendString(trace_event->scope());
+    }
+    // So as not to lose bits from a 64-bit integer ID, serialize as a
+    // hex string.
+    stream_ << ",\"id\":";
+    AppendHex(trace_event->id());
+  }
+  if (trace_event->flags() &
+      (TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT)) {
+    stream_ << ",\"bind_id\":";
+    AppendHex(trace_event->bind_id());
+    if (trace_event->flags() & TRACE_EVENT_FLAG_FLOW_IN) {
+      stream_ << ",\"flow_in\":true";
+    }
+    if (trace_event->flags() & TRACE_EVENT_FLAG_FLOW_OUT) {
+      stream_ << ",\"flow_out\":true";
+    }
+  }
+  stream_ << ",\"args\":{";
+  const char** arg_names = trace_event->arg_names();
+  const uint8_t* arg_types = trace_event->arg_types();
+  TraceObject::ArgValue* arg_values = trace_event->arg_values();
+  for (int i = 0; i < trace_event->num_args(); ++i) {
+    if (i > 0) stream_ << ",";
+    AppendString(arg_names[i]);
+    stream_ << ":";
+    AppendArgValue(arg_types[i], arg_values[i]);
+  }
+  stream_ << "}}";
+}
+
+void JSONTraceWriter::Flush() { stream_.flush(); }
+
+TraceWriter* TraceWriter::CreateJSONTraceWriter(std::ostream& stream) {
+  return new JSONTraceWriter(stream);
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
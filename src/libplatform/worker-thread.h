@@ -18,7 +18,8 @@ class TaskQueue;
 
 class WorkerThread : public base::Thread {
  public:
-  explicit WorkerThread(TaskQueue* queue);
+  // Takes tasks from |queue| as the worker with the given id.
+  explicit WorkerThread(TaskQueue* queue, int worker_id = 0);
   virtual ~WorkerThread();
 
   // Thread implementation.
@@ -28,6 +29,7 @@ class WorkerThread : public base::Thread {
   friend class QuitTask;
 
   TaskQueue* queue_;
+  int worker_id_;
 
   DISALLOW_COPY_AND_ASSIGN(WorkerThread);
 };
@@ -17,12 +17,49 @@ namespace internal {
 
 const char* const Log::kLogToTemporaryFile = "&";
 const char* const Log::kLogToConsole = "-";
+const char* const Log::kBinaryLogMagic = "v8-binary-log,1";
+
+
+namespace {
+
+const int kMaxVarintLength = 10;
+
+// Writes |value| as an unsigned LEB128 varint and returns its length.
+int EncodeVarint(uint64_t value, uint8_t* buffer) {
+  int length = 0;
+  do {
+    buffer[length] = value & 0x7f;
+    value >>= 7;
+    if (value != 0) buffer[length] |= 0x80;
+    length++;
+  } while (value != 0);
+  return length;
+}
+
+}  // namespace
+
+
+class Log::WriterThread : public base::Thread {
+ public:
+  explicit WriterThread(Log* log)
+      : base::Thread(base::Thread::Options("v8:LogWriter")), log_(log) {}
+
+  void Run() override { log_->WriteRingBuffer(); }
+
+ private:
+  Log* log_;
+};
 
 
 Log::Log(Logger* logger)
   : is_stopped_(false),
     output_handle_(NULL),
     message_buffer_(NULL),
+    ring_buffer_(NULL),
+    writer_thread_(NULL),
+    ring_head_(0),
+    ring_tail_(0),
+    stop_writer_(false),
     logger_(logger) {
 }
 
@@ -55,6 +92,12 @@ void Log::Initialize(const char* log_file_name) {
     }
 
     if (output_handle_ != nullptr) {
+      // Keep console output in order with anything else printed to stdout.
+      if (FLAG_log_async && output_handle_ != stdout) StartWriterThread();
+      if (FLAG_log_binary) {
+        WriteToFile(kBinaryLogMagic, StrLength(kBinaryLogMagic));
+        WriteToFile("\n", 1);
+      }
       Log::MessageBuilder msg(this);
       msg.Append("v8-version,%d,%d,%d,%d,%d", Version::GetMajor(),
                  Version::GetMinor(), Version::GetBuild(), Version::GetPatch(),
@@ -83,8 +126,94 @@ void Log::OpenFile(const char* name) {
 }
 
 
+void Log::StartWriterThread() {
+  DCHECK_NULL(ring_buffer_);
+  ring_buffer_ = NewArray<char>(kRingBufferSize);
+  ring_head_ = ring_tail_ = 0;
+  stop_writer_ = false;
+  writer_thread_ = new WriterThread(this);
+  writer_thread_->Start();
+}
+
+
+void Log::StopWriterThread() {
+  {
+    base::LockGuard<base::Mutex> guard(&ring_mutex_);
+    stop_writer_ = true;
+    ring_data_available_.NotifyOne();
+  }
+  writer_thread_->Join();
+  delete writer_thread_;
+  writer_thread_ = NULL;
+  DCHECK_EQ(ring_head_, ring_tail_);
+  DeleteArray(ring_buffer_);
+  ring_buffer_ = NULL;
+}
+
+
+int Log::WriteToRingBuffer(const char* msg, int length) {
+  base::LockGuard<base::Mutex> guard(&ring_mutex_);
+  size_t written = 0;
+  while (written < static_cast<size_t>(length)) {
+    size_t pending = ring_head_ - ring_tail_;
+    if (pending == kRingBufferSize) {
+      ring_data_available_.NotifyOne();
+      ring_space_available_.Wait(&ring_mutex_);
+      continue;
+    }
+    size_t offset = ring_head_ % kRingBufferSize;
+    size_t chunk = Min(static_cast<size_t>(length) - written,
+                       Min(kRingBufferSize - pending, kRingBufferSize - offset));
+    MemCopy(ring_buffer_ + offset, msg + written, chunk);
+    ring_head_ += chunk;
+    written += chunk;
+  }
+  if (ring_head_ - ring_tail_ >= kRingBufferWriteThreshold) {
+    ring_data_available_.NotifyOne();
+  }
+  return length;
+}
+
+
+void Log::WriteRingBuffer() {
+  base::LockGuard<base::Mutex> guard(&ring_mutex_);
+  while (true) {
+    if (ring_head_ - ring_tail_ < kRingBufferWriteThreshold && !stop_writer_) {
+      // Also write small amounts of pending data from time to time, so that
+      // the file does not lag far behind.
+      bool notified = ring_data_available_.WaitFor(
+          &ring_mutex_,
+          base::TimeDelta::FromMilliseconds(kRingBufferWriteIntervalMs));
+      USE(notified);
+    }
+    size_t head = ring_head_;
+    size_t tail = ring_tail_;
+    if (head == tail) {
+      if (stop_writer_) return;
+      continue;
+    }
+    // Only this thread advances the tail, so the pending data cannot be
+    // overwritten while the lock is released.
+    ring_mutex_.Unlock();
+    while (tail != head) {
+      size_t offset = tail % kRingBufferSize;
+      size_t chunk = Min(head - tail, kRingBufferSize - offset);
+      size_t rv = fwrite(ring_buffer_ + offset, 1, chunk, output_handle_);
+      DCHECK_EQ(chunk, rv);
+      USE(rv);
+      tail += chunk;
+    }
+    fflush(output_handle_);
+    ring_mutex_.Lock();
+    ring_tail_ = head;
+    ring_space_available_.NotifyOne();
+  }
+}
+
+
 FILE* Log::Close() {
   FILE* result = NULL;
+  if (writer_thread_ != NULL) StopWriterThread();
   if (output_handle_ != NULL) {
     if (strcmp(FLAG_logfile, kLogToTemporaryFile) != 0) {
       fclose(output_handle_);
@@ -105,7 +234,8 @@ FILE* Log::Close() {
 Log::MessageBuilder::MessageBuilder(Log* log)
   : log_(log),
     lock_guard_(&log_->mutex_),
-    pos_(0) {
+    pos_(0),
+    record_type_(kTextRecord) {
   DCHECK(log_->message_buffer_ != NULL);
 }
 
@@ -227,8 +357,35 @@ void Log::MessageBuilder::AppendStringPart(const char* str, int len) {
 }
 
 
+void Log::MessageBuilder::AppendVarint(uint64_t value) {
+  uint8_t buffer[kMaxVarintLength];
+  int length = EncodeVarint(value, buffer);
+  for (int i = 0; i < length; i++) Append(static_cast<char>(buffer[i]));
+}
+
+
+void Log::MessageBuilder::AppendSignedVarint(int64_t value) {
+  AppendVarint((static_cast<uint64_t>(value) << 1) ^
+               static_cast<uint64_t>(value >> 63));
+}
+
+
 void Log::MessageBuilder::WriteToLogFile() {
   DCHECK(pos_ <= Log::kMessageBufferSize);
+  if (FLAG_log_binary) {
+    // Prefix the message with its record header instead of terminating it.
+    uint8_t header[1 + kMaxVarintLength];
+    header[0] = static_cast<uint8_t>(record_type_);
+    int header_length = 1 + EncodeVarint(pos_, header + 1);
+    if (log_->WriteToFile(reinterpret_cast<char*>(header), header_length) !=
+            header_length ||
+        log_->WriteToFile(log_->message_buffer_, pos_) != pos_) {
+      log_->stop();
+      log_->logger_->LogFailure();
+    }
+    return;
+  }
+  DCHECK_EQ(kTextRecord, record_type_);
   // Assert that we do not already have a new line at the end.
   DCHECK(pos_ == 0 || log_->message_buffer_[pos_ - 1] != '\n');
   if (pos_ == Log::kMessageBufferSize) pos_--;
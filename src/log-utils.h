@@ -11,6 +11,7 @@
 
 #include "src/allocation.h"
 #include "src/base/compiler-specific.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/flags.h"
 
@@ -48,6 +49,32 @@ class Log {
   // Size of buffer used for formatting log messages.
   static const int kMessageBufferSize = 2048;
 
+  // With --log-async, messages are appended to a ring buffer of this size,
+  // and a background thread writes them to the file once at least
+  // kRingBufferWriteThreshold bytes are pending, or every
+  // kRingBufferWriteIntervalMs milliseconds.
+  static const size_t kRingBufferSize = 1024 * 1024;
+  static const size_t kRingBufferWriteThreshold = 64 * 1024;
+  static const int kRingBufferWriteIntervalMs = 100;
+
+  // With --log-binary, the log file starts with this line, followed by
+  // records made of a RecordType byte, the payload length as a varint, and
+  // the payload. Varints are unsigned LEB128; signed values are zigzag
+  // encoded first.
+  static const char* const kBinaryLogMagic;
+  enum RecordType {
+    // A text log line, without the trailing newline.
+    kTextRecord = 0,
+    // Tag, kind, address and size as varints, followed by the rest of the
+    // text code-creation line.
+    kCodeCreationRecord = 1,
+    // PC, the time delta to the previous tick as a signed varint,
+    // (state << 2 | overflow << 1 | has_external_callback), the external
+    // callback or top of stack, the number of frames, and each frame as a
+    // signed delta to the previous frame (or the PC).
+    kTickRecord = 2
+  };
+
   // This mode is only used in tests, as temporary files are automatically
   // deleted on close and thus can't be accessed afterwards.
   static const char* const kLogToTemporaryFile;
@@ -87,6 +114,16 @@ class Log {
     // Append a portion of a string.
     void AppendStringPart(const char* str, int len);
 
+    // Append a varint to a binary record.
+    void AppendVarint(uint64_t value);
+
+    // Append a zigzag encoded varint to a binary record.
+    void AppendSignedVarint(int64_t value);
+
+    // Makes the message a binary record of the given type. Only used with
+    // --log-binary.
+    void set_record_type(RecordType type) { record_type_ = type; }
+
     // Write the log message to the log file currently opened.
     void WriteToLogFile();
 
@@ -94,6 +131,7 @@ class Log {
     Log* log_;
     base::LockGuard<base::Mutex> lock_guard_;
     int pos_;
+    RecordType record_type_;
   };
 
  private:
@@ -108,9 +146,25 @@ class Log {
   // Opens a temporary file for logging.
   void OpenTemporaryFile();
 
+  class WriterThread;
+
+  // Starts the thread that writes the ring buffer to the log file.
+  void StartWriterThread();
+
+  // Writes out the ring buffer and stops the writer thread.
+  void StopWriterThread();
+
+  // Body of the writer thread.
+  void WriteRingBuffer();
+
+  // Copies the message into the ring buffer, waiting for the writer thread
+  // to make room if needed.
+  int WriteToRingBuffer(const char* msg, int length);
+
   // Implementation of writing to a log file.
   int WriteToFile(const char* msg, int length) {
     DCHECK(output_handle_ != NULL);
+    if (ring_buffer_ != NULL) return WriteToRingBuffer(msg, length);
     size_t rv = fwrite(msg, 1, length, output_handle_);
     DCHECK(static_cast<size_t>(length) == rv);
     USE(rv);
@@ -133,6 +187,19 @@ class Log {
   // mutex_ should be acquired before using it.
   char* message_buffer_;
 
+  // Ring buffer and writer thread used with --log-async. Appending to the
+  // buffer happens with mutex_ held, but the positions are guarded by
+  // ring_mutex_ only, so the writer thread never blocks message formatting.
+  char* ring_buffer_;
+  WriterThread* writer_thread_;
+  base::Mutex ring_mutex_;
+  base::ConditionVariable ring_data_available_;
+  base::ConditionVariable ring_space_available_;
+  // Total number of bytes appended to and written from the ring buffer.
+  size_t ring_head_;
+  size_t ring_tail_;
+  bool stop_writer_;
+
   Logger* logger_;
 
   friend class Logger;
@@ -727,7 +727,8 @@ Logger::Logger(Isolate* isolate)
       ll_logger_(NULL),
       jit_logger_(NULL),
       listeners_(5),
-      is_initialized_(false) {}
+      is_initialized_(false),
+      last_binary_tick_time_(0) {}
 
 Logger::~Logger() {
   delete log_;
@@ -1074,6 +1075,15 @@ static void AppendCodeCreateHeader(Log::MessageBuilder* msg,
                                    Logger::LogEventsAndTags tag,
                                    AbstractCode* code) {
   DCHECK(msg);
+  if (FLAG_log_binary) {
+    // The rest of the line is appended as text.
+    msg->set_record_type(Log::kCodeCreationRecord);
+    msg->AppendVarint(tag);
+    msg->AppendVarint(code->kind());
+    msg->AppendVarint(reinterpret_cast<uintptr_t>(code->address()));
+    msg->AppendVarint(code->ExecutableSize());
+    return;
+  }
   msg->Append("%s,%s,%d,",
               kLogEventsNames[Logger::CODE_CREATION_EVENT],
               kLogEventsNames[tag],
@@ -1382,9 +1392,41 @@ void Logger::DebugEvent(const char* event_type, Vector<uint16_t> parameter) {
 }
 
 
+static void AppendBinaryTick(Log::MessageBuilder* msg, TickSample* sample,
+                             bool overflow, int time_delta) {
+  // Every frame takes at most 10 bytes; limit their number so that the
+  // record is not truncated.
+  static const unsigned kMaxFrames = (Log::kMessageBufferSize - 64) / 10;
+  msg->set_record_type(Log::kTickRecord);
+  msg->AppendVarint(reinterpret_cast<uintptr_t>(sample->pc));
+  msg->AppendSignedVarint(time_delta);
+  msg->AppendVarint(static_cast<int>(sample->state) << 2 |
+                    (overflow ? 1 << 1 : 0) |
+                    (sample->has_external_callback ? 1 : 0));
+  msg->AppendVarint(reinterpret_cast<uintptr_t>(
+      sample->has_external_callback ? sample->external_callback_entry
+                                    : sample->tos));
+  unsigned frames_count = Min(sample->frames_count, kMaxFrames);
+  msg->AppendVarint(frames_count);
+  intptr_t previous = reinterpret_cast<intptr_t>(sample->pc);
+  for (unsigned i = 0; i < frames_count; ++i) {
+    intptr_t frame = reinterpret_cast<intptr_t>(sample->stack[i]);
+    msg->AppendSignedVarint(static_cast<int64_t>(frame) - previous);
+    previous = frame;
+  }
+}
+
+
 void Logger::TickEvent(TickSample* sample, bool overflow) {
   if (!log_->IsEnabled() || !FLAG_prof_cpp) return;
   Log::MessageBuilder msg(log_);
+  if (FLAG_log_binary) {
+    int time = static_cast<int>(timer_.Elapsed().InMicroseconds());
+    AppendBinaryTick(&msg, sample, overflow, time - last_binary_tick_time_);
+    last_binary_tick_time_ = time;
+    msg.WriteToLogFile();
+    return;
+  }
   msg.Append("%s,", kLogEventsNames[TICK_EVENT]);
   msg.AppendAddress(sample->pc);
   msg.Append(",%d", static_cast<int>(timer_.Elapsed().InMicroseconds()));
@@ -1756,6 +1798,15 @@ bool Logger::SetUp(Isolate* isolate) {
   PrepareLogFileName(log_file_name, isolate, FLAG_logfile);
   log_->Initialize(log_file_name.str().c_str());
 
+  if (FLAG_log_binary && log_->IsEnabled()) {
+    // Binary code-creation records refer to tags by number.
+    Log::MessageBuilder msg(log_);
+    msg.Append("binary-log-tags");
+    for (int i = 0; i < NUMBER_OF_LOG_EVENTS; i++) {
+      msg.Append(",%s", kLogEventsNames[i]);
+    }
+    msg.WriteToLogFile();
+  }
 
   if (FLAG_perf_basic_prof) {
     perf_basic_logger_ = new PerfBasicLogger();
@@ -397,6 +397,10 @@ class Logger {
 
   base::ElapsedTimer timer_;
 
+  // Time of the last tick written with --log-binary, which stores the time
+  // of each tick as a delta to the previous one.
+  int last_binary_tick_time_;
+
   friend class CpuProfiler;
 };
 
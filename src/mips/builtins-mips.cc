@@ -1389,6 +1389,11 @@ void Builtins::Generate_CompileOptimizedConcurrent(MacroAssembler* masm) {
 }
 
 
+void Builtins::Generate_DeserializeLazy(MacroAssembler* masm) {
+  GenerateTailCallToReturnedCode(masm, Runtime::kDeserializeLazy);
+}
+
+
 static void GenerateMakeCodeYoungAgainCommon(MacroAssembler* masm) {
   // For now, we are relying on the fact that make_code_young doesn't do any
   // garbage collection which allows us to save/restore the registers without
@@ -805,8 +805,23 @@ void JSRegExp::JSRegExpVerify() {
       CHECK(uc16_saved->IsSmi() || uc16_saved->IsString() ||
              uc16_saved->IsCode());
 
+      Object* one_byte_bytecode =
+          arr->get(JSRegExp::kIrregexpLatin1BytecodeIndex);
+      CHECK(one_byte_bytecode->IsSmi() || one_byte_bytecode->IsByteArray());
+      Object* uc16_bytecode = arr->get(JSRegExp::kIrregexpUC16BytecodeIndex);
+      CHECK(uc16_bytecode->IsSmi() || uc16_bytecode->IsByteArray());
+
       CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex)->IsSmi());
+      Object* nfa_program = arr->get(JSRegExp::kIrregexpNfaProgramIndex);
+      CHECK(nfa_program->IsSmi() || nfa_program->IsByteArray());
+      Object* literal = arr->get(JSRegExp::kIrregexpRequiredLiteralIndex);
+      CHECK(literal->IsSmi() || literal->IsString());
+      CHECK(arr->get(JSRegExp::kIrregexpRequiredLiteralMinOffsetIndex)
+                ->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex)
+                ->IsSmi());
       break;
     }
     default:
@@ -7946,6 +7946,14 @@ class JSRegExp: public JSObject {
     }
   }
 
+  static int bytecode_index(bool is_latin1) {
+    if (is_latin1) {
+      return kIrregexpLatin1BytecodeIndex;
+    } else {
+      return kIrregexpUC16BytecodeIndex;
+    }
+  }
+
   DECLARE_CAST(JSRegExp)
 
   // Dispatched behavior.
@@ -7991,7 +7999,28 @@ class JSRegExp: public JSObject {
   // Number of captures in the compiled regexp.
   static const int kIrregexpCaptureCountIndex = kDataIndex + 5;
 
-  static const int kIrregexpDataSize = kIrregexpCaptureCountIndex + 1;
+  // Irregexp bytecode for Latin1 and UC16, used to execute the regexp in
+  // the interpreter until it is hot enough to be compiled to native code.
+  // Cleared once native code has been generated for the same encoding.
+  static const int kIrregexpLatin1BytecodeIndex = kDataIndex + 6;
+  static const int kIrregexpUC16BytecodeIndex = kDataIndex + 7;
+  // Number of interpreted executions left before the regexp is tiered up to
+  // native code. Zero means the next compilation generates native code.
+  static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 8;
+  // Program for the linear-time automaton if the regexp is executed by it.
+  // Otherwise kUninitializedValue, or kCompilationErrorValue if the pattern
+  // is outside the subset the automaton supports.
+  static const int kIrregexpNfaProgramIndex = kDataIndex + 9;
+  // A literal string that every match contains, or kUninitializedValue if
+  // there is none worth searching for. The literal starts at least min
+  // offset and at most max offset characters after the start of the match;
+  // a max offset of -1 means there is no upper bound.
+  static const int kIrregexpRequiredLiteralIndex = kDataIndex + 10;
+  static const int kIrregexpRequiredLiteralMinOffsetIndex = kDataIndex + 11;
+  static const int kIrregexpRequiredLiteralMaxOffsetIndex = kDataIndex + 12;
+
+  static const int kIrregexpDataSize =
+      kIrregexpRequiredLiteralMaxOffsetIndex + 1;
 
   // Offsets directly into the data fixed array.
   static const int kDataTagOffset =
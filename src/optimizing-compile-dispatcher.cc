@@ -203,16 +203,18 @@ void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job) {
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
   } else {
-    V8::GetCurrentPlatform()->CallOnBackgroundThread(
-        new CompileTask(isolate_), v8::Platform::kShortRunningTask);
+    V8::GetCurrentPlatform()->CallPrioritizedOnBackgroundThread(
+        reinterpret_cast<v8::Isolate*>(isolate_), new CompileTask(isolate_),
+        v8::Platform::kUserVisibleTask);
   }
 }
 
 
 void OptimizingCompileDispatcher::Unblock() {
   while (blocked_jobs_ > 0) {
-    V8::GetCurrentPlatform()->CallOnBackgroundThread(
-        new CompileTask(isolate_), v8::Platform::kShortRunningTask);
+    V8::GetCurrentPlatform()->CallPrioritizedOnBackgroundThread(
+        reinterpret_cast<v8::Isolate*>(isolate_), new CompileTask(isolate_),
+        v8::Platform::kUserVisibleTask);
     blocked_jobs_--;
   }
 }
@@ -27,7 +27,13 @@
 
 #include "src/perf-jit.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "src/assembler.h"
+#include "src/deoptimizer.h"
+#include "src/global-handles.h"
 #include "src/objects-inl.h"
 
 #if V8_OS_LINUX
@@ -56,7 +62,13 @@ struct PerfJitHeader {
 };
 
 struct PerfJitBase {
-  enum PerfJitEvent { kLoad = 0, kMove = 1, kDebugInfo = 2, kClose = 3 };
+  enum PerfJitEvent {
+    kLoad = 0,
+    kMove = 1,
+    kDebugInfo = 2,
+    kClose = 3,
+    kUnwindingInfo = 4
+  };
 
   uint32_t event_;
   uint32_t size_;
@@ -72,6 +84,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -85,6 +107,212 @@ struct PerfJitCodeDebugInfo : PerfJitBase {
   // Followed by entry_count_ instances of PerfJitDebugEntry.
 };
 
+struct PerfJitCodeUnwindingInfo : PerfJitBase {
+  uint64_t unwinding_size_;
+  uint64_t eh_frame_hdr_size_;
+  uint64_t mapped_size_;
+  // Followed by unwinding_size_ bytes of .eh_frame and .eh_frame_hdr data.
+};
+
+namespace {
+
+uint32_t GetCodeSize(Code* code) {
+  return code->is_crankshafted() ? code->safepoint_table_offset()
+                                 : code->instruction_size();
+}
+
+#if V8_TARGET_ARCH_X64
+
+// Writes the .eh_frame and .eh_frame_hdr sections that let perf's DWARF
+// unwinder step out of a single code object. perf inject places them right
+// after the code, at the next 8 byte boundary.
+class EhFrameWriter {
+ public:
+  static const int kEhFrameHdrSize = 20;
+
+  EhFrameWriter(const uint8_t* code, uint32_t code_size)
+      : code_(code), code_size_(code_size) {}
+
+  void Write(std::vector<uint8_t>* data);
+
+ private:
+  // DWARF call frame instructions and pointer encodings.
+  static const uint8_t kNop = 0x00;
+  static const uint8_t kAdvanceLoc = 0x40;
+  static const uint8_t kOffset = 0x80;
+  static const uint8_t kDefCfa = 0x0c;
+  static const uint8_t kDefCfaRegister = 0x0d;
+  static const uint8_t kDefCfaOffset = 0x0e;
+  static const uint8_t kUData4 = 0x03;
+  static const uint8_t kSData4 = 0x0b;
+  static const uint8_t kPcRel = 0x10;
+  static const uint8_t kDataRel = 0x30;
+
+  // DWARF register numbers.
+  static const uint8_t kRbp = 6;
+  static const uint8_t kRsp = 7;
+  static const uint8_t kReturnAddress = 16;
+
+  // Returns whether the code starts with "push rbp; mov rbp, rsp", as all
+  // JavaScript functions with a frame do.
+  bool HasStandardPrologue() const {
+    static const uint8_t kPrologue[] = {0x55, 0x48, 0x89, 0xe5};
+    return code_size_ >= sizeof(kPrologue) &&
+           memcmp(code_, kPrologue, sizeof(kPrologue)) == 0;
+  }
+
+  void WriteByte(uint8_t value) { data_->push_back(value); }
+  void WriteInt32(int32_t value) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    data_->insert(data_->end(), bytes, bytes + sizeof(value));
+  }
+  void PatchInt32(int offset, int32_t value) {
+    memcpy(&(*data_)[offset], &value, sizeof(value));
+  }
+  void AlignWithNops() {
+    while (offset() % kPointerSize != 0) WriteByte(kNop);
+  }
+  int offset() const { return static_cast<int>(data_->size()); }
+
+  const uint8_t* code_;
+  uint32_t code_size_;
+  std::vector<uint8_t>* data_;
+};
+
+
+void EhFrameWriter::Write(std::vector<uint8_t>* data) {
+  data_ = data;
+  const int eh_frame_to_code = RoundUp(static_cast<int>(code_size_), 8);
+
+  // The CIE describes the state at a call: the CFA is just above the return
+  // address.
+  int cie_offset = offset();
+  WriteInt32(0);  // Length, patched below.
+  WriteInt32(0);  // CIE id.
+  WriteByte(1);   // Version.
+  WriteByte('z');
+  WriteByte('R');
+  WriteByte(0);
+  WriteByte(1);     // Code alignment factor.
+  WriteByte(0x78);  // Data alignment factor, -8 as SLEB128.
+  WriteByte(kReturnAddress);
+  WriteByte(1);  // Augmentation data length.
+  WriteByte(kPcRel | kSData4);
+  WriteByte(kDefCfa);
+  WriteByte(kRsp);
+  WriteByte(kPointerSize);
+  WriteByte(kOffset | kReturnAddress);
+  WriteByte(1);
+  AlignWithNops();
+  PatchInt32(cie_offset, offset() - cie_offset - 4);
+
+  int fde_offset = offset();
+  WriteInt32(0);  // Length, patched below.
+  WriteInt32(offset() - cie_offset);
+  WriteInt32(-(eh_frame_to_code + offset()));  // Start of the code.
+  WriteInt32(static_cast<int32_t>(code_size_));
+  WriteByte(0);  // Augmentation data length.
+  if (HasStandardPrologue()) {
+    // After "push rbp".
+    WriteByte(kAdvanceLoc | 1);
+    WriteByte(kDefCfaOffset);
+    WriteByte(2 * kPointerSize);
+    WriteByte(kOffset | kRbp);
+    WriteByte(2);
+    // After "mov rbp, rsp".
+    WriteByte(kAdvanceLoc | 3);
+    WriteByte(kDefCfaRegister);
+    WriteByte(kRbp);
+  } else {
+    // Stubs and builtins mostly run inside a frame with the usual layout;
+    // this is only wrong before it is set up or after it is torn down.
+    WriteByte(kDefCfa);
+    WriteByte(kRbp);
+    WriteByte(2 * kPointerSize);
+    WriteByte(kOffset | kRbp);
+    WriteByte(2);
+  }
+  AlignWithNops();
+  PatchInt32(fde_offset, offset() - fde_offset - 4);
+  WriteInt32(0);  // Terminator.
+
+  int eh_frame_size = offset();
+  WriteByte(1);  // Version.
+  WriteByte(kPcRel | kSData4);
+  WriteByte(kUData4);
+  WriteByte(kDataRel | kSData4);
+  WriteInt32(-(eh_frame_size + 4));  // Start of .eh_frame.
+  WriteInt32(1);                     // Number of entries in the table.
+  WriteInt32(-(eh_frame_to_code + eh_frame_size));  // Start of the code.
+  WriteInt32(-(eh_frame_size - fde_offset));        // The FDE.
+  DCHECK_EQ(eh_frame_size + kEhFrameHdrSize, offset());
+  data_ = nullptr;
+}
+
+#endif  // V8_TARGET_ARCH_X64
+
+// A source position in the code, in the script of the function it belongs
+// to, which differs from the code's function for inlined functions.
+// The pc is kept as an offset, since the code can move while line numbers
+// are computed.
+struct CodeSourcePosition {
+  CodeSourcePosition(int pc_offset, Handle<Script> script, int position)
+      : pc_offset(pc_offset), script(script), position(position) {}
+  int pc_offset;
+  Handle<Script> script;
+  int position;
+
+  bool operator<(const CodeSourcePosition& other) const {
+    return pc_offset < other.pc_offset;
+  }
+};
+
+// Adds the start of the innermost inlined function at every call site in
+// optimized code, so that samples inside calls from inlined functions are
+// attributed to them.
+void AddInlinedFunctionPositions(Code* code,
+                                 std::vector<CodeSourcePosition>* positions) {
+  if (code->kind() != Code::OPTIMIZED_FUNCTION) return;
+  Isolate* isolate = code->GetIsolate();
+  DeoptimizationInputData* deopt_input_data =
+      DeoptimizationInputData::cast(code->deoptimization_data());
+  int deopt_count = deopt_input_data->DeoptCount();
+  for (int i = 0; i < deopt_count; i++) {
+    int pc_offset = deopt_input_data->Pc(i)->value();
+    if (pc_offset == -1) continue;
+    int translation_index = deopt_input_data->TranslationIndex(i)->value();
+    TranslationIterator it(deopt_input_data->TranslationByteArray(),
+                           translation_index);
+    Translation::Opcode opcode = static_cast<Translation::Opcode>(it.Next());
+    DCHECK_EQ(Translation::BEGIN, opcode);
+    it.Skip(Translation::NumberOfOperandsFor(opcode));
+    int depth = 0;
+    SharedFunctionInfo* innermost = nullptr;
+    while (it.HasNext() &&
+           Translation::BEGIN !=
+               (opcode = static_cast<Translation::Opcode>(it.Next()))) {
+      if (opcode != Translation::JS_FRAME &&
+          opcode != Translation::INTERPRETED_FRAME) {
+        it.Skip(Translation::NumberOfOperandsFor(opcode));
+        continue;
+      }
+      it.Next();  // Skip ast_id
+      int shared_info_id = it.Next();
+      it.Next();  // Skip height
+      SharedFunctionInfo* shared_info = SharedFunctionInfo::cast(
+          deopt_input_data->LiteralArray()->get(shared_info_id));
+      if (depth++) innermost = shared_info;  // Skip the function itself.
+    }
+    if (innermost == nullptr || !innermost->script()->IsScript()) continue;
+    positions->push_back(
+        CodeSourcePosition(pc_offset,
+                           handle(Script::cast(innermost->script()), isolate),
+                           innermost->start_position()));
+  }
+}
+
+}  // namespace
+
 const char PerfJitLogger::kFilenameFormatString[] = "./jit-%d.dump";
 
 // Extra padding for the PID in the filename
@@ -96,6 +324,17 @@ uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
+PerfJitLogger::CodeEntryMap* PerfJitLogger::code_entries_ = nullptr;
+
+// A code object written to the file. The weak handle removes the entry when
+// the code dies, so that code allocated at the same address later is not
+// mistaken for it.
+struct PerfJitLogger::CodeEntry {
+  PerfJitLogger* logger;
+  Object** code;
+  Address instruction_start;
+  uint64_t code_id;
+};
 
 void PerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -117,12 +356,16 @@ void PerfJitLogger::OpenJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
 
   setvbuf(perf_output_handle_, NULL, _IOFBF, kLogBufferSize);
+  code_entries_ = new CodeEntryMap();
 }
 
 void PerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
   fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
+  DCHECK(code_entries_->empty());
+  delete code_entries_;
+  code_entries_ = nullptr;
 }
 
 void* PerfJitLogger::OpenMarkerFile(int fd) {
@@ -159,6 +402,17 @@ PerfJitLogger::PerfJitLogger() {
 PerfJitLogger::~PerfJitLogger() {
   base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
 
+  // Release the handles of this isolate while its global handles still exist.
+  if (code_entries_ != nullptr) {
+    for (auto it = code_entries_->begin(); it != code_entries_->end();) {
+      if (it->second->logger == this) {
+        it = RemoveCodeEntry(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
   reference_count_--;
   // If this was the last logger, close the file.
   if (reference_count_ == 0) {
@@ -175,6 +429,18 @@ uint64_t PerfJitLogger::GetTimestamp() {
   return (ts.tv_sec * kNsecPerSec) + ts.tv_nsec;
 }
 
+// The debug info of a code object, with pc offsets instead of addresses.
+struct PerfJitLogger::CodeDebugInfo {
+  struct Entry {
+    int pc_offset;
+    int line_number;
+    int column;
+    int name;  // Index into |names|.
+  };
+  std::vector<Entry> entries;
+  std::vector<std::string> names;
+};
+
 void PerfJitLogger::LogRecordedBuffer(AbstractCode* abstract_code,
                                       SharedFunctionInfo* shared,
                                       const char* name, int length) {
@@ -191,18 +457,29 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode* abstract_code,
 
   // We only support non-interpreted functions.
   if (!abstract_code->IsCode()) return;
-  Code* code = abstract_code->GetCode();
-  DCHECK(code->instruction_start() == code->address() + Code::kHeaderSize);
-
-  // Debug info has to be emitted first.
+  Isolate* isolate = abstract_code->GetIsolate();
+  HandleScope scope(isolate);
+  Handle<Code> code(abstract_code->GetCode(), isolate);
+
+  // Collecting the debug info runs JavaScript and allocates, which may move
+  // the code and log other code objects through the shared name buffer. So
+  // copy the name, collect the debug info, and only then read any address.
+  std::string code_name(name, length);
+  CodeDebugInfo debug_info;
   if (FLAG_perf_prof_debug_info && shared != nullptr) {
-    LogWriteDebugInfo(code, shared);
+    CollectDebugInfo(code, handle(shared, isolate), &debug_info);
   }
 
-  const char* code_name = name;
+  DisallowHeapAllocation no_gc;
+  DCHECK(code->instruction_start() == code->address() + Code::kHeaderSize);
   uint8_t* code_pointer = reinterpret_cast<uint8_t*>(code->instruction_start());
-  uint32_t code_size = code->is_crankshafted() ? code->safepoint_table_offset()
-                                               : code->instruction_size();
+  uint32_t code_size = GetCodeSize(*code);
+
+  // Debug and unwinding info have to be emitted first.
+  if (!debug_info.entries.empty()) LogWriteDebugInfo(*code, debug_info);
+  if (FLAG_perf_prof_unwinding_info) {
+    LogWriteUnwindingInfo(*code, code_size);
+  }
 
   static const char string_terminator[] = "\0";
 
@@ -218,94 +495,188 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode* abstract_code,
   code_load.code_size_ = code_size;
   code_load.code_id_ = code_index_;
 
+  // The same code object may be logged more than once.
+  auto it = code_entries_->find(code->instruction_start());
+  if (it != code_entries_->end()) RemoveCodeEntry(it);
+  CodeEntry* entry = new CodeEntry();
+  entry->logger = this;
+  entry->code = isolate->global_handles()->Create(*code).location();
+  entry->instruction_start = code->instruction_start();
+  entry->code_id = code_index_;
+  GlobalHandles::MakeWeak(entry->code, entry, &HandleWeakCode,
+                          v8::WeakCallbackType::kParameter);
+  (*code_entries_)[entry->instruction_start] = entry;
   code_index_++;
 
   LogWriteBytes(reinterpret_cast<const char*>(&code_load), sizeof(code_load));
-  LogWriteBytes(code_name, length);
+  LogWriteBytes(code_name.c_str(), length);
   LogWriteBytes(string_terminator, 1);
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
 }
 
-void PerfJitLogger::LogWriteDebugInfo(Code* code, SharedFunctionInfo* shared) {
-  // Compute the entry count and get the name of the script.
-  uint32_t entry_count = 0;
-  for (RelocIterator it(code, RelocInfo::kPositionMask); !it.done();
+void PerfJitLogger::CollectDebugInfo(Handle<Code> code,
+                                     Handle<SharedFunctionInfo> shared,
+                                     CodeDebugInfo* info) {
+  if (!shared->script()->IsScript()) return;
+  Isolate* isolate = code->GetIsolate();
+  Handle<Script> script(Script::cast(shared->script()), isolate);
+
+  std::vector<CodeSourcePosition> positions;
+  for (RelocIterator it(*code, RelocInfo::kPositionMask); !it.done();
        it.next()) {
-    entry_count++;
+    int pc_offset =
+        static_cast<int>(it.rinfo()->pc() - code->instruction_start());
+    positions.push_back(CodeSourcePosition(
+        pc_offset, script, static_cast<int>(it.rinfo()->data())));
   }
-  if (entry_count == 0) return;
-  Handle<Script> script(Script::cast(shared->script()));
-  Handle<Object> name_or_url(Script::GetNameOrSourceURL(script));
-
-  int name_length = 0;
-  base::SmartArrayPointer<char> name_string;
-  if (name_or_url->IsString()) {
-    name_string =
-        Handle<String>::cast(name_or_url)
-            ->ToCString(DISALLOW_NULLS, FAST_STRING_TRAVERSAL, &name_length);
-    DCHECK_EQ(0, name_string.get()[name_length]);
-  } else {
-    const char unknown[] = "<unknown>";
-    name_length = static_cast<int>(strlen(unknown));
-    char* buffer = NewArray<char>(name_length);
-    base::OS::StrNCpy(buffer, name_length + 1, unknown,
-                      static_cast<size_t>(name_length));
-    name_string = base::SmartArrayPointer<char>(buffer);
+  AddInlinedFunctionPositions(*code, &positions);
+  std::stable_sort(positions.begin(), positions.end());
+
+  // Every entry carries the name of its script.
+  std::vector<Handle<Script>> named_scripts;
+  for (const CodeSourcePosition& position : positions) {
+    size_t index = 0;
+    while (index < named_scripts.size() &&
+           !named_scripts[index].is_identical_to(position.script)) {
+      index++;
+    }
+    if (index == named_scripts.size()) {
+      named_scripts.push_back(position.script);
+      Handle<Object> name_or_url(Script::GetNameOrSourceURL(position.script));
+      if (name_or_url->IsString()) {
+        int name_length = 0;
+        base::SmartArrayPointer<char> name_string =
+            Handle<String>::cast(name_or_url)
+                ->ToCString(DISALLOW_NULLS, FAST_STRING_TRAVERSAL,
+                            &name_length);
+        info->names.push_back(std::string(name_string.get(), name_length));
+      } else {
+        info->names.push_back("<unknown>");
+      }
+    }
+    CodeDebugInfo::Entry entry;
+    entry.pc_offset = position.pc_offset;
+    entry.line_number =
+        Script::GetLineNumber(position.script, position.position) + 1;
+    entry.column = Script::GetColumnNumber(position.script, position.position);
+    entry.name = static_cast<int>(index);
+    info->entries.push_back(entry);
+  }
+}
+
+void PerfJitLogger::LogWriteDebugInfo(Code* code,
+                                      const CodeDebugInfo& info) {
+  uint32_t size = sizeof(PerfJitCodeDebugInfo);
+  for (const CodeDebugInfo::Entry& entry : info.entries) {
+    size += static_cast<uint32_t>(sizeof(PerfJitDebugEntry) +
+                                  info.names[entry.name].size() + 1);
   }
-  DCHECK_EQ(name_length, strlen(name_string.get()));
 
   PerfJitCodeDebugInfo debug_info;
 
   debug_info.event_ = PerfJitCodeLoad::kDebugInfo;
   debug_info.time_stamp_ = GetTimestamp();
   debug_info.address_ = reinterpret_cast<uint64_t>(code->instruction_start());
-  debug_info.entry_count_ = entry_count;
-
-  uint32_t size = sizeof(debug_info);
-  // Add the sizes of fixed parts of entries.
-  size += entry_count * sizeof(PerfJitDebugEntry);
-  // Add the size of the name after the first entry.
-  size += (static_cast<uint32_t>(name_length) + 1) * entry_count;
+  debug_info.entry_count_ = info.entries.size();
 
   int padding = ((size + 7) & (~7)) - size;
 
   debug_info.size_ = size + padding;
 
   LogWriteBytes(reinterpret_cast<const char*>(&debug_info), sizeof(debug_info));
-
-  int script_line_offset = script->line_offset();
-  Handle<FixedArray> line_ends(FixedArray::cast(script->line_ends()));
-
-  for (RelocIterator it(code, RelocInfo::kPositionMask); !it.done();
-       it.next()) {
-    int position = static_cast<int>(it.rinfo()->data());
-    int line_number = Script::GetLineNumber(script, position);
-    // Compute column.
-    int relative_line_number = line_number - script_line_offset;
-    int start =
-        (relative_line_number == 0)
-            ? 0
-            : Smi::cast(line_ends->get(relative_line_number - 1))->value() + 1;
-    int column_offset = position - start;
-    if (relative_line_number == 0) {
-      // For the case where the code is on the same line as the script tag.
-      column_offset += script->column_offset();
-    }
-
-    PerfJitDebugEntry entry;
-    entry.address_ = reinterpret_cast<uint64_t>(it.rinfo()->pc());
-    entry.line_number_ = line_number;
-    entry.column_ = column_offset;
-    LogWriteBytes(reinterpret_cast<const char*>(&entry), sizeof(entry));
-    LogWriteBytes(name_string.get(), name_length + 1);
+  for (const CodeDebugInfo::Entry& entry : info.entries) {
+    PerfJitDebugEntry debug_entry;
+    debug_entry.address_ = reinterpret_cast<uint64_t>(
+        code->instruction_start() + entry.pc_offset);
+    debug_entry.line_number_ = entry.line_number;
+    debug_entry.column_ = entry.column;
+    LogWriteBytes(reinterpret_cast<const char*>(&debug_entry),
+                  sizeof(debug_entry));
+    const std::string& name = info.names[entry.name];
+    LogWriteBytes(name.c_str(), static_cast<int>(name.size()) + 1);
   }
   char padding_bytes[] = "\0\0\0\0\0\0\0\0";
   LogWriteBytes(padding_bytes, padding);
 }
 
+void PerfJitLogger::LogWriteUnwindingInfo(Code* code, uint32_t code_size) {
+#if V8_TARGET_ARCH_X64
+  std::vector<uint8_t> data;
+  EhFrameWriter writer(code->instruction_start(), code_size);
+  writer.Write(&data);
+
+  PerfJitCodeUnwindingInfo unwinding_info;
+  unwinding_info.event_ = PerfJitCodeLoad::kUnwindingInfo;
+  unwinding_info.time_stamp_ = GetTimestamp();
+  unwinding_info.unwinding_size_ = data.size();
+  unwinding_info.eh_frame_hdr_size_ = EhFrameWriter::kEhFrameHdrSize;
+  unwinding_info.mapped_size_ = data.size();
+
+  int content_size = static_cast<int>(sizeof(unwinding_info) + data.size());
+  int padding = RoundUp(content_size, 8) - content_size;
+  unwinding_info.size_ = content_size + padding;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&unwinding_info),
+                sizeof(unwinding_info));
+  LogWriteBytes(reinterpret_cast<const char*>(data.data()),
+                static_cast<int>(data.size()));
+  char padding_bytes[] = "\0\0\0\0\0\0\0\0";
+  LogWriteBytes(padding_bytes, padding);
+#endif  // V8_TARGET_ARCH_X64
+}
+
 void PerfJitLogger::CodeMoveEvent(AbstractCode* from, Address to) {
-  // Code relocation not supported.
-  UNREACHABLE();
+  // Only code objects are written to the file, and this is called before
+  // the object is copied, so |from| is still intact.
+  if (!from->IsCode()) return;
+  Code* code = from->GetCode();
+
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  // Code that was never written to the file has no entry.
+  Address old_start = code->instruction_start();
+  auto it = code_entries_->find(old_start);
+  if (it == code_entries_->end()) return;
+  CodeEntry* entry = it->second;
+  code_entries_->erase(it);
+  Address new_start = to + (old_start - code->address());
+  entry->instruction_start = new_start;
+  (*code_entries_)[new_start] = entry;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeLoad::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ =
+      static_cast<uint32_t>(base::OS::GetCurrentProcessId());
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = 0x0;  //  Our addresses are absolute.
+  code_move.old_code_address_ = reinterpret_cast<uint64_t>(old_start);
+  code_move.new_code_address_ = reinterpret_cast<uint64_t>(new_start);
+  code_move.code_size_ = GetCodeSize(code);
+  code_move.code_id_ = entry->code_id;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
+PerfJitLogger::CodeEntryMap::iterator PerfJitLogger::RemoveCodeEntry(
+    CodeEntryMap::iterator it) {
+  CodeEntry* entry = it->second;
+  GlobalHandles::Destroy(entry->code);
+  delete entry;
+  return code_entries_->erase(it);
+}
+
+void PerfJitLogger::HandleWeakCode(const v8::WeakCallbackInfo<void>& data) {
+  CodeEntry* entry = reinterpret_cast<CodeEntry*>(data.GetParameter());
+
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  auto it = code_entries_->find(entry->instruction_start);
+  DCHECK(it != code_entries_->end() && it->second == entry);
+  RemoveCodeEntry(it);
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
@@ -28,6 +28,8 @@
 #ifndef V8_PERF_JIT_H_
 #define V8_PERF_JIT_H_
 
+#include <map>
+
 #include "src/log.h"
 
 namespace v8 {
@@ -65,13 +67,23 @@ class PerfJitLogger : public CodeEventLogger {
 
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
-  void LogWriteDebugInfo(Code* code, SharedFunctionInfo* shared);
+  struct CodeDebugInfo;
+  void CollectDebugInfo(Handle<Code> code, Handle<SharedFunctionInfo> shared,
+                        CodeDebugInfo* info);
+  void LogWriteDebugInfo(Code* code, const CodeDebugInfo& info);
+  void LogWriteUnwindingInfo(Code* code, uint32_t code_size);
+
+  struct CodeEntry;
+  typedef std::map<Address, CodeEntry*> CodeEntryMap;
+  static CodeEntryMap::iterator RemoveCodeEntry(CodeEntryMap::iterator it);
+  static void HandleWeakCode(const v8::WeakCallbackInfo<void>& data);
 
   static const uint32_t kElfMachIA32 = 3;
   static const uint32_t kElfMachX64 = 62;
   static const uint32_t kElfMachARM = 40;
   static const uint32_t kElfMachMIPS = 10;
   static const uint32_t kElfMachARM64 = 183;
+  static const uint32_t kElfMachPPC64 = 21;
 
   uint32_t GetElfMach() {
 #if V8_TARGET_ARCH_IA32
@@ -84,6 +96,8 @@ class PerfJitLogger : public CodeEventLogger {
     return kElfMachMIPS;
 #elif V8_TARGET_ARCH_ARM64
     return kElfMachARM64;
+#elif V8_TARGET_ARCH_PPC64
+    return kElfMachPPC64;
 #else
     UNIMPLEMENTED();
     return 0;
@@ -97,6 +111,9 @@ class PerfJitLogger : public CodeEventLogger {
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
+  // Maps the instruction start of every live code object written to the
+  // file to its entry, which perf needs to follow the code when it moves.
+  static CodeEntryMap* code_entries_;
 };
 
 #else
@@ -556,6 +556,17 @@ void CpuProfiler::StartProfiling(String* title, bool record_samples) {
 }
 
 
+void CpuProfiler::StartStreamingProfiling(
+    String* title, v8::CpuProfileChunkListener* listener,
+    base::TimeDelta chunk_interval) {
+  if (profiles_->StartProfiling(profiles_->GetName(title), false, listener,
+                                chunk_interval)) {
+    StartProcessorIfNotStarted();
+  }
+  isolate_->debug()->feature_tracker()->Track(DebugFeatureTracker::kProfiler);
+}
+
+
 void CpuProfiler::StartProcessorIfNotStarted() {
   if (processor_ != NULL) {
     processor_->AddCurrentStack(isolate_);
@@ -207,6 +207,9 @@ class CpuProfiler : public CodeEventListener {
   void CollectSample();
   void StartProfiling(const char* title, bool record_samples = false);
   void StartProfiling(String* title, bool record_samples);
+  void StartStreamingProfiling(String* title,
+                               v8::CpuProfileChunkListener* listener,
+                               base::TimeDelta chunk_interval);
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(String* title);
   int GetProfilesCount();
@@ -84,6 +84,32 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   return result;
 }
 
+bool HeapProfiler::TakeSnapshotToStream(
+    v8::OutputStream* stream, v8::ActivityControl* control,
+    v8::HeapProfiler::ObjectNameResolver* resolver) {
+  FILE* edges_file = base::OS::OpenTemporaryFile();
+  if (edges_file == NULL) return false;
+  bool result;
+  {
+    HeapSnapshot snapshot(this);
+    snapshot.SpillEdgesTo(edges_file);
+    HeapSnapshotGenerator generator(&snapshot, control, resolver, heap());
+    result = generator.GenerateSnapshot() && !ferror(edges_file);
+    if (result) {
+      HeapSnapshotJSONSerializer serializer(&snapshot);
+      serializer.Serialize(stream);
+    }
+  }
+  fclose(edges_file);
+  ids_->RemoveDeadEntries();
+  is_tracking_object_moves_ = true;
+
+  heap()->isolate()->debug()->feature_tracker()->Track(
+      DebugFeatureTracker::kHeapSnapshot);
+
+  return result;
+}
+
 bool HeapProfiler::StartSamplingHeapProfiler(
     uint64_t sample_interval, int stack_depth,
     v8::HeapProfiler::SamplingFlags flags) {
@@ -29,6 +29,11 @@ class HeapProfiler {
   HeapSnapshot* TakeSnapshot(
       v8::ActivityControl* control,
       v8::HeapProfiler::ObjectNameResolver* resolver);
+  // Generates a snapshot that spills its edges to a temporary file and
+  // writes it to |stream| in the JSON format without retaining it.
+  bool TakeSnapshotToStream(v8::OutputStream* stream,
+                            v8::ActivityControl* control,
+                            v8::HeapProfiler::ObjectNameResolver* resolver);
 
   bool StartSamplingHeapProfiler(uint64_t sample_interval, int stack_depth,
                                  v8::HeapProfiler::SamplingFlags);
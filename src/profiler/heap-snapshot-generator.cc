@@ -63,7 +63,7 @@ void HeapEntry::SetNamedReference(HeapGraphEdge::Type type,
                                   const char* name,
                                   HeapEntry* entry) {
   HeapGraphEdge edge(type, name, this->index(), entry->index());
-  snapshot_->edges().Add(edge);
+  snapshot_->AddEdge(edge);
   ++children_count_;
 }
 
@@ -72,7 +72,7 @@ void HeapEntry::SetIndexedReference(HeapGraphEdge::Type type,
                                     int index,
                                     HeapEntry* entry) {
   HeapGraphEdge edge(type, index, this->index(), entry->index());
-  snapshot_->edges().Add(edge);
+  snapshot_->AddEdge(edge);
   ++children_count_;
 }
 
@@ -182,6 +182,8 @@ HeapSnapshot::HeapSnapshot(HeapProfiler* profiler)
     : profiler_(profiler),
       root_index_(HeapEntry::kNoEntry),
       gc_roots_index_(HeapEntry::kNoEntry),
+      edges_file_(NULL),
+      spilled_edges_count_(0),
       max_snapshot_js_object_id_(0) {
   STATIC_ASSERT(
       sizeof(HeapGraphEdge) ==
@@ -210,6 +212,16 @@ void HeapSnapshot::RememberLastJSObjectId() {
 }
 
 
+void HeapSnapshot::AddEdge(const HeapGraphEdge& edge) {
+  if (edges_file_ == NULL) {
+    edges_.Add(edge);
+    return;
+  }
+  // Write errors are checked with ferror() once the snapshot is generated.
+  if (fwrite(&edge, sizeof(edge), 1, edges_file_) == 1) ++spilled_edges_count_;
+}
+
+
 void HeapSnapshot::AddSyntheticRootEntries() {
   AddRootEntry();
   AddGcRootsEntry();
@@ -2522,7 +2534,7 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
-  snapshot_->FillChildren();
+  if (snapshot_->edges_file() == NULL) snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
   progress_counter_ = progress_total_;
@@ -2661,6 +2673,21 @@ class OutputStreamWriter {
 };
 
 
+// Lets an OutputStreamWriter write to a temporary file.
+class FileOutputStream : public v8::OutputStream {
+ public:
+  explicit FileOutputStream(FILE* file) : file_(file) {}
+  void EndOfStream() override {}
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    size_t written = fwrite(data, 1, size, file_);
+    return written == static_cast<size_t>(size) ? kContinue : kAbort;
+  }
+
+ private:
+  FILE* file_;
+};
+
+
 // type, name|index, to_node.
 const int HeapSnapshotJSONSerializer::kEdgeFieldsCount = 3;
 // type, name, id, self_size, edge_count, trace_node_id.
@@ -2673,9 +2700,25 @@ void HeapSnapshotJSONSerializer::Serialize(v8::OutputStream* stream) {
   }
   DCHECK(writer_ == NULL);
   writer_ = new OutputStreamWriter(stream);
+  FileOutputStream* strings_stream = NULL;
+  if (snapshot_->edges_file() != NULL) {
+    // Without a file the strings are kept in memory as usual.
+    strings_file_ = base::OS::OpenTemporaryFile();
+    if (strings_file_ != NULL) {
+      strings_stream = new FileOutputStream(strings_file_);
+      strings_writer_ = new OutputStreamWriter(strings_stream);
+    }
+  }
   SerializeImpl();
   delete writer_;
   writer_ = NULL;
+  if (strings_file_ != NULL) {
+    delete strings_writer_;
+    strings_writer_ = NULL;
+    delete strings_stream;
+    fclose(strings_file_);
+    strings_file_ = NULL;
+  }
 }
 
 
@@ -2712,6 +2755,7 @@ void HeapSnapshotJSONSerializer::SerializeImpl() {
   writer_->AddString("\"strings\":[");
   SerializeStrings();
   if (writer_->aborted()) return;
+  if (strings_writer_ != NULL && strings_writer_->aborted()) return;
   writer_->AddCharacter(']');
   writer_->AddCharacter('}');
   writer_->Finalize();
@@ -2719,10 +2763,20 @@ void HeapSnapshotJSONSerializer::SerializeImpl() {
 
 
 int HeapSnapshotJSONSerializer::GetStringId(const char* s) {
+  if (strings_writer_ != NULL &&
+      strings_.occupancy() >=
+          static_cast<uint32_t>(FLAG_heap_snapshot_streaming_buffer)) {
+    strings_.Clear();
+  }
   HashMap::Entry* cache_entry =
       strings_.LookupOrInsert(const_cast<char*>(s), StringHash(s));
   if (cache_entry->value == NULL) {
     cache_entry->value = reinterpret_cast<void*>(next_string_id_++);
+    if (strings_writer_ != NULL) {
+      strings_writer_->AddCharacter(',');
+      SerializeString(strings_writer_,
+                      reinterpret_cast<const unsigned char*>(s));
+    }
   }
   return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
 }
@@ -2772,7 +2826,7 @@ static int utoa(T value, const Vector<char>& buffer, int buffer_pos) {
 
 
 void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
-                                               bool first_edge) {
+                                               int to_index, bool first_edge) {
   // The buffer needs space for 3 unsigned ints, 3 commas, \n and \0
   static const int kBufferSize =
       MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned * 3 + 3 + 2;  // NOLINT
@@ -2788,7 +2842,7 @@ void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(edge_name_or_index, buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(entry_index(edge->to()), buffer, buffer_pos);
+  buffer_pos = utoa(to_index * kNodeFieldsCount, buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
   buffer[buffer_pos++] = '\0';
   writer_->AddString(buffer.start());
@@ -2796,16 +2850,132 @@ void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
 
 
 void HeapSnapshotJSONSerializer::SerializeEdges() {
+  if (snapshot_->edges_file() != NULL) {
+    SerializeSpilledEdges();
+    return;
+  }
   List<HeapGraphEdge*>& edges = snapshot_->children();
   for (int i = 0; i < edges.length(); ++i) {
     DCHECK(i == 0 ||
            edges[i - 1]->from()->index() <= edges[i]->from()->index());
-    SerializeEdge(edges[i], i == 0);
+    SerializeEdge(edges[i], edges[i]->to()->index(), i == 0);
     if (writer_->aborted()) return;
   }
 }
 
 
+void HeapSnapshotJSONSerializer::SerializeSpilledEdges() {
+  // The edges were spilled in the order they were found, but are written
+  // grouped by their source node. The nodes are split into windows whose
+  // edges fit into a bounded buffer. A single pass over the spill file
+  // distributes the edges into one region per window of a second file, from
+  // which the windows are then read in order and grouped by node in memory.
+  static const int kReadBufferSize = 1024;
+  FILE* spill_file = snapshot_->edges_file();
+  List<HeapEntry>& entries = snapshot_->entries();
+  int max_window_size = Max(FLAG_heap_snapshot_streaming_buffer, 1);
+  FILE* windows_file = base::OS::OpenTemporaryFile();
+  // Without a second file all edges have to be grouped in a single window.
+  if (windows_file == NULL) max_window_size = kMaxInt;
+
+  // The first node and the first edge of each window, with an end marker.
+  List<int> window_nodes;
+  List<int> window_edges;
+  int edge_count = 0;
+  for (int i = 0; i < entries.length(); ++i) {
+    // A window holds at least one node, whatever the number of its edges.
+    int children_count = entries[i].children_count();
+    if (i == 0 ||
+        edge_count - window_edges.last() + children_count > max_window_size ||
+        i - window_nodes.last() >= max_window_size) {
+      window_nodes.Add(i);
+      window_edges.Add(edge_count);
+    }
+    edge_count += children_count;
+  }
+  window_nodes.Add(entries.length());
+  window_edges.Add(edge_count);
+  int window_count = window_nodes.length() - 1;
+
+  List<HeapGraphEdge> read_buffer;
+  read_buffer.Allocate(kReadBufferSize);
+  if (windows_file != NULL) {
+    // Distribute the edges, buffering a share of the window size for each
+    // window to keep the writes to the file in blocks.
+    int block_size = Max(max_window_size / Max(window_count, 1), 1);
+    List<HeapGraphEdge> blocks;
+    blocks.Allocate(block_size * window_count);
+    List<int> block_lengths;
+    block_lengths.AddBlock(0, window_count);
+    List<int> written;
+    written.AddAll(window_edges);
+    auto flush = [&](int w) {
+      fseek(windows_file,
+            static_cast<long>(written[w]) * sizeof(HeapGraphEdge),  // NOLINT
+            SEEK_SET);
+      fwrite(&blocks[w * block_size], sizeof(HeapGraphEdge), block_lengths[w],
+             windows_file);
+      written[w] += block_lengths[w];
+      block_lengths[w] = 0;
+    };
+    rewind(spill_file);
+    size_t read;
+    while ((read = fread(&read_buffer.first(), sizeof(HeapGraphEdge),
+                         kReadBufferSize, spill_file)) > 0) {
+      for (size_t i = 0; i < read; ++i) {
+        const HeapGraphEdge& edge = read_buffer[static_cast<int>(i)];
+        int w = static_cast<int>(std::upper_bound(
+                    &window_nodes.first(), &window_nodes.first() + window_count,
+                    edge.from_index()) - &window_nodes.first()) - 1;
+        if (block_lengths[w] == block_size) flush(w);
+        blocks[w * block_size + block_lengths[w]++] = edge;
+      }
+    }
+    for (int w = 0; w < window_count; ++w) {
+      if (block_lengths[w] > 0) flush(w);
+    }
+    rewind(windows_file);
+  }
+
+  FILE* file = windows_file != NULL ? windows_file : spill_file;
+  if (windows_file == NULL) rewind(spill_file);
+  List<HeapGraphEdge> window;
+  List<int> next_positions;
+  bool first_edge = true;
+  for (int w = 0; w < window_count; ++w) {
+    int first = window_nodes[w];
+    int window_size = window_edges[w + 1] - window_edges[w];
+    next_positions.Rewind(0);
+    for (int i = first, position = 0; i < window_nodes[w + 1]; ++i) {
+      next_positions.Add(position);
+      position += entries[i].children_count();
+    }
+    if (window.length() < window_size) window.Allocate(window_size);
+    // The edges of the window come next in the file, in the order they were
+    // found, which they keep within each node.
+    int remaining = window_size;
+    while (remaining > 0) {
+      size_t read = fread(&read_buffer.first(), sizeof(HeapGraphEdge),
+                          Min(remaining, kReadBufferSize), file);
+      if (read == 0) break;
+      remaining -= static_cast<int>(read);
+      for (size_t i = 0; i < read; ++i) {
+        const HeapGraphEdge& edge = read_buffer[static_cast<int>(i)];
+        window[next_positions[edge.from_index() - first]++] = edge;
+      }
+    }
+    DCHECK_EQ(0, remaining);
+    for (int i = 0; i < window_size; ++i) {
+      SerializeEdge(&window[i], window[i].to_index(), first_edge);
+      first_edge = false;
+      if (writer_->aborted()) break;
+    }
+    if (writer_->aborted()) break;
+  }
+  if (windows_file != NULL) fclose(windows_file);
+}
+
+
 void HeapSnapshotJSONSerializer::SerializeNode(HeapEntry* entry) {
   // The buffer needs space for 4 unsigned ints, 1 size_t, 5 commas, \n and \0
   static const int kBufferSize =
@@ -2915,7 +3085,7 @@ void HeapSnapshotJSONSerializer::SerializeSnapshot() {
   writer_->AddString(",\"node_count\":");
   writer_->AddNumber(snapshot_->entries().length());
   writer_->AddString(",\"edge_count\":");
-  writer_->AddNumber(snapshot_->edges().length());
+  writer_->AddNumber(snapshot_->edges_count());
   writer_->AddString(",\"trace_function_count\":");
   uint32_t count = 0;
   AllocationTracker* tracker = snapshot_->profiler()->allocation_tracker();
@@ -3051,57 +3221,75 @@ void HeapSnapshotJSONSerializer::SerializeSamples() {
 }
 
 
-void HeapSnapshotJSONSerializer::SerializeString(const unsigned char* s) {
-  writer_->AddCharacter('\n');
-  writer_->AddCharacter('\"');
+void HeapSnapshotJSONSerializer::SerializeString(OutputStreamWriter* writer,
+                                                 const unsigned char* s) {
+  writer->AddCharacter('\n');
+  writer->AddCharacter('\"');
   for ( ; *s != '\0'; ++s) {
     switch (*s) {
       case '\b':
-        writer_->AddString("\\b");
+        writer->AddString("\\b");
         continue;
       case '\f':
-        writer_->AddString("\\f");
+        writer->AddString("\\f");
         continue;
       case '\n':
-        writer_->AddString("\\n");
+        writer->AddString("\\n");
         continue;
       case '\r':
-        writer_->AddString("\\r");
+        writer->AddString("\\r");
         continue;
       case '\t':
-        writer_->AddString("\\t");
+        writer->AddString("\\t");
         continue;
       case '\"':
       case '\\':
-        writer_->AddCharacter('\\');
-        writer_->AddCharacter(*s);
+        writer->AddCharacter('\\');
+        writer->AddCharacter(*s);
         continue;
       default:
         if (*s > 31 && *s < 128) {
-          writer_->AddCharacter(*s);
+          writer->AddCharacter(*s);
         } else if (*s <= 31) {
           // Special character with no dedicated literal.
-          WriteUChar(writer_, *s);
+          WriteUChar(writer, *s);
         } else {
           // Convert UTF-8 into \u UTF-16 literal.
           size_t length = 1, cursor = 0;
           for ( ; length <= 4 && *(s + length) != '\0'; ++length) { }
           unibrow::uchar c = unibrow::Utf8::CalculateValue(s, length, &cursor);
           if (c != unibrow::Utf8::kBadChar) {
-            WriteUChar(writer_, c);
+            WriteUChar(writer, c);
             DCHECK(cursor != 0);
             s += cursor - 1;
           } else {
-            writer_->AddCharacter('?');
+            writer->AddCharacter('?');
           }
         }
     }
   }
-  writer_->AddCharacter('\"');
+  writer->AddCharacter('\"');
 }
 
 
 void HeapSnapshotJSONSerializer::SerializeStrings() {
+  if (strings_writer_ != NULL) {
+    // The strings have already been written in id order, each preceded by a
+    // comma.
+    writer_->AddString("\"<dummy>\"");
+    strings_writer_->Finalize();
+    if (strings_writer_->aborted()) return;
+    rewind(strings_file_);
+    static const int kBufferSize = 4096;
+    EmbeddedVector<char, kBufferSize + 1> buffer;
+    size_t read;
+    while ((read = fread(buffer.start(), 1, kBufferSize, strings_file_)) > 0) {
+      buffer[static_cast<int>(read)] = '\0';
+      writer_->AddSubstring(buffer.start(), static_cast<int>(read));
+      if (writer_->aborted()) return;
+    }
+    return;
+  }
   ScopedVector<const unsigned char*> sorted_strings(
       strings_.occupancy() + 1);
   for (HashMap::Entry* entry = strings_.Start();
@@ -3113,7 +3301,7 @@ void HeapSnapshotJSONSerializer::SerializeStrings() {
   writer_->AddString("\"<dummy>\"");
   for (int i = 1; i < sorted_strings.length(); ++i) {
     writer_->AddCharacter(',');
-    SerializeString(sorted_strings[i]);
+    SerializeString(writer_, sorted_strings[i]);
     if (writer_->aborted()) return;
   }
 }
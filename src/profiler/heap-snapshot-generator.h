@@ -52,9 +52,13 @@ class HeapGraphEdge BASE_EMBEDDED {
 
   INLINE(Isolate* isolate() const);
 
+  int from_index() const { return FromIndexField::decode(bit_field_); }
+  // Only valid until HeapSnapshot::FillChildren has attached the edge to its
+  // target entry, which never happens for spilled edges.
+  int to_index() const { return to_index_; }
+
  private:
   INLINE(HeapSnapshot* snapshot() const);
-  int from_index() const { return FromIndexField::decode(bit_field_); }
 
   class TypeField : public BitField<Type, 0, 3> {};
   class FromIndexField : public BitField<int, 3, 29> {};
@@ -163,6 +167,14 @@ class HeapSnapshot {
   List<HeapEntry>& entries() { return entries_; }
   List<HeapGraphEdge>& edges() { return edges_; }
   List<HeapGraphEdge*>& children() { return children_; }
+  int edges_count() const {
+    return edges_file_ != NULL ? spilled_edges_count_ : edges_.length();
+  }
+  // Makes the snapshot write its edges to |file| in the order they are added
+  // instead of keeping them in memory. Such a snapshot can only be
+  // serialized, see HeapProfiler::TakeSnapshotToStream.
+  void SpillEdgesTo(FILE* file) { edges_file_ = file; }
+  FILE* edges_file() const { return edges_file_; }
   void RememberLastJSObjectId();
   SnapshotObjectId max_snapshot_js_object_id() const {
     return max_snapshot_js_object_id_;
@@ -173,6 +185,7 @@ class HeapSnapshot {
                       SnapshotObjectId id,
                       size_t size,
                       unsigned trace_node_id);
+  void AddEdge(const HeapGraphEdge& edge);
   void AddSyntheticRootEntries();
   HeapEntry* GetEntryById(SnapshotObjectId id);
   List<HeapEntry*>* GetSortedEntriesList();
@@ -193,6 +206,8 @@ class HeapSnapshot {
   List<HeapGraphEdge> edges_;
   List<HeapGraphEdge*> children_;
   List<HeapEntry*> sorted_entries_;
+  FILE* edges_file_;
+  int spilled_edges_count_;
   SnapshotObjectId max_snapshot_js_object_id_;
 
   friend class HeapSnapshotTester;
@@ -573,7 +588,9 @@ class HeapSnapshotJSONSerializer {
         strings_(StringsMatch),
         next_node_id_(1),
         next_string_id_(1),
-        writer_(NULL) {
+        writer_(NULL),
+        strings_file_(NULL),
+        strings_writer_(NULL) {
   }
   void Serialize(v8::OutputStream* stream);
 
@@ -592,8 +609,9 @@ class HeapSnapshotJSONSerializer {
 
   int GetStringId(const char* s);
   int entry_index(HeapEntry* e) { return e->index() * kNodeFieldsCount; }
-  void SerializeEdge(HeapGraphEdge* edge, bool first_edge);
+  void SerializeEdge(HeapGraphEdge* edge, int to_index, bool first_edge);
   void SerializeEdges();
+  void SerializeSpilledEdges();
   void SerializeImpl();
   void SerializeNode(HeapEntry* entry);
   void SerializeNodes();
@@ -602,7 +620,7 @@ class HeapSnapshotJSONSerializer {
   void SerializeTraceNode(AllocationTraceNode* node);
   void SerializeTraceNodeInfos();
   void SerializeSamples();
-  void SerializeString(const unsigned char* s);
+  void SerializeString(OutputStreamWriter* writer, const unsigned char* s);
   void SerializeStrings();
 
   static const int kEdgeFieldsCount;
@@ -613,6 +631,12 @@ class HeapSnapshotJSONSerializer {
   int next_node_id_;
   int next_string_id_;
   OutputStreamWriter* writer_;
+  // When the edges of the snapshot were spilled, strings are written to a
+  // temporary file as soon as they get an id, and |strings_| only caches a
+  // bounded number of them. Evicted strings may then be written again under
+  // a new id.
+  FILE* strings_file_;
+  OutputStreamWriter* strings_writer_;
 
   friend class HeapSnapshotJSONSerializerEnumerator;
   friend class HeapSnapshotJSONSerializerIterator;
@@ -30,9 +30,11 @@ CodeEntry::CodeEntry(Logger::LogEventsAndTags tag, const char* name,
       instruction_start_(instruction_start) {}
 
 
-ProfileNode::ProfileNode(ProfileTree* tree, CodeEntry* entry)
+ProfileNode::ProfileNode(ProfileTree* tree, CodeEntry* entry,
+                         ProfileNode* parent)
     : tree_(tree),
       entry_(entry),
+      parent_(parent),
       self_ticks_(0),
       children_(CodeEntriesMatch),
       id_(tree->next_node_id()),
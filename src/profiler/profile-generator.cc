@@ -182,9 +182,10 @@ ProfileNode* ProfileNode::FindOrAddChild(CodeEntry* entry) {
   ProfileNode* node = reinterpret_cast<ProfileNode*>(map_entry->value);
   if (node == NULL) {
     // New node added.
-    node = new ProfileNode(tree_, entry);
+    node = new ProfileNode(tree_, entry, this);
     map_entry->value = node;
     children_list_.Add(node);
+    tree_->EnqueueNode(node);
   }
   return node;
 }
@@ -273,10 +274,11 @@ class DeleteNodesCallback {
 ProfileTree::ProfileTree(Isolate* isolate)
     : root_entry_(Logger::FUNCTION_TAG, "(root)"),
       next_node_id_(1),
-      root_(new ProfileNode(this, &root_entry_)),
+      root_(new ProfileNode(this, &root_entry_, NULL)),
       isolate_(isolate),
       next_function_id_(1),
-      function_ids_(ProfileNode::CodeEntriesMatch) {}
+      function_ids_(ProfileNode::CodeEntriesMatch),
+      track_new_nodes_(false) {}
 
 
 ProfileTree::~ProfileTree() {
@@ -295,6 +297,14 @@ unsigned ProfileTree::GetFunctionId(const ProfileNode* node) {
   return static_cast<unsigned>(reinterpret_cast<uintptr_t>(entry->value));
 }
 
+
+void ProfileTree::StartTrackingNewNodes() {
+  DCHECK(!track_new_nodes_);
+  DCHECK_EQ(0, root_->children()->length());
+  track_new_nodes_ = true;
+  pending_nodes_.push_back(root_);
+}
+
 ProfileNode* ProfileTree::AddPathFromEnd(const std::vector<CodeEntry*>& path,
                                          int src_line, bool update_stats) {
   ProfileNode* node = root_;
@@ -367,24 +377,73 @@ void ProfileTree::TraverseDepthFirst(Callback* callback) {
 }
 
 
-CpuProfile::CpuProfile(Isolate* isolate, const char* title, bool record_samples)
+CpuProfile::CpuProfile(Isolate* isolate, const char* title, bool record_samples,
+                       v8::CpuProfileChunkListener* chunk_listener,
+                       base::TimeDelta chunk_interval)
     : title_(title),
       record_samples_(record_samples),
       start_time_(base::TimeTicks::HighResolutionNow()),
-      top_down_(isolate) {}
+      top_down_(isolate),
+      chunk_listener_(chunk_listener),
+      chunk_interval_(chunk_interval),
+      last_chunk_time_(start_time_),
+      last_sample_time_(start_time_) {
+  if (chunk_listener_ != NULL) top_down_.StartTrackingNewNodes();
+}
 
 void CpuProfile::AddPath(base::TimeTicks timestamp,
                          const std::vector<CodeEntry*>& path, int src_line,
                          bool update_stats) {
   ProfileNode* top_frame_node =
       top_down_.AddPathFromEnd(path, src_line, update_stats);
-  if (record_samples_ && !timestamp.IsNull()) {
+  if (timestamp.IsNull()) return;
+  if (chunk_listener_ != NULL) {
+    pending_samples_.push_back(top_frame_node->id());
+    pending_time_deltas_.push_back(
+        static_cast<int>((timestamp - last_sample_time_).InMicroseconds()));
+    last_sample_time_ = timestamp;
+    if (timestamp - last_chunk_time_ >= chunk_interval_) {
+      StreamPendingChunk();
+      last_chunk_time_ = timestamp;
+    }
+  } else if (record_samples_) {
     timestamps_.Add(timestamp);
     samples_.Add(top_frame_node);
   }
 }
 
 
+void CpuProfile::StreamPendingChunk() {
+  if (chunk_listener_ == NULL) return;
+  top_down_.TakePendingNodes(&chunk_nodes_);
+  if (chunk_nodes_.empty() && pending_samples_.empty()) return;
+  // The vectors keep their capacity, so a steady stream of chunks does not
+  // allocate.
+  chunk_node_data_.clear();
+  for (const ProfileNode* node : chunk_nodes_) {
+    const CodeEntry* entry = node->entry();
+    v8::CpuProfileChunk::Node data;
+    data.id = node->id();
+    data.parent_id = node->parent() != NULL ? node->parent()->id() : 0;
+    data.function_name = entry->name();
+    data.resource_name = entry->resource_name();
+    data.script_id = entry->script_id();
+    data.line_number = entry->line_number();
+    data.column_number = entry->column_number();
+    chunk_node_data_.push_back(data);
+  }
+  v8::CpuProfileChunk chunk;
+  chunk.nodes = chunk_node_data_.data();
+  chunk.nodes_count = static_cast<int>(chunk_node_data_.size());
+  chunk.samples = pending_samples_.data();
+  chunk.time_deltas = pending_time_deltas_.data();
+  chunk.samples_count = static_cast<int>(pending_samples_.size());
+  chunk_listener_->OnChunk(chunk);
+  pending_samples_.clear();
+  pending_time_deltas_.clear();
+}
+
+
 void CpuProfile::CalculateTotalTicksAndSamplingRate() {
   end_time_ = base::TimeTicks::HighResolutionNow();
 }
@@ -483,8 +542,10 @@ CpuProfilesCollection::~CpuProfilesCollection() {
 }
 
 
-bool CpuProfilesCollection::StartProfiling(const char* title,
-                                           bool record_samples) {
+bool CpuProfilesCollection::StartProfiling(
+    const char* title, bool record_samples,
+    v8::CpuProfileChunkListener* chunk_listener,
+    base::TimeDelta chunk_interval) {
   current_profiles_semaphore_.Wait();
   if (current_profiles_.length() >= kMaxSimultaneousProfiles) {
     current_profiles_semaphore_.Signal();
@@ -498,7 +559,8 @@ bool CpuProfilesCollection::StartProfiling(const char* title,
       return true;
     }
   }
-  current_profiles_.Add(new CpuProfile(isolate_, title, record_samples));
+  current_profiles_.Add(new CpuProfile(isolate_, title, record_samples,
+                                       chunk_listener, chunk_interval));
   current_profiles_semaphore_.Signal();
   return true;
 }
@@ -518,6 +580,7 @@ CpuProfile* CpuProfilesCollection::StopProfiling(const char* title) {
 
   if (profile == NULL) return NULL;
   profile->CalculateTotalTicksAndSamplingRate();
+  profile->StreamPendingChunk();
   finished_profiles_.Add(profile);
   return profile;
 }
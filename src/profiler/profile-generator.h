@@ -142,7 +142,7 @@ class ProfileTree;
 
 class ProfileNode {
  public:
-  inline ProfileNode(ProfileTree* tree, CodeEntry* entry);
+  inline ProfileNode(ProfileTree* tree, CodeEntry* entry, ProfileNode* parent);
 
   ProfileNode* FindChild(CodeEntry* entry);
   ProfileNode* FindOrAddChild(CodeEntry* entry);
@@ -151,6 +151,7 @@ class ProfileNode {
   void IncrementLineTicks(int src_line);
 
   CodeEntry* entry() const { return entry_; }
+  ProfileNode* parent() const { return parent_; }
   unsigned self_ticks() const { return self_ticks_; }
   const List<ProfileNode*>* children() const { return &children_list_; }
   unsigned id() const { return id_; }
@@ -178,6 +179,7 @@ class ProfileNode {
 
   ProfileTree* tree_;
   CodeEntry* entry_;
+  ProfileNode* parent_;
   unsigned self_ticks_;
   // Mapping from CodeEntry* to ProfileNode*
   HashMap children_;
@@ -204,6 +206,17 @@ class ProfileTree {
   unsigned next_node_id() { return next_node_id_++; }
   unsigned GetFunctionId(const ProfileNode* node);
 
+  // Remembers nodes added from now on, starting with the root, until they
+  // are taken with TakePendingNodes.
+  void StartTrackingNewNodes();
+  void EnqueueNode(const ProfileNode* node) {
+    if (track_new_nodes_) pending_nodes_.push_back(node);
+  }
+  void TakePendingNodes(std::vector<const ProfileNode*>* nodes) {
+    nodes->swap(pending_nodes_);
+    pending_nodes_.clear();
+  }
+
   void Print() {
     root_->Print(0);
   }
@@ -222,19 +235,28 @@ class ProfileTree {
   unsigned next_function_id_;
   HashMap function_ids_;
 
+  bool track_new_nodes_;
+  std::vector<const ProfileNode*> pending_nodes_;
+
   DISALLOW_COPY_AND_ASSIGN(ProfileTree);
 };
 
 
 class CpuProfile {
  public:
-  CpuProfile(Isolate* isolate, const char* title, bool record_samples);
+  CpuProfile(Isolate* isolate, const char* title, bool record_samples,
+             v8::CpuProfileChunkListener* chunk_listener = NULL,
+             base::TimeDelta chunk_interval = base::TimeDelta());
 
   // Add pc -> ... -> main() call path to the profile.
   void AddPath(base::TimeTicks timestamp, const std::vector<CodeEntry*>& path,
                int src_line, bool update_stats);
   void CalculateTotalTicksAndSamplingRate();
 
+  // Passes the samples and nodes added since the last chunk to the chunk
+  // listener of a streaming profile.
+  void StreamPendingChunk();
+
   const char* title() const { return title_; }
   const ProfileTree* top_down() const { return &top_down_; }
 
@@ -260,6 +282,16 @@ class CpuProfile {
   List<base::TimeTicks> timestamps_;
   ProfileTree top_down_;
 
+  // Only used by streaming profiles, which do not keep samples_.
+  v8::CpuProfileChunkListener* chunk_listener_;
+  base::TimeDelta chunk_interval_;
+  base::TimeTicks last_chunk_time_;
+  base::TimeTicks last_sample_time_;
+  std::vector<unsigned> pending_samples_;
+  std::vector<int> pending_time_deltas_;
+  std::vector<const ProfileNode*> chunk_nodes_;
+  std::vector<v8::CpuProfileChunk::Node> chunk_node_data_;
+
   DISALLOW_COPY_AND_ASSIGN(CpuProfile);
 };
 
@@ -312,7 +344,9 @@ class CpuProfilesCollection {
   explicit CpuProfilesCollection(Heap* heap);
   ~CpuProfilesCollection();
 
-  bool StartProfiling(const char* title, bool record_samples);
+  bool StartProfiling(const char* title, bool record_samples,
+                      v8::CpuProfileChunkListener* chunk_listener = NULL,
+                      base::TimeDelta chunk_interval = base::TimeDelta());
   CpuProfile* StopProfiling(const char* title);
   List<CpuProfile*>* profiles() { return &finished_profiles_; }
   const char* GetName(Name* name) {
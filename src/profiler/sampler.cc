@@ -36,6 +36,19 @@
 #include <asm/sigcontext.h>  // NOLINT
 #endif
 
+// Linux can send SIGPROF to a thread whenever it has used up a slice of CPU
+// time, so the VM threads do not have to be signalled by the sampler thread.
+#if V8_OS_LINUX && !V8_OS_NACL
+#define USE_THREAD_CPU_TIMERS
+#include <time.h>
+#ifndef SIGEV_THREAD_ID
+#define SIGEV_THREAD_ID 4
+#endif
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+
 #elif V8_OS_WIN || V8_OS_CYGWIN
 
 #include "src/base/win32-headers.h"
@@ -224,11 +237,50 @@ uint32_t ThreadHash(pthread_t thread_id) {
 
 class Sampler::PlatformData : public PlatformDataCommon {
  public:
+#if defined(USE_THREAD_CPU_TIMERS)
+  PlatformData()
+      : vm_tid_(pthread_self()),
+        vm_kernel_tid_(base::OS::GetCurrentThreadId()),
+        uses_cpu_timer_(false) {}
+#else
   PlatformData() : vm_tid_(pthread_self()) {}
+#endif
   pthread_t vm_tid() const { return vm_tid_; }
 
+#if defined(USE_THREAD_CPU_TIMERS)
+  // Creates a timer that makes the kernel send SIGPROF to the VM thread every
+  // |interval_ms| of CPU time it uses. Returns false if the timer cannot be
+  // set up.
+  bool CreateCpuTimer(int interval_ms, timer_t* timer) {
+    clockid_t clock;
+    if (pthread_getcpuclockid(vm_tid_, &clock) != 0) return false;
+    struct sigevent event;
+    memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_THREAD_ID;
+    event.sigev_signo = SIGPROF;
+    event.sigev_notify_thread_id = vm_kernel_tid_;
+    if (timer_create(clock, &event, timer) != 0) return false;
+    struct itimerspec spec;
+    spec.it_interval.tv_sec = interval_ms / 1000;
+    spec.it_interval.tv_nsec = (interval_ms % 1000) * 1000000;
+    spec.it_value = spec.it_interval;
+    if (timer_settime(*timer, 0, &spec, NULL) != 0) {
+      timer_delete(*timer);
+      return false;
+    }
+    return true;
+  }
+
+  bool uses_cpu_timer() const { return uses_cpu_timer_; }
+  void set_uses_cpu_timer(bool value) { uses_cpu_timer_ = value; }
+#endif  // USE_THREAD_CPU_TIMERS
+
  private:
   pthread_t vm_tid_;
+#if defined(USE_THREAD_CPU_TIMERS)
+  int vm_kernel_tid_;
+  bool uses_cpu_timer_;
+#endif  // USE_THREAD_CPU_TIMERS
 };
 
 #elif V8_OS_WIN || V8_OS_CYGWIN
@@ -582,6 +634,56 @@ class SamplerThread : public base::Thread {
 #endif  // USE_SIGNALS
   }
 
+#if defined(USE_THREAD_CPU_TIMERS)
+  // Registers a sampler that is driven by the CPU time timer of its VM
+  // thread. Each SIGPROF samples all samplers of the thread, so they share
+  // one timer. Returns false if the timer cannot be set up.
+  static bool AddCpuTimerSampler(Sampler* sampler) {
+    base::LockGuard<base::Mutex> lock_guard(mutex_);
+    pthread_t thread_id = sampler->platform_data()->vm_tid();
+    HashMap::Entry* entry = thread_id_to_cpu_timer_.Pointer()->LookupOrInsert(
+        ThreadKey(thread_id), ThreadHash(thread_id));
+    CpuTimer* timer = reinterpret_cast<CpuTimer*>(entry->value);
+    if (timer == NULL) {
+      timer = new CpuTimer();
+      if (!sampler->platform_data()->CreateCpuTimer(sampler->interval(),
+                                                    &timer->id)) {
+        delete timer;
+        thread_id_to_cpu_timer_.Pointer()->Remove(ThreadKey(thread_id),
+                                                  ThreadHash(thread_id));
+        return false;
+      }
+      timer->sampler_count = 0;
+      entry->value = timer;
+    }
+    timer->sampler_count++;
+    sampler->platform_data()->set_uses_cpu_timer(true);
+    AddSampler(sampler);
+    return true;
+  }
+
+  // Deletes the timer of the sampler's VM thread once its last sampler is
+  // gone, and unregisters the sampler.
+  static void RemoveCpuTimerSampler(Sampler* sampler) {
+    {
+      base::LockGuard<base::Mutex> lock_guard(mutex_);
+      pthread_t thread_id = sampler->platform_data()->vm_tid();
+      HashMap::Entry* entry = thread_id_to_cpu_timer_.Get().Lookup(
+          ThreadKey(thread_id), ThreadHash(thread_id));
+      DCHECK(entry != NULL);
+      CpuTimer* timer = reinterpret_cast<CpuTimer*>(entry->value);
+      if (--timer->sampler_count == 0) {
+        timer_delete(timer->id);
+        delete timer;
+        thread_id_to_cpu_timer_.Pointer()->Remove(ThreadKey(thread_id),
+                                                  ThreadHash(thread_id));
+      }
+      sampler->platform_data()->set_uses_cpu_timer(false);
+    }
+    RemoveSampler(sampler);
+  }
+#endif  // USE_THREAD_CPU_TIMERS
+
   // Implement Thread::Run().
   virtual void Run() {
     while (true) {
@@ -634,6 +736,14 @@ class SamplerThread : public base::Thread {
   static base::LazyInstance<HashMap, HashMapCreateTrait>::type
       thread_id_to_samplers_;
   static base::AtomicValue<int> sampler_list_access_counter_;
+#if defined(USE_THREAD_CPU_TIMERS)
+  struct CpuTimer {
+    timer_t id;
+    int sampler_count;
+  };
+  static base::LazyInstance<HashMap, HashMapCreateTrait>::type
+      thread_id_to_cpu_timer_;
+#endif  // USE_THREAD_CPU_TIMERS
   static void AddSampler(Sampler* sampler) {
     AtomicGuard atomic_guard(&sampler_list_access_counter_);
     // Add sampler into map if needed.
@@ -666,6 +776,10 @@ SamplerThread* SamplerThread::instance_ = NULL;
 base::LazyInstance<HashMap, SamplerThread::HashMapCreateTrait>::type
     SamplerThread::thread_id_to_samplers_ = LAZY_INSTANCE_INITIALIZER;
 base::AtomicValue<int> SamplerThread::sampler_list_access_counter_(0);
+#if defined(USE_THREAD_CPU_TIMERS)
+base::LazyInstance<HashMap, SamplerThread::HashMapCreateTrait>::type
+    SamplerThread::thread_id_to_cpu_timer_ = LAZY_INSTANCE_INITIALIZER;
+#endif  // USE_THREAD_CPU_TIMERS
 
 // As Native Client does not support signal handling, profiling is disabled.
 #if !V8_OS_NACL
@@ -730,12 +844,30 @@ Sampler::~Sampler() {
 void Sampler::Start() {
   DCHECK(!IsActive());
   SetActive(true);
+#if defined(USE_THREAD_CPU_TIMERS)
+  if (FLAG_prof_cpu_timers) {
+    // The signal handler has to stay installed while the timer can fire,
+    // otherwise SIGPROF would terminate the process.
+    SignalHandler::IncreaseSamplerCount();
+    if (SamplerThread::AddCpuTimerSampler(this)) return;
+    SignalHandler::DecreaseSamplerCount();
+  }
+#endif  // USE_THREAD_CPU_TIMERS
   SamplerThread::AddActiveSampler(this);
 }
 
 
 void Sampler::Stop() {
   DCHECK(IsActive());
+#if defined(USE_THREAD_CPU_TIMERS)
+  if (platform_data()->uses_cpu_timer()) {
+    SamplerThread::RemoveCpuTimerSampler(this);
+    SignalHandler::DecreaseSamplerCount();
+    SetActive(false);
+    SetRegistered(false);
+    return;
+  }
+#endif  // USE_THREAD_CPU_TIMERS
   SamplerThread::RemoveSampler(this);
   SetActive(false);
   SetRegistered(false);
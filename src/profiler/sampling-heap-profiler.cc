@@ -63,7 +63,8 @@ SamplingHeapProfiler::SamplingHeapProfiler(
       samples_(),
       stack_depth_(stack_depth),
       rate_(rate),
-      flags_(flags) {
+      flags_(flags),
+      start_time_ms_(heap->MonotonicallyIncreasingTimeInMs()) {
   CHECK_GT(rate_, 0);
   heap->new_space()->AddAllocationObserver(new_space_observer_.get());
   AllSpaces spaces(heap);
@@ -108,7 +109,11 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
 
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
-  Sample* sample = new Sample(size, node, loc, this);
+  node->allocated_[size]++;
+  Sample* sample =
+      new Sample(size, node, loc, this,
+                 heap()->MonotonicallyIncreasingTimeInMs() - start_time_ms_,
+                 heap()->gc_count());
   samples_.insert(sample);
   sample->global.SetWeak(sample, OnWeakCallback, WeakCallbackType::kParameter);
   sample->global.MarkIndependent();
@@ -122,8 +127,11 @@ void SamplingHeapProfiler::OnWeakCallback(
   node->allocations_[sample->size]--;
   if (node->allocations_[sample->size] == 0) {
     node->allocations_.erase(sample->size);
-    while (node->allocations_.empty() && node->children_.empty() &&
-           node->parent_ && !node->parent_->pinned_) {
+    bool keep_sites = sample->profiler->flags_ &
+                      v8::HeapProfiler::kSamplingKeepCollectedSites;
+    while (!keep_sites && node->allocations_.empty() &&
+           node->children_.empty() && node->parent_ &&
+           !node->parent_->pinned_) {
       AllocationNode* parent = node->parent_;
       AllocationNode::FunctionId id = AllocationNode::function_id(
           node->script_id_, node->script_position_, node->name_);
@@ -208,7 +216,9 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
 
 v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
     AllocationProfile* profile, SamplingHeapProfiler::AllocationNode* node,
-    const std::map<int, Handle<Script>>& scripts) {
+    const std::map<int, Handle<Script>>& scripts,
+    std::map<AllocationNode*, std::vector<v8::AllocationProfile::Sample>>*
+        samples) {
   // By pinning the node we make sure its children won't get disposed if
   // a GC kicks in during the tree retrieval.
   node->pinned_ = true;
@@ -234,15 +244,27 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
       column = 1 + Script::GetColumnNumber(script, node->script_position_);
     }
   }
+  size_t retained_size = 0;
   for (auto alloc : node->allocations_) {
     allocations.push_back(ScaleSample(alloc.first, alloc.second));
+    retained_size += allocations.back().size * allocations.back().count;
   }
+  size_t allocated_size = 0;
+  for (auto alloc : node->allocated_) {
+    v8::AllocationProfile::Allocation scaled =
+        ScaleSample(alloc.first, alloc.second);
+    allocated_size += scaled.size * scaled.count;
+  }
+  std::vector<v8::AllocationProfile::Sample> node_samples;
+  auto samples_it = samples->find(node);
+  if (samples_it != samples->end()) node_samples.swap(samples_it->second);
 
   profile->nodes().push_back(v8::AllocationProfile::Node(
       {ToApiHandle<v8::String>(
            isolate_->factory()->InternalizeUtf8String(node->name_)),
        script_name, node->script_id_, node->script_position_, line, column,
-       std::vector<v8::AllocationProfile::Node*>(), allocations}));
+       std::vector<v8::AllocationProfile::Node*>(), allocations, node_samples,
+       allocated_size, retained_size}));
   v8::AllocationProfile::Node* current = &profile->nodes().back();
   // The children map may have nodes inserted into it during translation
   // because the translation may allocate strings on the JS heap that have
@@ -250,7 +272,7 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
   // invalidated upon std::map insertion.
   for (auto it : node->children_) {
     current->children.push_back(
-        TranslateAllocationNode(profile, it.second, scripts));
+        TranslateAllocationNode(profile, it.second, scripts, samples));
   }
   node->pinned_ = false;
   return current;
@@ -270,8 +292,18 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
       scripts[script->id()] = handle(script);
     }
   }
+  // Copy the live samples first, as some of them may be collected while the
+  // profile is built.
+  std::map<AllocationNode*, std::vector<v8::AllocationProfile::Sample>>
+      samples;
+  int gc_count = heap()->gc_count();
+  for (Sample* sample : samples_) {
+    samples[sample->owner].push_back(
+        {sample->size, sample->time_ms,
+         static_cast<unsigned int>(gc_count - sample->gc_count)});
+  }
   auto profile = new v8::internal::AllocationProfile();
-  TranslateAllocationNode(profile, &profile_root_, scripts);
+  TranslateAllocationNode(profile, &profile_root_, scripts, &samples);
   return profile;
 }
 
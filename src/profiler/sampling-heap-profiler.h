@@ -53,17 +53,23 @@ class SamplingHeapProfiler {
   struct Sample {
    public:
     Sample(size_t size_, AllocationNode* owner_, Local<Value> local_,
-           SamplingHeapProfiler* profiler_)
+           SamplingHeapProfiler* profiler_, double time_ms_, int gc_count_)
         : size(size_),
           owner(owner_),
           global(Global<Value>(
               reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_)),
-          profiler(profiler_) {}
+          profiler(profiler_),
+          time_ms(time_ms_),
+          gc_count(gc_count_) {}
     ~Sample() { global.Reset(); }
     const size_t size;
     AllocationNode* const owner;
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
+    // Time of the allocation relative to the start of the profiler.
+    const double time_ms;
+    // Heap::gc_count() at the time of the allocation.
+    const int gc_count;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
@@ -106,6 +112,8 @@ class SamplingHeapProfiler {
     // TODO(alph): make use of unordered_map's here. Pay attention to
     // iterator invalidation during TranslateAllocationNode.
     std::map<size_t, unsigned int> allocations_;
+    // All sampled allocations by size, including collected ones.
+    std::map<size_t, unsigned int> allocated_;
     std::map<FunctionId, AllocationNode*> children_;
     AllocationNode* const parent_;
     const int script_id_;
@@ -134,7 +142,9 @@ class SamplingHeapProfiler {
   // loaded scripts keyed by their script id.
   v8::AllocationProfile::Node* TranslateAllocationNode(
       AllocationProfile* profile, SamplingHeapProfiler::AllocationNode* node,
-      const std::map<int, Handle<Script>>& scripts);
+      const std::map<int, Handle<Script>>& scripts,
+      std::map<AllocationNode*, std::vector<v8::AllocationProfile::Sample>>*
+          samples);
   v8::AllocationProfile::Allocation ScaleSample(size_t size,
                                                 unsigned int count);
   AllocationNode* AddStack();
@@ -149,6 +159,7 @@ class SamplingHeapProfiler {
   const int stack_depth_;
   const uint64_t rate_;
   v8::HeapProfiler::SamplingFlags flags_;
+  const double start_time_ms_;
 
   friend class SamplingAllocationObserver;
 };
@@ -124,6 +124,7 @@ RegExpMacroAssemblerARM::~RegExpMacroAssemblerARM() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_to_nfa_label_.Unuse();
 }
 
 
@@ -618,6 +619,11 @@ void RegExpMacroAssemblerARM::Fail() {
 }
 
 
+void RegExpMacroAssemblerARM::FallbackToNfa() {
+  __ jmp(&fallback_to_nfa_label_);
+}
+
+
 Handle<HeapObject> RegExpMacroAssemblerARM::GetCode(Handle<String> source) {
   Label return_r0;
   // Finalize code - write the entry point code now we know how many
@@ -887,6 +893,13 @@ Handle<HeapObject> RegExpMacroAssemblerARM::GetCode(Handle<String> source) {
     __ jmp(&return_r0);
   }
 
+  if (fallback_to_nfa_label_.is_linked()) {
+    // Exit with Result FALLBACK_TO_NFA(-3) if the backtrack limit was hit.
+    __ bind(&fallback_to_nfa_label_);
+    __ mov(r0, Operand(FALLBACK_TO_NFA));
+    __ jmp(&return_r0);
+  }
+
   CodeDesc code_desc;
   masm_->GetCode(&code_desc);
   Handle<Code> code = isolate()->factory()->NewCode(
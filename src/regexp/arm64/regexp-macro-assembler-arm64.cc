@@ -143,6 +143,7 @@ RegExpMacroAssemblerARM64::~RegExpMacroAssemblerARM64() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_to_nfa_label_.Unuse();
 }
 
 int RegExpMacroAssemblerARM64::stack_limit_slack()  {
@@ -694,6 +695,11 @@ void RegExpMacroAssemblerARM64::Fail() {
 }
 
 
+void RegExpMacroAssemblerARM64::FallbackToNfa() {
+  __ B(&fallback_to_nfa_label_);
+}
+
+
 Handle<HeapObject> RegExpMacroAssemblerARM64::GetCode(Handle<String> source) {
   Label return_w0;
   // Finalize code - write the entry point code now we know how many
@@ -1084,6 +1090,13 @@ Handle<HeapObject> RegExpMacroAssemblerARM64::GetCode(Handle<String> source) {
     __ B(&return_w0);
   }
 
+  if (fallback_to_nfa_label_.is_linked()) {
+    // Exit with Result FALLBACK_TO_NFA(-3) if the backtrack limit was hit.
+    __ Bind(&fallback_to_nfa_label_);
+    __ Mov(w0, FALLBACK_TO_NFA);
+    __ B(&return_w0);
+  }
+
   CodeDesc code_desc;
   masm_->GetCode(&code_desc);
   Handle<Code> code = isolate()->factory()->NewCode(
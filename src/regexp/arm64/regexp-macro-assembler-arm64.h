@@ -67,6 +67,7 @@ class RegExpMacroAssemblerARM64: public NativeRegExpMacroAssembler {
   virtual bool CheckSpecialCharacterClass(uc16 type,
                                           Label* on_no_match);
   virtual void Fail();
+  virtual void FallbackToNfa();
   virtual Handle<HeapObject> GetCode(Handle<String> source);
   virtual void GoTo(Label* label);
   virtual void IfRegisterGE(int reg, int comparand, Label* if_ge);
@@ -286,6 +287,7 @@ class RegExpMacroAssemblerARM64: public NativeRegExpMacroAssembler {
   Label exit_label_;
   Label check_preempt_label_;
   Label stack_overflow_label_;
+  Label fallback_to_nfa_label_;
 };
 
 #endif  // V8_INTERPRETED_REGEXP
@@ -4,8 +4,6 @@
 
 // A simple interpreter for the Irregexp byte code.
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/interpreter-irregexp.h"
 
 #include "src/ast/ast.h"
@@ -101,7 +99,7 @@ static void TraceInterpreter(const byte* code_base,
   case BC_##name:                                                           \
     TraceInterpreter(code_base,                                             \
                      pc,                                                    \
-                     static_cast<int>(backtrack_sp - backtrack_stack_base), \
+                     static_cast<int>(backtrack_sp - backtrack_stack.data()), \
                      current,                                               \
                      current_char,                                          \
                      BC_##name##_LENGTH,                                    \
@@ -125,12 +123,11 @@ static int32_t Load16Aligned(const byte* pc) {
 
 
 // A simple abstraction over the backtracking stack used by the interpreter.
-// This backtracking stack does not grow automatically, but it ensures that the
-// the memory held by the stack is released or remembered in a cache if the
-// matching terminates.
+// The stack grows on demand up to the limit of the native regexp stack, and
+// the memory held by it is released when the matching terminates.
 class BacktrackStack {
  public:
-  BacktrackStack() { data_ = NewArray<int>(kBacktrackStackSize); }
+  BacktrackStack() : data_(NewArray<int>(kInitialSize)), size_(kInitialSize) {}
 
   ~BacktrackStack() {
     DeleteArray(data_);
@@ -138,12 +135,31 @@ class BacktrackStack {
 
   int* data() const { return data_; }
 
-  int max_size() const { return kBacktrackStackSize; }
+  int size() const { return size_; }
+
+  // Doubles the capacity of the stack and adjusts the stack pointer |sp| and
+  // the remaining |space| to it. Returns false if the stack is already at its
+  // maximum size.
+  bool Grow(int** sp, int* space) {
+    if (size_ >= kMaximumSize) return false;
+    int new_size = Min(2 * size_, kMaximumSize);
+    int* new_data = NewArray<int>(new_size);
+    MemCopy(new_data, data_, size_ * sizeof(*data_));
+    *sp = new_data + (*sp - data_);
+    *space += new_size - size_;
+    DeleteArray(data_);
+    data_ = new_data;
+    size_ = new_size;
+    return true;
+  }
 
  private:
-  static const int kBacktrackStackSize = 10000;
+  static const int kInitialSize = 10000;
+  // The same limit as for the stack of native regexp code.
+  static const int kMaximumSize = 64 * MB / kIntSize;
 
   int* data_;
+  int size_;
 
   DISALLOW_COPY_AND_ASSIGN(BacktrackStack);
 };
@@ -155,15 +171,16 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
                                            Vector<const Char> subject,
                                            int* registers,
                                            int current,
-                                           uint32_t current_char) {
+                                           uint32_t current_char,
+                                           int backtrack_limit) {
   const byte* pc = code_base;
+  int backtracks = 0;
   // BacktrackStack ensures that the memory allocated for the backtracking stack
   // is returned to the system or cached if there is no stack being cached at
   // the moment.
   BacktrackStack backtrack_stack;
-  int* backtrack_stack_base = backtrack_stack.data();
-  int* backtrack_sp = backtrack_stack_base;
-  int backtrack_stack_space = backtrack_stack.max_size();
+  int* backtrack_sp = backtrack_stack.data();
+  int backtrack_stack_space = backtrack_stack.size();
 #ifdef DEBUG
   if (FLAG_trace_regexp_bytecodes) {
     PrintF("\n\nStart bytecode interpreter\n\n");
@@ -176,21 +193,24 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         UNREACHABLE();
         return RegExpImpl::RE_FAILURE;
       BYTECODE(PUSH_CP)
-        if (--backtrack_stack_space < 0) {
+        if (--backtrack_stack_space < 0 &&
+            !backtrack_stack.Grow(&backtrack_sp, &backtrack_stack_space)) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = current;
         pc += BC_PUSH_CP_LENGTH;
         break;
       BYTECODE(PUSH_BT)
-        if (--backtrack_stack_space < 0) {
+        if (--backtrack_stack_space < 0 &&
+            !backtrack_stack.Grow(&backtrack_sp, &backtrack_stack_space)) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = Load32Aligned(pc + 4);
         pc += BC_PUSH_BT_LENGTH;
         break;
       BYTECODE(PUSH_REGISTER)
-        if (--backtrack_stack_space < 0) {
+        if (--backtrack_stack_space < 0 &&
+            !backtrack_stack.Grow(&backtrack_sp, &backtrack_stack_space)) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = registers[insn >> BYTECODE_SHIFT];
@@ -214,13 +234,14 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         break;
       BYTECODE(SET_REGISTER_TO_SP)
         registers[insn >> BYTECODE_SHIFT] =
-            static_cast<int>(backtrack_sp - backtrack_stack_base);
+            static_cast<int>(backtrack_sp - backtrack_stack.data());
         pc += BC_SET_REGISTER_TO_SP_LENGTH;
         break;
       BYTECODE(SET_SP_TO_REGISTER)
-        backtrack_sp = backtrack_stack_base + registers[insn >> BYTECODE_SHIFT];
-        backtrack_stack_space = backtrack_stack.max_size() -
-            static_cast<int>(backtrack_sp - backtrack_stack_base);
+        backtrack_sp =
+            backtrack_stack.data() + registers[insn >> BYTECODE_SHIFT];
+        backtrack_stack_space = backtrack_stack.size() -
+            static_cast<int>(backtrack_sp - backtrack_stack.data());
         pc += BC_SET_SP_TO_REGISTER_LENGTH;
         break;
       BYTECODE(POP_CP)
@@ -230,6 +251,9 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         pc += BC_POP_CP_LENGTH;
         break;
       BYTECODE(POP_BT)
+        if (backtrack_limit != 0 && ++backtracks >= backtrack_limit) {
+          return RegExpImpl::RE_FALLBACK_TO_NFA;
+        }
         backtrack_stack_space++;
         --backtrack_sp;
         pc = code_base + *backtrack_sp;
@@ -590,7 +614,8 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
     Handle<ByteArray> code_array,
     Handle<String> subject,
     int* registers,
-    int start_position) {
+    int start_position,
+    int backtrack_limit) {
   DCHECK(subject->IsFlat());
 
   DisallowHeapAllocation no_gc;
@@ -605,7 +630,8 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
                     subject_vector,
                     registers,
                     start_position,
-                    previous_char);
+                    previous_char,
+                    backtrack_limit);
   } else {
     DCHECK(subject_content.IsTwoByte());
     Vector<const uc16> subject_vector = subject_content.ToUC16Vector();
@@ -615,11 +641,10 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
                     subject_vector,
                     registers,
                     start_position,
-                    previous_char);
+                    previous_char,
+                    backtrack_limit);
   }
 }
 
 }  // namespace internal
 }  // namespace v8
-
-#endif  // V8_INTERPRETED_REGEXP
@@ -63,6 +63,9 @@ int32_t* RegExpImpl::GlobalCache::FetchNext() {
     }
 
     if (num_matches_ <= 0) return NULL;
+    // An interpreted regexp that tiered up during the loop runs native code,
+    // which may return more matches than the register layout can hold.
+    num_matches_ = Min(num_matches_, max_matches_);
     current_match_index_ = 0;
     return register_array_;
   } else {
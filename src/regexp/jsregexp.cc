@@ -18,6 +18,7 @@
 #include "src/regexp/regexp-macro-assembler.h"
 #include "src/regexp/regexp-macro-assembler-irregexp.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
+#include "src/regexp/regexp-nfa.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/runtime/runtime.h"
@@ -128,6 +129,90 @@ static bool HasFewDifferentCharacters(Handle<String> pattern) {
 }
 
 
+// Literals shorter than this occur too often in typical subjects to be worth
+// searching for before running the regexp.
+const int kMinRequiredLiteralLength = 3;
+
+
+static int IncreaseOffset(int offset, int increase) {
+  if (offset > RegExpTree::kInfinity - increase) return RegExpTree::kInfinity;
+  return offset + increase;
+}
+
+
+// Finds the longest literal that every match of a regexp contains, together
+// with bounds on its offset from the start of the match.
+class RequiredLiteral {
+ public:
+  RequiredLiteral() : min_offset_(0), max_offset_(0) {}
+
+  // Looks for the literal in a tree whose match starts between min_offset
+  // and max_offset characters after the start of the whole match.
+  void Find(RegExpTree* tree, int min_offset, int max_offset);
+
+  Vector<const uc16> data() const { return data_; }
+  int min_offset() const { return min_offset_; }
+  int max_offset() const { return max_offset_; }
+
+ private:
+  void Consider(Vector<const uc16> data, int min_offset, int max_offset);
+
+  Vector<const uc16> data_;
+  int min_offset_;
+  int max_offset_;
+};
+
+
+void RequiredLiteral::Find(RegExpTree* tree, int min_offset, int max_offset) {
+  if (tree->IsAtom()) {
+    Consider(tree->AsAtom()->data(), min_offset, max_offset);
+  } else if (tree->IsText()) {
+    ZoneList<TextElement>* elements = tree->AsText()->elements();
+    for (int i = 0; i < elements->length(); i++) {
+      TextElement element = elements->at(i);
+      if (element.text_type() == TextElement::ATOM) {
+        Consider(element.atom()->data(), min_offset, max_offset);
+      }
+      min_offset = IncreaseOffset(min_offset, element.tree()->min_match());
+      max_offset = IncreaseOffset(max_offset, element.tree()->max_match());
+    }
+  } else if (tree->IsAlternative()) {
+    ZoneList<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+    for (int i = 0; i < nodes->length(); i++) {
+      RegExpTree* node = nodes->at(i);
+      Find(node, min_offset, max_offset);
+      min_offset = IncreaseOffset(min_offset, node->min_match());
+      max_offset = IncreaseOffset(max_offset, node->max_match());
+    }
+  } else if (tree->IsCapture()) {
+    Find(tree->AsCapture()->body(), min_offset, max_offset);
+  } else if (tree->IsQuantifier()) {
+    // The first iteration of a mandatory body starts where the quantifier
+    // does.
+    RegExpQuantifier* quantifier = tree->AsQuantifier();
+    if (quantifier->min() > 0) {
+      Find(quantifier->body(), min_offset, max_offset);
+    }
+  }
+  // Disjunctions, lookarounds and the remaining trees contain no literal
+  // that is shared by all matches.
+}
+
+
+void RequiredLiteral::Consider(Vector<const uc16> data, int min_offset,
+                               int max_offset) {
+  // Prefer longer literals, then literals with a tighter offset range.
+  if (data.length() < data_.length()) return;
+  if (data.length() == data_.length() &&
+      max_offset - min_offset >= max_offset_ - min_offset_) {
+    return;
+  }
+  data_ = data;
+  min_offset_ = min_offset;
+  max_offset_ = max_offset;
+}
+
+
 // Generic RegExp methods. Dispatches to implementation specific methods.
 
 
@@ -181,6 +266,9 @@ MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
   }
   if (!has_been_compiled) {
     IrregexpInitialize(re, pattern, flags, parse_result.capture_count);
+    if (FLAG_regexp_prefilter) {
+      IrregexpSetRequiredLiteral(re, parse_result.tree, flags);
+    }
   }
   DCHECK(re->data()->IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -316,7 +404,8 @@ Handle<Object> RegExpImpl::AtomExec(Handle<JSRegExp> re,
 // Ensures that the regexp object contains a compiled version of the
 // source for either one-byte or two-byte subject strings.
 // If the compiled version doesn't already exist, it is compiled
-// from the source pattern.
+// from the source pattern.  Until the regexp has been tiered up, bytecode
+// for the interpreter is good enough.
 // If compilation fails, an exception is thrown and this function
 // returns false.
 bool RegExpImpl::EnsureCompiledIrregexp(Handle<JSRegExp> re,
@@ -337,10 +426,178 @@ bool RegExpImpl::EnsureCompiledIrregexp(Handle<JSRegExp> re,
     DCHECK(compiled_code->IsSmi());
     return true;
   }
+#ifndef V8_INTERPRETED_REGEXP
+  if (IrregexpShouldInterpret(FixedArray::cast(re->data())) &&
+      re->DataAt(JSRegExp::bytecode_index(is_one_byte))->IsByteArray()) {
+    return true;
+  }
+#endif  // V8_INTERPRETED_REGEXP
   return CompileIrregexp(re, sample_subject, is_one_byte);
 }
 
 
+bool RegExpImpl::IrregexpShouldInterpret(FixedArray* re) {
+#ifdef V8_INTERPRETED_REGEXP
+  return true;
+#else  // V8_INTERPRETED_REGEXP
+  return Smi::cast(re->get(JSRegExp::kIrregexpTicksUntilTierUpIndex))
+             ->value() > 0;
+#endif  // V8_INTERPRETED_REGEXP
+}
+
+
+bool RegExpImpl::IrregexpUsesNfa(FixedArray* re) {
+  return re->get(JSRegExp::kIrregexpNfaProgramIndex)->IsByteArray();
+}
+
+
+bool RegExpImpl::IrregexpCompileNfa(Handle<JSRegExp> re) {
+  Object* entry = re->DataAt(JSRegExp::kIrregexpNfaProgramIndex);
+  if (entry->IsByteArray()) return true;
+  if (Smi::cast(entry)->value() == JSRegExp::kCompilationErrorValue) {
+    return false;
+  }
+
+  Isolate* isolate = re->GetIsolate();
+  Zone zone(isolate->allocator());
+  JSRegExp::Flags flags = re->GetFlags();
+  Handle<String> pattern(re->Pattern());
+  pattern = String::Flatten(pattern);
+  RegExpCompileData compile_data;
+  FlatStringReader reader(isolate, pattern);
+  Handle<ByteArray> program;
+  if (RegExpParser::ParseRegExp(isolate, &zone, &reader, flags,
+                                &compile_data)) {
+    program = RegExpNfa::Compile(isolate, &zone, compile_data.tree, flags,
+                                 compile_data.capture_count);
+  }
+  if (program.is_null()) {
+    re->SetDataAt(JSRegExp::kIrregexpNfaProgramIndex,
+                  Smi::FromInt(JSRegExp::kCompilationErrorValue));
+    return false;
+  }
+  re->SetDataAt(JSRegExp::kIrregexpNfaProgramIndex, *program);
+
+  // Drop the Irregexp code, so that the RegExpExecStub calls into the
+  // runtime, which dispatches to the automaton.
+  Smi* uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  for (int i = 0; i < 2; i++) {
+    bool is_one_byte = i == 0;
+    re->SetDataAt(JSRegExp::code_index(is_one_byte), uninitialized);
+    re->SetDataAt(JSRegExp::saved_code_index(is_one_byte), uninitialized);
+    re->SetDataAt(JSRegExp::bytecode_index(is_one_byte), uninitialized);
+  }
+  return true;
+}
+
+
+int RegExpImpl::IrregexpExecNfa(Handle<JSRegExp> regexp,
+                                Handle<String> subject, int index,
+                                int32_t* output) {
+  Isolate* isolate = regexp->GetIsolate();
+  isolate->counters()->regexp_entry_nfa()->Increment();
+  Handle<ByteArray> program(
+      ByteArray::cast(regexp->DataAt(JSRegExp::kIrregexpNfaProgramIndex)),
+      isolate);
+  return RegExpNfa::Match(isolate, program, subject, output, index);
+}
+
+
+void RegExpImpl::IrregexpSetRequiredLiteral(Handle<JSRegExp> re,
+                                            RegExpTree* tree,
+                                            JSRegExp::Flags flags) {
+  // Case-insensitive literals match more than one string, and unicode
+  // regexps must not start matching inside a surrogate pair. Sticky regexps
+  // and regexps anchored at the start are only tried at one position, which
+  // is cheaper than searching the rest of the subject.
+  if (flags & (JSRegExp::kIgnoreCase | JSRegExp::kUnicode |
+               JSRegExp::kSticky)) {
+    return;
+  }
+  if (tree->IsAnchoredAtStart()) return;
+
+  RequiredLiteral literal;
+  literal.Find(tree, 0, 0);
+  if (literal.data().length() < kMinRequiredLiteralLength) return;
+
+  Isolate* isolate = re->GetIsolate();
+  Handle<String> literal_string =
+      isolate->factory()->NewStringFromTwoByte(literal.data(), TENURED)
+          .ToHandleChecked();
+  // Offsets beyond the longest string can only be matched by regexps that
+  // never match, so clamping them keeps the bounds conservative.
+  int min_offset = Min(literal.min_offset(), String::kMaxLength);
+  int max_offset =
+      literal.max_offset() > String::kMaxLength ? -1 : literal.max_offset();
+  re->SetDataAt(JSRegExp::kIrregexpRequiredLiteralIndex, *literal_string);
+  re->SetDataAt(JSRegExp::kIrregexpRequiredLiteralMinOffsetIndex,
+                Smi::FromInt(min_offset));
+  re->SetDataAt(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex,
+                Smi::FromInt(max_offset));
+}
+
+
+int RegExpImpl::IrregexpSkipToCandidate(Handle<JSRegExp> regexp,
+                                        Handle<String> subject, int index) {
+  Object* entry = regexp->DataAt(JSRegExp::kIrregexpRequiredLiteralIndex);
+  if (!entry->IsString()) return index;
+  Isolate* isolate = regexp->GetIsolate();
+  String* literal = String::cast(entry);
+  int min_offset = Smi::cast(regexp->DataAt(
+      JSRegExp::kIrregexpRequiredLiteralMinOffsetIndex))->value();
+  int max_offset = Smi::cast(regexp->DataAt(
+      JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex))->value();
+
+  // A match starting at index or later has the literal at index + min_offset
+  // or later.
+  int position = -1;
+  int search_start = index + min_offset;
+  if (search_start + literal->length() <= subject->length()) {
+    DisallowHeapAllocation no_gc;  // ensure vectors stay valid
+    String::FlatContent literal_content = literal->GetFlatContent();
+    String::FlatContent subject_content = subject->GetFlatContent();
+    DCHECK(literal_content.IsFlat());
+    DCHECK(subject_content.IsFlat());
+    position =
+        literal_content.IsOneByte()
+            ? (subject_content.IsOneByte()
+                   ? SearchString(isolate, subject_content.ToOneByteVector(),
+                                  literal_content.ToOneByteVector(),
+                                  search_start)
+                   : SearchString(isolate, subject_content.ToUC16Vector(),
+                                  literal_content.ToOneByteVector(),
+                                  search_start))
+            : (subject_content.IsOneByte()
+                   ? SearchString(isolate, subject_content.ToOneByteVector(),
+                                  literal_content.ToUC16Vector(),
+                                  search_start)
+                   : SearchString(isolate, subject_content.ToUC16Vector(),
+                                  literal_content.ToUC16Vector(),
+                                  search_start));
+  }
+  if (position == -1) {
+    isolate->counters()->regexp_prefilter_rejections()->Increment();
+    return -1;
+  }
+  // No match can start more than max_offset characters before the first
+  // occurrence of the literal.
+  if (max_offset >= 0 && position - max_offset > index) {
+    isolate->counters()->regexp_prefilter_skips()->Increment();
+    return position - max_offset;
+  }
+  return index;
+}
+
+
+bool RegExpImpl::IrregexpInterpreted(FixedArray* re, bool is_one_byte) {
+#ifdef V8_INTERPRETED_REGEXP
+  return true;
+#else  // V8_INTERPRETED_REGEXP
+  return re->get(JSRegExp::bytecode_index(is_one_byte))->IsByteArray();
+#endif  // V8_INTERPRETED_REGEXP
+}
+
+
 bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
                                  bool is_one_byte) {
@@ -371,6 +628,14 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     return false;
   }
 
+  RegExpEngine::CompilationTarget target =
+      IrregexpShouldInterpret(FixedArray::cast(re->data()))
+          ? RegExpEngine::kBytecode
+          : RegExpEngine::kNativeCode;
+  HistogramTimerScope timer(target == RegExpEngine::kBytecode
+                                ? isolate->counters()->compile_regexp_bytecode()
+                                : isolate->counters()->compile_regexp_native());
+
   JSRegExp::Flags flags = re->GetFlags();
 
   Handle<String> pattern(re->Pattern());
@@ -384,9 +649,26 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     USE(ThrowRegExpException(re, pattern, compile_data.error));
     return false;
   }
-  RegExpEngine::CompilationResult result =
-      RegExpEngine::Compile(isolate, &zone, &compile_data, flags, pattern,
-                            sample_subject, is_one_byte);
+  // Decide before the first interpreted execution whether it may give up on
+  // excessive backtracking, so that a match is never started twice in vain.
+  if (FLAG_regexp_nfa_on_excessive_backtracks &&
+      re->DataAt(JSRegExp::kIrregexpNfaProgramIndex)->IsSmi() &&
+      !RegExpNfa::CanBeHandled(compile_data.tree, flags)) {
+    re->SetDataAt(JSRegExp::kIrregexpNfaProgramIndex,
+                  Smi::FromInt(JSRegExp::kCompilationErrorValue));
+  }
+  // The interpreter limits backtracks when it runs, but native code has the
+  // limit built in.
+  int backtrack_limit = 0;
+  Object* nfa_entry = re->DataAt(JSRegExp::kIrregexpNfaProgramIndex);
+  if (target == RegExpEngine::kNativeCode &&
+      FLAG_regexp_nfa_on_excessive_backtracks && nfa_entry->IsSmi() &&
+      Smi::cast(nfa_entry)->value() != JSRegExp::kCompilationErrorValue) {
+    backtrack_limit = FLAG_regexp_backtracks_before_nfa;
+  }
+  RegExpEngine::CompilationResult result = RegExpEngine::Compile(
+      isolate, &zone, &compile_data, flags, pattern, sample_subject,
+      is_one_byte, target, backtrack_limit);
   if (result.error_message != NULL) {
     // Unable to compile regexp.
     Handle<String> error_message = isolate->factory()->NewStringFromUtf8(
@@ -396,7 +678,21 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
   }
 
   Handle<FixedArray> data = Handle<FixedArray>(FixedArray::cast(re->data()));
+#ifdef V8_INTERPRETED_REGEXP
   data->set(JSRegExp::code_index(is_one_byte), result.code);
+#else  // V8_INTERPRETED_REGEXP
+  if (target == RegExpEngine::kBytecode) {
+    data->set(JSRegExp::bytecode_index(is_one_byte), result.code);
+  } else {
+    data->set(JSRegExp::code_index(is_one_byte), result.code);
+    // The bytecode is no longer executed once native code exists.
+    if (data->get(JSRegExp::bytecode_index(is_one_byte))->IsByteArray()) {
+      data->set(JSRegExp::bytecode_index(is_one_byte),
+                Smi::FromInt(JSRegExp::kUninitializedValue));
+      isolate->counters()->regexp_tier_up()->Increment();
+    }
+  }
+#endif  // V8_INTERPRETED_REGEXP
   int register_max = IrregexpMaxRegisterCount(*data);
   if (result.num_registers > register_max) {
     SetIrregexpMaxRegisterCount(*data, result.num_registers);
@@ -428,7 +724,11 @@ int RegExpImpl::IrregexpNumberOfRegisters(FixedArray* re) {
 
 
 ByteArray* RegExpImpl::IrregexpByteCode(FixedArray* re, bool is_one_byte) {
+#ifdef V8_INTERPRETED_REGEXP
   return ByteArray::cast(re->get(JSRegExp::code_index(is_one_byte)));
+#else  // V8_INTERPRETED_REGEXP
+  return ByteArray::cast(re->get(JSRegExp::bytecode_index(is_one_byte)));
+#endif  // V8_INTERPRETED_REGEXP
 }
 
 
@@ -454,22 +754,36 @@ int RegExpImpl::IrregexpPrepare(Handle<JSRegExp> regexp,
                                 Handle<String> subject) {
   subject = String::Flatten(subject);
 
+  if (FLAG_regexp_nfa) IrregexpCompileNfa(regexp);
+  if (IrregexpUsesNfa(FixedArray::cast(regexp->data()))) {
+    // The automaton only needs room to output captures.
+    return (regexp->CaptureCount() + 1) * 2;
+  }
+
   // Check representation of the underlying storage.
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
+#ifndef V8_INTERPRETED_REGEXP
+  // Scanning a long subject in the interpreter costs more than compiling the
+  // regexp to native code, so tier up right away.
+  if (subject->length() >= FLAG_regexp_tier_up_subject_length) {
+    regexp->SetDataAt(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+                      Smi::FromInt(0));
+  }
+#endif  // V8_INTERPRETED_REGEXP
   if (!EnsureCompiledIrregexp(regexp, subject, is_one_byte)) return -1;
 
-#ifdef V8_INTERPRETED_REGEXP
-  // Byte-code regexp needs space allocated for all its registers.
-  // The result captures are copied to the start of the registers array
-  // if the match succeeds.  This way those registers are not clobbered
-  // when we set the last match info from last successful match.
-  return IrregexpNumberOfRegisters(FixedArray::cast(regexp->data())) +
-         (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#else  // V8_INTERPRETED_REGEXP
+  FixedArray* data = FixedArray::cast(regexp->data());
+  if (IrregexpInterpreted(data, is_one_byte)) {
+    // Byte-code regexp needs space allocated for all its registers.
+    // The result captures are copied to the start of the registers array
+    // if the match succeeds.  This way those registers are not clobbered
+    // when we set the last match info from last successful match.
+    return IrregexpNumberOfRegisters(data) +
+           (IrregexpNumberOfCaptures(data) + 1) * 2;
+  }
   // Native regexp only needs room to output captures. Registers are handled
   // internally.
-  return (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#endif  // V8_INTERPRETED_REGEXP
+  return (IrregexpNumberOfCaptures(data) + 1) * 2;
 }
 
 
@@ -486,9 +800,107 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   DCHECK(index <= subject->length());
   DCHECK(subject->IsFlat());
 
+  if (FLAG_regexp_prefilter) {
+    index = IrregexpSkipToCandidate(regexp, subject, index);
+    if (index < 0) return RE_FAILURE;
+  }
+
+  if (IrregexpUsesNfa(*irregexp)) {
+    return IrregexpExecNfa(regexp, subject, index, output);
+  }
+
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
 
 #ifndef V8_INTERPRETED_REGEXP
+  if (!IrregexpInterpreted(*irregexp, is_one_byte)) {
+    return IrregexpExecNative(regexp, subject, index, output, output_size);
+  }
+  // Count the execution towards tiering up to native code, which happens
+  // the next time the regexp is prepared.
+  int ticks =
+      Smi::cast(irregexp->get(JSRegExp::kIrregexpTicksUntilTierUpIndex))
+          ->value();
+  if (ticks > 0) {
+    irregexp->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+                  Smi::FromInt(ticks - 1));
+  }
+  isolate->counters()->regexp_entry_interpreted()->Increment();
+#endif  // V8_INTERPRETED_REGEXP
+
+  DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
+  // We must have done EnsureCompiledIrregexp, so we can get the number of
+  // registers.
+  int number_of_capture_registers =
+      (IrregexpNumberOfCaptures(*irregexp) + 1) * 2;
+  int32_t* raw_output = &output[number_of_capture_registers];
+  // We do not touch the actual capture result registers until we know there
+  // has been a match so that we can use those capture results to set the
+  // last match info.
+  for (int i = number_of_capture_registers - 1; i >= 0; i--) {
+    raw_output[i] = -1;
+  }
+  Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_one_byte),
+                               isolate);
+
+  // Only limit the backtracks if the automaton can take over the match,
+  // which CompileIrregexp already determined.
+  Object* nfa_entry = irregexp->get(JSRegExp::kIrregexpNfaProgramIndex);
+  bool can_fall_back =
+      FLAG_regexp_nfa_on_excessive_backtracks &&
+      Smi::cast(nfa_entry)->value() != JSRegExp::kCompilationErrorValue;
+  int backtrack_limit =
+      can_fall_back ? FLAG_regexp_backtracks_before_nfa : 0;
+  IrregexpResult result = IrregexpInterpreter::Match(
+      isolate, byte_codes, subject, raw_output, index, backtrack_limit);
+  if (result == RE_FALLBACK_TO_NFA && IrregexpCompileNfa(regexp)) {
+    isolate->counters()->regexp_nfa_fallback()->Increment();
+    return IrregexpExecNfa(regexp, subject, index, output);
+  }
+#ifndef V8_INTERPRETED_REGEXP
+  if (result == RE_FALLBACK_TO_NFA || result == RE_EXCEPTION) {
+    // The automaton program would be too large, or the interpreter ran out
+    // of backtrack stack. Tier up and finish the match in native code, which
+    // does not use the interpreter's stack and only has a backtrack budget
+    // if the automaton can take over. Only ask for a single match, like the
+    // interpreter would return.
+    DCHECK(!isolate->has_pending_exception());
+    irregexp->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, Smi::FromInt(0));
+    return IrregexpExecNative(regexp, subject, index, output,
+                              number_of_capture_registers);
+  }
+#else   // V8_INTERPRETED_REGEXP
+  if (result == RE_FALLBACK_TO_NFA) {
+    // The automaton program would be too large and there is no native code
+    // to tier up to, so the interpreter has to finish without a budget.
+    for (int i = number_of_capture_registers - 1; i >= 0; i--) {
+      raw_output[i] = -1;
+    }
+    result = IrregexpInterpreter::Match(isolate, byte_codes, subject,
+                                        raw_output, index, 0);
+  }
+#endif  // V8_INTERPRETED_REGEXP
+  if (result == RE_SUCCESS) {
+    // Copy capture results to the start of the registers array.
+    MemCopy(output, raw_output, number_of_capture_registers * sizeof(int32_t));
+  }
+  if (result == RE_EXCEPTION) {
+    DCHECK(!isolate->has_pending_exception());
+    isolate->StackOverflow();
+  }
+  return result;
+}
+
+
+#ifndef V8_INTERPRETED_REGEXP
+int RegExpImpl::IrregexpExecNative(Handle<JSRegExp> regexp,
+                                   Handle<String> subject, int index,
+                                   int32_t* output, int output_size) {
+  Isolate* isolate = regexp->GetIsolate();
+
+  Handle<FixedArray> irregexp(FixedArray::cast(regexp->data()), isolate);
+
+  bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
+
   DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
   do {
     EnsureCompiledIrregexp(regexp, subject, is_one_byte);
@@ -504,6 +916,22 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
                                           output_size,
                                           index,
                                           isolate);
+    if (res == NativeRegExpMacroAssembler::FALLBACK_TO_NFA) {
+      if (IrregexpCompileNfa(regexp)) {
+        isolate->counters()->regexp_nfa_fallback()->Increment();
+        return IrregexpExecNfa(regexp, subject, index, output);
+      }
+      // The automaton program would be too large. Recompile the native code
+      // without a backtrack limit, now that the automaton is known to fail,
+      // and start over.
+      Smi* uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+      for (int i = 0; i < 2; i++) {
+        bool one_byte = i == 0;
+        irregexp->set(JSRegExp::code_index(one_byte), uninitialized);
+        irregexp->set(JSRegExp::saved_code_index(one_byte), uninitialized);
+      }
+      continue;
+    }
     if (res != NativeRegExpMacroAssembler::RETRY) {
       DCHECK(res != NativeRegExpMacroAssembler::EXCEPTION ||
              isolate->has_pending_exception());
@@ -526,39 +954,8 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   } while (true);
   UNREACHABLE();
   return RE_EXCEPTION;
-#else  // V8_INTERPRETED_REGEXP
-
-  DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
-  // We must have done EnsureCompiledIrregexp, so we can get the number of
-  // registers.
-  int number_of_capture_registers =
-      (IrregexpNumberOfCaptures(*irregexp) + 1) * 2;
-  int32_t* raw_output = &output[number_of_capture_registers];
-  // We do not touch the actual capture result registers until we know there
-  // has been a match so that we can use those capture results to set the
-  // last match info.
-  for (int i = number_of_capture_registers - 1; i >= 0; i--) {
-    raw_output[i] = -1;
-  }
-  Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_one_byte),
-                               isolate);
-
-  IrregexpResult result = IrregexpInterpreter::Match(isolate,
-                                                     byte_codes,
-                                                     subject,
-                                                     raw_output,
-                                                     index);
-  if (result == RE_SUCCESS) {
-    // Copy capture results to the start of the registers array.
-    MemCopy(output, raw_output, number_of_capture_registers * sizeof(int32_t));
-  }
-  if (result == RE_EXCEPTION) {
-    DCHECK(!isolate->has_pending_exception());
-    isolate->StackOverflow();
-  }
-  return result;
-#endif  // V8_INTERPRETED_REGEXP
 }
+#endif  // V8_INTERPRETED_REGEXP
 
 
 MaybeHandle<Object> RegExpImpl::IrregexpExec(Handle<JSRegExp> regexp,
@@ -569,7 +966,7 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(Handle<JSRegExp> regexp,
   DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
 
   // Prepare space for the return values.
-#if defined(V8_INTERPRETED_REGEXP) && defined(DEBUG)
+#ifdef DEBUG
   if (FLAG_trace_regexp_bytecodes) {
     String* pattern = regexp->Pattern();
     PrintF("\n\nRegexp match:   /%s/\n\n", pattern->ToCString().get());
@@ -645,23 +1042,23 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
     register_array_size_(0),
     regexp_(regexp),
     subject_(subject) {
-#ifdef V8_INTERPRETED_REGEXP
-  bool interpreted = true;
-#else
   bool interpreted = false;
-#endif  // V8_INTERPRETED_REGEXP
 
   if (regexp_->TypeTag() == JSRegExp::ATOM) {
     static const int kAtomRegistersPerMatch = 2;
     registers_per_match_ = kAtomRegistersPerMatch;
     // There is no distinction between interpreted and native for atom regexps.
-    interpreted = false;
   } else {
     registers_per_match_ = RegExpImpl::IrregexpPrepare(regexp_, subject_);
     if (registers_per_match_ < 0) {
       num_matches_ = -1;  // Signal exception.
       return;
     }
+    // Like the interpreter, the automaton returns one match per call.
+    FixedArray* data = FixedArray::cast(regexp_->data());
+    interpreted = RegExpImpl::IrregexpUsesNfa(data) ||
+                  RegExpImpl::IrregexpInterpreted(
+                      data, subject_->IsOneByteRepresentationUnderneath());
   }
 
   DCHECK_NE(0, regexp->GetFlags() & JSRegExp::kGlobal);
@@ -1011,6 +1408,12 @@ class RegExpCompiler {
 
   void SetRegExpTooBig() { reg_exp_too_big_ = true; }
 
+  // Native code gives up on a match after this many backtracks, so that it
+  // can be finished by the automaton. Zero means no limit.
+  void set_backtrack_limit(int limit) { backtrack_limit_ = limit; }
+  // Emits code that counts a backtrack towards the limit.
+  void CountBacktrack();
+
   inline bool ignore_case() { return (flags_ & JSRegExp::kIgnoreCase) != 0; }
   inline bool unicode() { return (flags_ & JSRegExp::kUnicode) != 0; }
   inline bool one_byte() { return one_byte_; }
@@ -1049,6 +1452,9 @@ class RegExpCompiler {
   bool optimize_;
   bool read_backward_;
   int current_expansion_factor_;
+  int backtrack_limit_;
+  int backtrack_count_register_;
+  Label backtrack_limit_exceeded_;
   FrequencyCollator frequency_collator_;
   Isolate* isolate_;
   Zone* zone_;
@@ -1087,6 +1493,8 @@ RegExpCompiler::RegExpCompiler(Isolate* isolate, Zone* zone, int capture_count,
       optimize_(FLAG_regexp_optimization),
       read_backward_(false),
       current_expansion_factor_(1),
+      backtrack_limit_(0),
+      backtrack_count_register_(kNoRegister),
       frequency_collator_(),
       isolate_(isolate),
       zone_(zone) {
@@ -1112,6 +1520,10 @@ RegExpEngine::CompilationResult RegExpCompiler::Assemble(
 
   List <RegExpNode*> work_list(0);
   work_list_ = &work_list;
+  if (backtrack_limit_ > 0) {
+    backtrack_count_register_ = AllocateRegister();
+    macro_assembler_->SetRegister(backtrack_count_register_, 0);
+  }
   Label fail;
   macro_assembler_->PushBacktrack(&fail);
   Trace new_trace;
@@ -1123,6 +1535,10 @@ RegExpEngine::CompilationResult RegExpCompiler::Assemble(
     node->set_on_work_list(false);
     if (!node->label()->is_bound()) node->Emit(this, &new_trace);
   }
+  if (backtrack_limit_exceeded_.is_linked()) {
+    macro_assembler_->Bind(&backtrack_limit_exceeded_);
+    macro_assembler_->FallbackToNfa();
+  }
   if (reg_exp_too_big_) {
     macro_assembler_->AbortedCodeGeneration();
     return IrregexpRegExpTooBig(isolate_);
@@ -1132,7 +1548,7 @@ RegExpEngine::CompilationResult RegExpCompiler::Assemble(
   heap->IncreaseTotalRegexpCodeGenerated(code->Size());
   work_list_ = NULL;
 #ifdef ENABLE_DISASSEMBLER
-  if (FLAG_print_code) {
+  if (FLAG_print_code && code->IsCode()) {
     CodeTracer::Scope trace_scope(heap->isolate()->GetCodeTracer());
     OFStream os(trace_scope.file());
     Handle<Code>::cast(code)->Disassemble(pattern->ToCString().get(), os);
@@ -1147,6 +1563,14 @@ RegExpEngine::CompilationResult RegExpCompiler::Assemble(
 }
 
 
+void RegExpCompiler::CountBacktrack() {
+  if (backtrack_limit_ == 0) return;
+  macro_assembler_->AdvanceRegister(backtrack_count_register_, 1);
+  macro_assembler_->IfRegisterGE(backtrack_count_register_, backtrack_limit_,
+                                 &backtrack_limit_exceeded_);
+}
+
+
 bool Trace::DeferredAction::Mentions(int that) {
   if (action_type() == ActionNode::CLEAR_CAPTURES) {
     Interval range = static_cast<DeferredClearCaptures*>(this)->range();
@@ -1411,6 +1835,7 @@ void Trace::Flush(RegExpCompiler* compiler, RegExpNode* successor) {
 
   // On backtrack we need to restore state.
   assembler->Bind(&undo);
+  compiler->CountBacktrack();
   RestoreAffectedRegisters(assembler,
                            max_register,
                            registers_to_pop,
@@ -4078,6 +4503,7 @@ Trace* ChoiceNode::EmitGreedyLoop(RegExpCompiler* compiler,
               preload);
 
   macro_assembler->Bind(greedy_loop_state->label());
+  compiler->CountBacktrack();
   // If we have unwound to the bottom then backtrack.
   macro_assembler->CheckGreedyLoop(trace->backtrack());
   // Otherwise try the second priority at an earlier position.
@@ -6614,7 +7040,10 @@ RegExpNode* OptionallyStepBackToLeadSurrogate(RegExpCompiler* compiler,
 RegExpEngine::CompilationResult RegExpEngine::Compile(
     Isolate* isolate, Zone* zone, RegExpCompileData* data,
     JSRegExp::Flags flags, Handle<String> pattern,
-    Handle<String> sample_subject, bool is_one_byte) {
+    Handle<String> sample_subject, bool is_one_byte,
+    CompilationTarget target, int backtrack_limit) {
+  // The interpreter has its own backtrack budget.
+  DCHECK(target == kNativeCode || backtrack_limit == 0);
   if ((data->capture_count + 1) * 2 - 1 > RegExpMacroAssembler::kMaxRegister) {
     return IrregexpRegExpTooBig(isolate);
   }
@@ -6624,6 +7053,7 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
   bool is_unicode = flags & JSRegExp::kUnicode;
   RegExpCompiler compiler(isolate, zone, data->capture_count, flags,
                           is_one_byte);
+  compiler.set_backtrack_limit(backtrack_limit);
 
   if (compiler.optimize()) compiler.set_optimize(!TooMuchRegExpCode(pattern));
 
@@ -6688,51 +7118,54 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
   }
 
   // Create the correct assembler for the architecture.
+  base::SmartPointer<RegExpMacroAssembler> macro_assembler;
+  EmbeddedVector<byte, 1024> codes;
 #ifndef V8_INTERPRETED_REGEXP
-  // Native regexp implementation.
-
-  NativeRegExpMacroAssembler::Mode mode =
-      is_one_byte ? NativeRegExpMacroAssembler::LATIN1
-                  : NativeRegExpMacroAssembler::UC16;
+  if (target == kNativeCode) {
+    // Native regexp implementation.
+    NativeRegExpMacroAssembler::Mode mode =
+        is_one_byte ? NativeRegExpMacroAssembler::LATIN1
+                    : NativeRegExpMacroAssembler::UC16;
 
 #if V8_TARGET_ARCH_IA32
-  RegExpMacroAssemblerIA32 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.Reset(new RegExpMacroAssemblerIA32(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_X64
-  RegExpMacroAssemblerX64 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.Reset(new RegExpMacroAssemblerX64(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_ARM
-  RegExpMacroAssemblerARM macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.Reset(new RegExpMacroAssemblerARM(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_ARM64
-  RegExpMacroAssemblerARM64 macro_assembler(isolate, zone, mode,
-                                            (data->capture_count + 1) * 2);
+    macro_assembler.Reset(new RegExpMacroAssemblerARM64(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_S390
-  RegExpMacroAssemblerS390 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.Reset(new RegExpMacroAssemblerS390(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_PPC
-  RegExpMacroAssemblerPPC macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.Reset(new RegExpMacroAssemblerPPC(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_MIPS
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.Reset(new RegExpMacroAssemblerMIPS(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_MIPS64
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.Reset(new RegExpMacroAssemblerMIPS(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_X87
-  RegExpMacroAssemblerX87 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.Reset(new RegExpMacroAssemblerX87(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #else
 #error "Unsupported architecture"
 #endif
-
-#else  // V8_INTERPRETED_REGEXP
-  // Interpreted regexp implementation.
-  EmbeddedVector<byte, 1024> codes;
-  RegExpMacroAssemblerIrregexp macro_assembler(isolate, codes, zone);
+  }
 #endif  // V8_INTERPRETED_REGEXP
+  if (macro_assembler.is_empty()) {
+    // Interpreted regexp implementation.
+    macro_assembler.Reset(
+        new RegExpMacroAssemblerIrregexp(isolate, codes, zone));
+  }
 
-  macro_assembler.set_slow_safe(TooMuchRegExpCode(pattern));
+  macro_assembler->set_slow_safe(TooMuchRegExpCode(pattern));
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
@@ -6740,7 +7173,7 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
   if (is_end_anchored &&
       !is_start_anchored &&
       max_length < kMaxBacksearchLimit) {
-    macro_assembler.SetCurrentPositionFromEnd(max_length);
+    macro_assembler->SetCurrentPositionFromEnd(max_length);
   }
 
   if (is_global) {
@@ -6750,10 +7183,10 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     } else if (is_unicode) {
       mode = RegExpMacroAssembler::GLOBAL_UNICODE;
     }
-    macro_assembler.set_global_mode(mode);
+    macro_assembler->set_global_mode(mode);
   }
 
-  return compiler.Assemble(&macro_assembler,
+  return compiler.Assemble(macro_assembler.get(),
                            node,
                            data->capture_count,
                            pattern);
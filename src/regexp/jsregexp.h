@@ -77,7 +77,14 @@ class RegExpImpl {
                                  int index,
                                  Handle<JSArray> lastMatchInfo);
 
-  enum IrregexpResult { RE_FAILURE = 0, RE_SUCCESS = 1, RE_EXCEPTION = -1 };
+  // RE_FALLBACK_TO_NFA is only returned by the bytecode interpreter and
+  // never escapes IrregexpExecRaw.
+  enum IrregexpResult {
+    RE_FAILURE = 0,
+    RE_SUCCESS = 1,
+    RE_EXCEPTION = -1,
+    RE_FALLBACK_TO_NFA = -2
+  };
 
   // Prepare a RegExp for being executed one or more times (using
   // IrregexpExecOnce) on the subject.
@@ -201,6 +208,15 @@ class RegExpImpl {
   static ByteArray* IrregexpByteCode(FixedArray* re, bool is_one_byte);
   static Code* IrregexpNativeCode(FixedArray* re, bool is_one_byte);
 
+  // Whether the regexp currently runs in the bytecode interpreter for
+  // subjects of the given encoding. This only changes in IrregexpPrepare, so
+  // the register count it returns stays valid for subsequent executions.
+  static bool IrregexpInterpreted(FixedArray* re, bool is_one_byte);
+
+  // Whether the regexp is executed by the linear-time automaton of
+  // regexp-nfa.h instead of Irregexp.
+  static bool IrregexpUsesNfa(FixedArray* re);
+
   // Limit the space regexps take up on the heap.  In order to limit this we
   // would like to keep track of the amount of regexp code on the heap.  This
   // is not tracked, however.  As a conservative approximation we track the
@@ -216,6 +232,29 @@ class RegExpImpl {
   static inline bool EnsureCompiledIrregexp(Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
                                             bool is_one_byte);
+  // Whether the next compilation of the regexp generates bytecode rather
+  // than native code.
+  static bool IrregexpShouldInterpret(FixedArray* re);
+  // Switches the regexp to the linear-time automaton if its pattern allows
+  // it. Returns whether the regexp now uses the automaton.
+  static bool IrregexpCompileNfa(Handle<JSRegExp> re);
+  static int IrregexpExecNfa(Handle<JSRegExp> regexp, Handle<String> subject,
+                             int index, int32_t* output);
+  // Records the longest literal that every match of the regexp contains,
+  // if any, so that executions can skip ahead to where it occurs.
+  static void IrregexpSetRequiredLiteral(Handle<JSRegExp> re,
+                                         RegExpTree* tree,
+                                         JSRegExp::Flags flags);
+  // Returns the first position from index on at which a match can start,
+  // judging by where the required literal occurs in the subject, or -1 if
+  // the literal does not occur in the rest of the subject.
+  static int IrregexpSkipToCandidate(Handle<JSRegExp> regexp,
+                                     Handle<String> subject, int index);
+#ifndef V8_INTERPRETED_REGEXP
+  static int IrregexpExecNative(Handle<JSRegExp> regexp,
+                                Handle<String> subject, int index,
+                                int32_t* output, int output_size);
+#endif  // V8_INTERPRETED_REGEXP
 };
 
 
@@ -1537,6 +1576,10 @@ struct RegExpCompileData {
 
 class RegExpEngine: public AllStatic {
  public:
+  // Native code is only available if V8 is built without
+  // V8_INTERPRETED_REGEXP; otherwise bytecode is always generated.
+  enum CompilationTarget { kBytecode, kNativeCode };
+
   struct CompilationResult {
     CompilationResult(Isolate* isolate, const char* error_message)
         : error_message(error_message),
@@ -1554,7 +1597,8 @@ class RegExpEngine: public AllStatic {
                                    JSRegExp::Flags flags,
                                    Handle<String> pattern,
                                    Handle<String> sample_subject,
-                                   bool is_one_byte);
+                                   bool is_one_byte, CompilationTarget target,
+                                   int backtrack_limit);
 
   static bool TooMuchRegExpCode(Handle<String> pattern);
 
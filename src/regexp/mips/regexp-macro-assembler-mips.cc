@@ -129,6 +129,7 @@ RegExpMacroAssemblerMIPS::~RegExpMacroAssemblerMIPS() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_to_nfa_label_.Unuse();
   internal_failure_label_.Unuse();
 }
 
@@ -611,6 +612,11 @@ void RegExpMacroAssemblerMIPS::Fail() {
 }
 
 
+void RegExpMacroAssemblerMIPS::FallbackToNfa() {
+  __ jmp(&fallback_to_nfa_label_);
+}
+
+
 Handle<HeapObject> RegExpMacroAssemblerMIPS::GetCode(Handle<String> source) {
   Label return_v0;
   if (masm_->has_exception()) {
@@ -899,6 +905,13 @@ Handle<HeapObject> RegExpMacroAssemblerMIPS::GetCode(Handle<String> source) {
       __ li(v0, Operand(EXCEPTION));
       __ jmp(&return_v0);
     }
+
+    if (fallback_to_nfa_label_.is_linked()) {
+      // Exit with Result FALLBACK_TO_NFA(-3) if the backtrack limit was hit.
+      __ bind(&fallback_to_nfa_label_);
+      __ li(v0, Operand(FALLBACK_TO_NFA));
+      __ jmp(&return_v0);
+    }
   }
 
   CodeDesc code_desc;
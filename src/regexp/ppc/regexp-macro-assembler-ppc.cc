@@ -136,6 +136,7 @@ RegExpMacroAssemblerPPC::~RegExpMacroAssemblerPPC() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_to_nfa_label_.Unuse();
   internal_failure_label_.Unuse();
 }
 
@@ -636,6 +637,11 @@ void RegExpMacroAssemblerPPC::Fail() {
 }
 
 
+void RegExpMacroAssemblerPPC::FallbackToNfa() {
+  __ b(&fallback_to_nfa_label_);
+}
+
+
 Handle<HeapObject> RegExpMacroAssemblerPPC::GetCode(Handle<String> source) {
   Label return_r3;
 
@@ -934,6 +940,13 @@ Handle<HeapObject> RegExpMacroAssemblerPPC::GetCode(Handle<String> source) {
       __ li(r3, Operand(EXCEPTION));
       __ b(&return_r3);
     }
+
+    if (fallback_to_nfa_label_.is_linked()) {
+      // Exit with Result FALLBACK_TO_NFA(-3) if the backtrack limit was hit.
+      __ bind(&fallback_to_nfa_label_);
+      __ li(r3, Operand(FALLBACK_TO_NFA));
+      __ b(&return_r3);
+    }
   }
 
   CodeDesc code_desc;
@@ -2,8 +2,6 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/regexp-macro-assembler-irregexp.h"
 
 #include "src/ast/ast.h"
@@ -193,6 +191,12 @@ void RegExpMacroAssemblerIrregexp::Fail() {
 }
 
 
+void RegExpMacroAssemblerIrregexp::FallbackToNfa() {
+  // The interpreter limits backtracks itself.
+  UNREACHABLE();
+}
+
+
 void RegExpMacroAssemblerIrregexp::AdvanceCurrentPosition(int by) {
   DCHECK(by >= kMinCPOffset);
   DCHECK(by <= kMaxCPOffset);
@@ -457,5 +461,3 @@ void RegExpMacroAssemblerIrregexp::Expand() {
 
 }  // namespace internal
 }  // namespace v8
-
-#endif  // V8_INTERPRETED_REGEXP
@@ -5,8 +5,6 @@
 #ifndef V8_REGEXP_REGEXP_MACRO_ASSEMBLER_IRREGEXP_H_
 #define V8_REGEXP_REGEXP_MACRO_ASSEMBLER_IRREGEXP_H_
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/regexp-macro-assembler.h"
 
 namespace v8 {
@@ -43,6 +41,7 @@ class RegExpMacroAssemblerIrregexp: public RegExpMacroAssembler {
   virtual void PushBacktrack(Label* label);
   virtual bool Succeed();
   virtual void Fail();
+  virtual void FallbackToNfa();
   virtual void PopRegister(int register_index);
   virtual void PushRegister(int register_index,
                             StackCheckFlag check_stack_limit);
@@ -128,6 +127,4 @@ class RegExpMacroAssemblerIrregexp: public RegExpMacroAssembler {
 }  // namespace internal
 }  // namespace v8
 
-#endif  // V8_INTERPRETED_REGEXP
-
 #endif  // V8_REGEXP_REGEXP_MACRO_ASSEMBLER_IRREGEXP_H_
@@ -98,6 +98,12 @@ void RegExpMacroAssemblerTracer::Fail() {
 }
 
 
+void RegExpMacroAssemblerTracer::FallbackToNfa() {
+  PrintF(" FallbackToNfa();\n");
+  assembler_->FallbackToNfa();
+}
+
+
 void RegExpMacroAssemblerTracer::PopRegister(int register_index) {
   PrintF(" PopRegister(register=%d);\n", register_index);
   assembler_->PopRegister(register_index);
@@ -278,7 +278,7 @@ NativeRegExpMacroAssembler::Result NativeRegExpMacroAssembler::Execute(
   int result = CALL_GENERATED_REGEXP_CODE(
       isolate, code->entry(), input, start_offset, input_start, input_end,
       output, output_size, stack_base, direct_call, isolate);
-  DCHECK(result >= RETRY);
+  DCHECK(result >= FALLBACK_TO_NFA);
 
   if (result == EXCEPTION && !isolate->has_pending_exception()) {
     // We detected a stack overflow (on the backtrack stack) in RegExp code,
@@ -120,6 +120,9 @@ class RegExpMacroAssembler {
   // May clobber the current loaded character.
   virtual bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match);
   virtual void Fail() = 0;
+  // Gives up on the match because it backtracked too much, so that the
+  // caller can finish it with the automaton. Only used by native code.
+  virtual void FallbackToNfa() = 0;
   virtual Handle<HeapObject> GetCode(Handle<String> source) = 0;
   virtual void GoTo(Label* label) = 0;
   // Check whether a register is >= a given constant and go to a label if it
@@ -209,7 +212,15 @@ class NativeRegExpMacroAssembler: public RegExpMacroAssembler {
   // FAILURE: Matching failed.
   // SUCCESS: Matching succeeded, and the output array has been filled with
   //        capture positions.
-  enum Result { RETRY = -2, EXCEPTION = -1, FAILURE = 0, SUCCESS = 1 };
+  // FALLBACK_TO_NFA: The backtrack limit was exceeded, and the match should
+  //        be done by the linear-time automaton instead.
+  enum Result {
+    FALLBACK_TO_NFA = -3,
+    RETRY = -2,
+    EXCEPTION = -1,
+    FAILURE = 0,
+    SUCCESS = 1
+  };
 
   NativeRegExpMacroAssembler(Isolate* isolate, Zone* zone);
   virtual ~NativeRegExpMacroAssembler();
@@ -0,0 +1,574 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-nfa.h"
+
+#include "src/char-predicates-inl.h"
+#include "src/factory.h"
+#include "src/objects-inl.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/zone.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Program layout: a header followed by instructions, all int32 words. Jump
+// targets are absolute word indices into the program.
+const int kRegisterCountIndex = 0;
+const int kAnchoredIndex = 1;
+const int kHeaderLength = 2;
+
+enum NfaOpcode {
+  kChar,    // c: consume the code unit c.
+  kClass,   // n, from_1, to_1, ..., from_n, to_n: consume a code unit in
+            // one of n sorted, disjoint ranges.
+  kSplit,   // x, y: continue at x, and with lower priority at y.
+  kJump,    // x: continue at x.
+  kSave,    // r: store the current position in register r.
+  kClear,   // from, to: reset registers from..to to -1.
+  kAssert,  // type: continue only if the RegExpAssertion holds.
+  kMatch
+};
+
+
+inline bool IsLineTerminator(uc32 c) {
+  return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+}
+
+
+class NfaSupportChecker final : public RegExpVisitor {
+ public:
+  NfaSupportChecker() : supported_(true) {}
+
+  bool supported() const { return supported_; }
+
+  void* VisitDisjunction(RegExpDisjunction* that, void* data) override {
+    ZoneList<RegExpTree*>* alternatives = that->alternatives();
+    for (int i = 0; i < alternatives->length(); i++) {
+      alternatives->at(i)->Accept(this, data);
+    }
+    return NULL;
+  }
+
+  void* VisitAlternative(RegExpAlternative* that, void* data) override {
+    ZoneList<RegExpTree*>* nodes = that->nodes();
+    for (int i = 0; i < nodes->length(); i++) {
+      nodes->at(i)->Accept(this, data);
+    }
+    return NULL;
+  }
+
+  void* VisitAssertion(RegExpAssertion* that, void* data) override {
+    return NULL;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* that, void* data) override {
+    return NULL;
+  }
+
+  void* VisitAtom(RegExpAtom* that, void* data) override { return NULL; }
+
+  void* VisitText(RegExpText* that, void* data) override { return NULL; }
+
+  void* VisitQuantifier(RegExpQuantifier* that, void* data) override {
+    if (that->is_possessive()) supported_ = false;
+    // Irregexp rejects empty iterations of a quantifier and keeps the
+    // captures of the last non-empty one; the automaton cannot tell them
+    // apart, which only matters if the body has captures.
+    if (that->max() > 0 && that->body()->min_match() == 0 &&
+        !that->body()->CaptureRegisters().is_empty()) {
+      supported_ = false;
+    }
+    return that->body()->Accept(this, data);
+  }
+
+  void* VisitCapture(RegExpCapture* that, void* data) override {
+    return that->body()->Accept(this, data);
+  }
+
+  void* VisitLookaround(RegExpLookaround* that, void* data) override {
+    supported_ = false;
+    return NULL;
+  }
+
+  void* VisitBackReference(RegExpBackReference* that, void* data) override {
+    supported_ = false;
+    return NULL;
+  }
+
+  void* VisitEmpty(RegExpEmpty* that, void* data) override { return NULL; }
+
+ private:
+  bool supported_;
+};
+
+
+class NfaCompiler final : public RegExpVisitor {
+ public:
+  NfaCompiler(Isolate* isolate, Zone* zone, bool ignore_case)
+      : isolate_(isolate),
+        zone_(zone),
+        ignore_case_(ignore_case),
+        code_(64, zone),
+        too_big_(false) {}
+
+  ZoneList<int>* code() { return &code_; }
+  bool too_big() const { return too_big_; }
+  int pc() const { return code_.length(); }
+
+  void Emit(int word) {
+    if (code_.length() >= RegExpNfa::kMaxProgramLength) {
+      too_big_ = true;
+      return;
+    }
+    code_.Add(word, zone_);
+  }
+
+  void Patch(int at, int target) {
+    if (!too_big_) code_[at] = target;
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* that, void* data) override {
+    ZoneList<RegExpTree*>* alternatives = that->alternatives();
+    ZoneList<int> jumps(alternatives->length(), zone_);
+    for (int i = 0; i < alternatives->length() - 1 && !too_big_; i++) {
+      int split = pc();
+      Emit(kSplit);
+      Emit(split + 3);
+      Emit(0);
+      alternatives->at(i)->Accept(this, data);
+      jumps.Add(pc() + 1, zone_);
+      Emit(kJump);
+      Emit(0);
+      Patch(split + 2, pc());
+    }
+    alternatives->last()->Accept(this, data);
+    for (int i = 0; i < jumps.length(); i++) Patch(jumps[i], pc());
+    return NULL;
+  }
+
+  void* VisitAlternative(RegExpAlternative* that, void* data) override {
+    ZoneList<RegExpTree*>* nodes = that->nodes();
+    for (int i = 0; i < nodes->length() && !too_big_; i++) {
+      nodes->at(i)->Accept(this, data);
+    }
+    return NULL;
+  }
+
+  void* VisitAssertion(RegExpAssertion* that, void* data) override {
+    Emit(kAssert);
+    Emit(that->assertion_type());
+    return NULL;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* that, void* data) override {
+    ZoneList<CharacterRange>* ranges =
+        new (zone_) ZoneList<CharacterRange>(2, zone_);
+    ranges->AddAll(*that->ranges(zone_), zone_);
+    CharacterRange::Canonicalize(ranges);
+    // None of the standard character classes is different in the case
+    // independent case.
+    if (ignore_case_ && !that->is_standard(zone_)) {
+      CharacterRange::AddCaseEquivalents(isolate_, zone_, ranges, false);
+      CharacterRange::Canonicalize(ranges);
+    }
+    if (that->is_negated()) {
+      ZoneList<CharacterRange>* negated =
+          new (zone_) ZoneList<CharacterRange>(ranges->length() + 1, zone_);
+      CharacterRange::Negate(ranges, negated, zone_);
+      ranges = negated;
+    }
+    EmitRanges(ranges);
+    return NULL;
+  }
+
+  void* VisitAtom(RegExpAtom* that, void* data) override {
+    Vector<const uc16> chars = that->data();
+    for (int i = 0; i < chars.length(); i++) EmitChar(chars[i]);
+    return NULL;
+  }
+
+  void* VisitText(RegExpText* that, void* data) override {
+    ZoneList<TextElement>* elements = that->elements();
+    for (int i = 0; i < elements->length() && !too_big_; i++) {
+      elements->at(i).tree()->Accept(this, data);
+    }
+    return NULL;
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* that, void* data) override {
+    RegExpTree* body = that->body();
+    Interval captures = body->CaptureRegisters();
+    for (int i = 0; i < that->min() && !too_big_; i++) {
+      EmitIteration(body, captures, data);
+    }
+    if (that->max() == RegExpTree::kInfinity) {
+      // loop: split body, exit; body; jump loop; exit:
+      int loop = pc();
+      Emit(kSplit);
+      Emit(0);
+      Emit(0);
+      int body_start = pc();
+      EmitIteration(body, captures, data);
+      Emit(kJump);
+      Emit(loop);
+      SetSplitTargets(loop, body_start, pc(), that->is_greedy());
+    } else {
+      // Each optional iteration may be skipped, which ends the repetition.
+      ZoneList<int> splits(2, zone_);
+      for (int i = that->min(); i < that->max() && !too_big_; i++) {
+        splits.Add(pc(), zone_);
+        Emit(kSplit);
+        Emit(0);
+        Emit(0);
+        EmitIteration(body, captures, data);
+      }
+      for (int i = 0; i < splits.length(); i++) {
+        SetSplitTargets(splits[i], splits[i] + 3, pc(), that->is_greedy());
+      }
+    }
+    return NULL;
+  }
+
+  void* VisitCapture(RegExpCapture* that, void* data) override {
+    Emit(kSave);
+    Emit(RegExpCapture::StartRegister(that->index()));
+    that->body()->Accept(this, data);
+    Emit(kSave);
+    Emit(RegExpCapture::EndRegister(that->index()));
+    return NULL;
+  }
+
+  void* VisitLookaround(RegExpLookaround* that, void* data) override {
+    UNREACHABLE();
+    return NULL;
+  }
+
+  void* VisitBackReference(RegExpBackReference* that, void* data) override {
+    UNREACHABLE();
+    return NULL;
+  }
+
+  void* VisitEmpty(RegExpEmpty* that, void* data) override { return NULL; }
+
+ private:
+  // Captures inside a quantified subexpression are reset at the start of
+  // every iteration.
+  void EmitIteration(RegExpTree* body, Interval captures, void* data) {
+    if (!captures.is_empty()) {
+      Emit(kClear);
+      Emit(captures.from());
+      Emit(captures.to());
+    }
+    body->Accept(this, data);
+  }
+
+  void SetSplitTargets(int split, int body, int exit, bool greedy) {
+    Patch(split + 1, greedy ? body : exit);
+    Patch(split + 2, greedy ? exit : body);
+  }
+
+  void EmitChar(uc16 c) {
+    if (!ignore_case_) {
+      Emit(kChar);
+      Emit(c);
+      return;
+    }
+    ZoneList<CharacterRange>* ranges =
+        CharacterRange::List(zone_, CharacterRange::Singleton(c));
+    CharacterRange::AddCaseEquivalents(isolate_, zone_, ranges, false);
+    CharacterRange::Canonicalize(ranges);
+    EmitRanges(ranges);
+  }
+
+  void EmitRanges(ZoneList<CharacterRange>* ranges) {
+    // Subjects are matched by UTF-16 code unit.
+    int count = 0;
+    while (count < ranges->length() &&
+           ranges->at(count).from() <= String::kMaxUtf16CodeUnit) {
+      count++;
+    }
+    if (count == 1 && ranges->at(0).IsSingleton()) {
+      Emit(kChar);
+      Emit(ranges->at(0).from());
+      return;
+    }
+    Emit(kClass);
+    Emit(count);
+    for (int i = 0; i < count; i++) {
+      Emit(ranges->at(i).from());
+      Emit(Min(ranges->at(i).to(), String::kMaxUtf16CodeUnit));
+    }
+  }
+
+  Isolate* isolate_;
+  Zone* zone_;
+  bool ignore_case_;
+  ZoneList<int> code_;
+  bool too_big_;
+};
+
+
+// Simulates the program with one thread per reachable instruction. Threads
+// are kept in priority order, which gives the same leftmost, first-
+// alternative-wins result as a backtracking search.
+template <typename Char>
+class NfaMatcher {
+ public:
+  NfaMatcher(Zone* zone, const int* program, int program_length,
+             Vector<const Char> subject)
+      : zone_(zone),
+        program_(program),
+        program_length_(program_length),
+        register_count_(program[kRegisterCountIndex]),
+        subject_(subject),
+        visited_(zone->NewArray<int>(program_length)),
+        registers_(zone->NewArray<int>(register_count_)),
+        jobs_(16, zone) {
+    for (int i = 0; i < program_length; i++) visited_[i] = 0;
+    InitializeThreadList(&current_);
+    InitializeThreadList(&next_);
+  }
+
+  RegExpImpl::IrregexpResult Match(int start_position, int* captures) {
+    bool anchored = program_[kAnchoredIndex] != 0;
+    bool matched = false;
+    ThreadList* current = &current_;
+    ThreadList* next = &next_;
+    for (int position = start_position; position <= subject_.length();
+         position++) {
+      if (!matched && (position == start_position || !anchored)) {
+        // A new attempt starting here has the lowest priority.
+        for (int i = 0; i < register_count_; i++) registers_[i] = -1;
+        AddThread(current, kHeaderLength, position);
+      }
+      if (current->length == 0) {
+        if (matched || anchored) break;
+        continue;
+      }
+      next->length = 0;
+      for (int i = 0; i < current->length; i++) {
+        int pc = current->pcs[i];
+        int* thread_registers = current->registers + i * register_count_;
+        if (program_[pc] == kMatch) {
+          MemCopy(captures, thread_registers, register_count_ * sizeof(int));
+          matched = true;
+          // Threads of lower priority cannot produce a preferred match.
+          break;
+        }
+        if (position == subject_.length()) continue;
+        uc16 c = subject_[position];
+        if (program_[pc] == kChar ? program_[pc + 1] == c
+                                  : ClassContains(pc, c)) {
+          MemCopy(registers_, thread_registers, register_count_ * sizeof(int));
+          AddThread(next, NextInstruction(pc), position + 1);
+        }
+      }
+      std::swap(current, next);
+    }
+    return matched ? RegExpImpl::RE_SUCCESS : RegExpImpl::RE_FAILURE;
+  }
+
+ private:
+  struct ThreadList {
+    int* pcs;
+    int* registers;
+    int length;
+  };
+
+  // Either an instruction to visit, or a register to restore once all
+  // instructions reached through the register's update have been visited.
+  struct Job {
+    int pc;
+    int reg;
+    int value;
+  };
+
+  void InitializeThreadList(ThreadList* list) {
+    list->pcs = zone_->NewArray<int>(program_length_);
+    list->registers = zone_->NewArray<int>(program_length_ * register_count_);
+    list->length = 0;
+  }
+
+  int NextInstruction(int pc) {
+    return program_[pc] == kChar ? pc + 2 : pc + 2 + 2 * program_[pc + 1];
+  }
+
+  bool ClassContains(int pc, uc16 c) {
+    int count = program_[pc + 1];
+    const int* ranges = program_ + pc + 2;
+    for (int i = 0; i < count; i++) {
+      if (c < ranges[2 * i]) return false;
+      if (c <= ranges[2 * i + 1]) return true;
+    }
+    return false;
+  }
+
+  bool IsWordAt(int position) {
+    return position >= 0 && position < subject_.length() &&
+           IsRegExpWord(subject_[position]);
+  }
+
+  bool AssertionHolds(int type, int position) {
+    switch (static_cast<RegExpAssertion::AssertionType>(type)) {
+      case RegExpAssertion::START_OF_INPUT:
+        return position == 0;
+      case RegExpAssertion::END_OF_INPUT:
+        return position == subject_.length();
+      case RegExpAssertion::START_OF_LINE:
+        return position == 0 || IsLineTerminator(subject_[position - 1]);
+      case RegExpAssertion::END_OF_LINE:
+        return position == subject_.length() ||
+               IsLineTerminator(subject_[position]);
+      case RegExpAssertion::BOUNDARY:
+        return IsWordAt(position - 1) != IsWordAt(position);
+      case RegExpAssertion::NON_BOUNDARY:
+        return IsWordAt(position - 1) == IsWordAt(position);
+    }
+    UNREACHABLE();
+    return false;
+  }
+
+  // Follows the non-consuming instructions from pc in priority order and
+  // adds a thread to the list for every consuming instruction reached. Each
+  // instruction is visited at most once per position, which bounds the work
+  // per character by the program length.
+  void AddThread(ThreadList* list, int start_pc, int position) {
+    // Stamps are unique per position, so visited_ needs no clearing.
+    int stamp = position + 1;
+    Job start = {start_pc, 0, 0};
+    jobs_.Add(start, zone_);
+    while (!jobs_.is_empty()) {
+      Job job = jobs_.RemoveLast();
+      if (job.pc < 0) {
+        registers_[job.reg] = job.value;
+        continue;
+      }
+      int pc = job.pc;
+      while (visited_[pc] != stamp) {
+        visited_[pc] = stamp;
+        switch (program_[pc]) {
+          case kJump:
+            pc = program_[pc + 1];
+            continue;
+          case kSplit: {
+            Job alternative = {program_[pc + 2], 0, 0};
+            jobs_.Add(alternative, zone_);
+            pc = program_[pc + 1];
+            continue;
+          }
+          case kSave:
+            SaveRegister(program_[pc + 1], position);
+            pc += 2;
+            continue;
+          case kClear:
+            for (int reg = program_[pc + 1]; reg <= program_[pc + 2]; reg++) {
+              SaveRegister(reg, -1);
+            }
+            pc += 3;
+            continue;
+          case kAssert:
+            if (!AssertionHolds(program_[pc + 1], position)) break;
+            pc += 2;
+            continue;
+          default:
+            DCHECK(program_[pc] == kChar || program_[pc] == kClass ||
+                   program_[pc] == kMatch);
+            list->pcs[list->length] = pc;
+            MemCopy(list->registers + list->length * register_count_,
+                    registers_, register_count_ * sizeof(int));
+            list->length++;
+            break;
+        }
+        break;
+      }
+    }
+  }
+
+  void SaveRegister(int reg, int value) {
+    Job restore = {-1, reg, registers_[reg]};
+    jobs_.Add(restore, zone_);
+    registers_[reg] = value;
+  }
+
+  Zone* zone_;
+  const int* program_;
+  int program_length_;
+  int register_count_;
+  Vector<const Char> subject_;
+  int* visited_;
+  // Registers of the thread being added.
+  int* registers_;
+  ZoneList<Job> jobs_;
+  ThreadList current_;
+  ThreadList next_;
+};
+
+}  // namespace
+
+
+bool RegExpNfa::CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags) {
+  // Unicode regexps match by code point and would need surrogate handling.
+  if ((flags & JSRegExp::kUnicode) != 0) return false;
+  NfaSupportChecker checker;
+  tree->Accept(&checker, NULL);
+  return checker.supported();
+}
+
+
+Handle<ByteArray> RegExpNfa::Compile(Isolate* isolate, Zone* zone,
+                                     RegExpTree* tree, JSRegExp::Flags flags,
+                                     int capture_count) {
+  if (!CanBeHandled(tree, flags)) return Handle<ByteArray>::null();
+  NfaCompiler compiler(isolate, zone, (flags & JSRegExp::kIgnoreCase) != 0);
+  bool anchored =
+      (flags & JSRegExp::kSticky) != 0 || tree->IsAnchoredAtStart();
+  compiler.Emit((capture_count + 1) * 2);
+  compiler.Emit(anchored ? 1 : 0);
+  DCHECK_EQ(kHeaderLength, compiler.pc());
+  // The whole match is capture 0.
+  compiler.Emit(kSave);
+  compiler.Emit(RegExpCapture::StartRegister(0));
+  tree->Accept(&compiler, NULL);
+  compiler.Emit(kSave);
+  compiler.Emit(RegExpCapture::EndRegister(0));
+  compiler.Emit(kMatch);
+  if (compiler.too_big()) return Handle<ByteArray>::null();
+
+  Vector<const int> code = compiler.code()->ToConstVector();
+  Handle<ByteArray> program =
+      isolate->factory()->NewByteArray(code.length() * kIntSize, TENURED);
+  program->copy_in(0, reinterpret_cast<const byte*>(code.start()),
+                   code.length() * kIntSize);
+  return program;
+}
+
+
+RegExpImpl::IrregexpResult RegExpNfa::Match(Isolate* isolate,
+                                            Handle<ByteArray> program,
+                                            Handle<String> subject,
+                                            int* captures,
+                                            int start_position) {
+  DCHECK(subject->IsFlat());
+  Zone zone(isolate->allocator());
+  DisallowHeapAllocation no_gc;
+  const int* code =
+      reinterpret_cast<const int*>(program->GetDataStartAddress());
+  int length = program->length() / kIntSize;
+  String::FlatContent content = subject->GetFlatContent();
+  if (content.IsOneByte()) {
+    NfaMatcher<uint8_t> matcher(&zone, code, length,
+                                content.ToOneByteVector());
+    return matcher.Match(start_position, captures);
+  } else {
+    DCHECK(content.IsTwoByte());
+    NfaMatcher<uc16> matcher(&zone, code, length, content.ToUC16Vector());
+    return matcher.Match(start_position, captures);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
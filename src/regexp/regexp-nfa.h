@@ -0,0 +1,50 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A linear-time regexp engine for the subset of regexps that do not need
+// backtracking: no back references, no lookarounds, and no captures inside
+// quantified subexpressions that can match the empty string. The RegExpTree
+// is compiled to a program for a Pike VM, which advances all candidate
+// threads in lockstep over the subject, so matching takes
+// O(subject length * program length) time regardless of the pattern.
+
+#ifndef V8_REGEXP_REGEXP_NFA_H_
+#define V8_REGEXP_REGEXP_NFA_H_
+
+#include "src/regexp/jsregexp.h"
+
+namespace v8 {
+namespace internal {
+
+class RegExpTree;
+
+class RegExpNfa : public AllStatic {
+ public:
+  // Whether the regexp with the given tree and flags is in the subset the
+  // automaton can execute with the same results as Irregexp.
+  static bool CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags);
+
+  // Compiles the tree to an automaton program. Returns a null handle if the
+  // regexp cannot be handled or the program would be too large.
+  static Handle<ByteArray> Compile(Isolate* isolate, Zone* zone,
+                                   RegExpTree* tree, JSRegExp::Flags flags,
+                                   int capture_count);
+
+  // Matches the program against the subject, starting the search at
+  // start_position. On success, the (capture_count + 1) * 2 capture
+  // registers are written to captures.
+  static RegExpImpl::IrregexpResult Match(Isolate* isolate,
+                                          Handle<ByteArray> program,
+                                          Handle<String> subject,
+                                          int* captures, int start_position);
+
+  // Upper bound on the program length in instruction words, which bounds
+  // the per-character cost of matching.
+  static const int kMaxProgramLength = 32 * KB;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_NFA_H_
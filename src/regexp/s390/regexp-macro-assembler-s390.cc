@@ -134,6 +134,7 @@ RegExpMacroAssemblerS390::~RegExpMacroAssemblerS390() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_to_nfa_label_.Unuse();
   internal_failure_label_.Unuse();
 }
 
@@ -605,6 +606,10 @@ void RegExpMacroAssemblerS390::Fail() {
   __ b(&exit_label_);
 }
 
+void RegExpMacroAssemblerS390::FallbackToNfa() {
+  __ b(&fallback_to_nfa_label_);
+}
+
 Handle<HeapObject> RegExpMacroAssemblerS390::GetCode(Handle<String> source) {
   Label return_r2;
 
@@ -932,6 +937,13 @@ Handle<HeapObject> RegExpMacroAssemblerS390::GetCode(Handle<String> source) {
     __ b(&return_r2);
   }
 
+  if (fallback_to_nfa_label_.is_linked()) {
+    // Exit with Result FALLBACK_TO_NFA(-3) if the backtrack limit was hit.
+    __ bind(&fallback_to_nfa_label_);
+    __ LoadImmP(r2, Operand(FALLBACK_TO_NFA));
+    __ b(&return_r2);
+  }
+
   CodeDesc code_desc;
   masm_->GetCode(&code_desc);
   Handle<Code> code = isolate()->factory()->NewCode(
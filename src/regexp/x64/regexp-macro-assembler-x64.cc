@@ -121,6 +121,7 @@ RegExpMacroAssemblerX64::~RegExpMacroAssemblerX64() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_to_nfa_label_.Unuse();
 }
 
 
@@ -665,6 +666,11 @@ void RegExpMacroAssemblerX64::Fail() {
 }
 
 
+void RegExpMacroAssemblerX64::FallbackToNfa() {
+  __ jmp(&fallback_to_nfa_label_);
+}
+
+
 Handle<HeapObject> RegExpMacroAssemblerX64::GetCode(Handle<String> source) {
   Label return_rax;
   // Finalize code - write the entry point code now we know how many
@@ -1000,6 +1006,13 @@ Handle<HeapObject> RegExpMacroAssemblerX64::GetCode(Handle<String> source) {
     __ jmp(&return_rax);
   }
 
+  if (fallback_to_nfa_label_.is_linked()) {
+    // Exit with Result FALLBACK_TO_NFA(-3) if the backtrack limit was hit.
+    __ bind(&fallback_to_nfa_label_);
+    __ Set(rax, FALLBACK_TO_NFA);
+    __ jmp(&return_rax);
+  }
+
   FixupCodeRelativePositions();
 
   CodeDesc code_desc;
@@ -107,6 +107,7 @@ RegExpMacroAssemblerX87::~RegExpMacroAssemblerX87() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_to_nfa_label_.Unuse();
 }
 
 
@@ -646,6 +647,11 @@ void RegExpMacroAssemblerX87::Fail() {
 }
 
 
+void RegExpMacroAssemblerX87::FallbackToNfa() {
+  __ jmp(&fallback_to_nfa_label_);
+}
+
+
 Handle<HeapObject> RegExpMacroAssemblerX87::GetCode(Handle<String> source) {
   Label return_eax;
   // Finalize code - write the entry point code now we know how many
@@ -930,6 +936,13 @@ Handle<HeapObject> RegExpMacroAssemblerX87::GetCode(Handle<String> source) {
     __ jmp(&return_eax);
   }
 
+  if (fallback_to_nfa_label_.is_linked()) {
+    // Exit with Result FALLBACK_TO_NFA(-3) if the backtrack limit was hit.
+    __ bind(&fallback_to_nfa_label_);
+    __ mov(eax, FALLBACK_TO_NFA);
+    __ jmp(&return_eax);
+  }
+
   CodeDesc code_desc;
   masm_->GetCode(&code_desc);
   Handle<Code> code =
@@ -11,6 +11,7 @@
 #include "src/full-codegen/full-codegen.h"
 #include "src/isolate-inl.h"
 #include "src/messages.h"
+#include "src/snapshot/snapshot.h"
 #include "src/v8threads.h"
 #include "src/vm-state-inl.h"
 
@@ -80,6 +81,37 @@ RUNTIME_FUNCTION(Runtime_CompileOptimized_NotConcurrent) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_DeserializeLazy) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+
+  // The calling trampoline knows which builtin it stands in for.
+  StackFrameIterator it(isolate);
+  it.Advance();
+  DCHECK(it.frame()->is_internal());
+  Handle<Code> trampoline(it.frame()->LookupCode(), isolate);
+  Builtins::Name name =
+      static_cast<Builtins::Name>(trampoline->builtin_index());
+
+  Handle<Code> code;
+  if (isolate->builtins()->IsDeserialized(name)) {
+    code = handle(isolate->builtins()->builtin(name), isolate);
+  } else {
+    code = Snapshot::DeserializeBuiltin(isolate, name);
+  }
+
+  // Later calls should not go through the trampoline again.
+  SharedFunctionInfo* shared = function->shared();
+  if (shared->code() == *trampoline) shared->ReplaceCode(*code);
+  if (shared->construct_stub() == *trampoline) {
+    shared->set_construct_stub(*code);
+  }
+  if (function->code() == *trampoline) function->ReplaceCode(*code);
+  return *code;
+}
+
+
 RUNTIME_FUNCTION(Runtime_NotifyStubFailure) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 0);
@@ -59,6 +59,36 @@ const UChar* GetUCharBufferFromFlat(const String::FlatContent& flat,
   }
 }
 
+
+Object* CompareStrings(Isolate* isolate, icu::Collator* collator,
+                       Handle<String> string1, Handle<String> string2) {
+  string1 = String::Flatten(string1);
+  string2 = String::Flatten(string2);
+  DisallowHeapAllocation no_gc;
+  int32_t length1 = string1->length();
+  int32_t length2 = string2->length();
+  String::FlatContent flat1 = string1->GetFlatContent();
+  String::FlatContent flat2 = string2->GetFlatContent();
+  base::SmartArrayPointer<uc16> sap1;
+  base::SmartArrayPointer<uc16> sap2;
+  const UChar* string_val1 = GetUCharBufferFromFlat(flat1, &sap1, length1);
+  const UChar* string_val2 = GetUCharBufferFromFlat(flat2, &sap2, length2);
+  UErrorCode status = U_ZERO_ERROR;
+  UCollationResult result =
+      collator->compare(string_val1, length1, string_val2, length2, status);
+  if (U_FAILURE(status)) return isolate->ThrowIllegalOperation();
+
+  return *isolate->factory()->NewNumberFromInt(result);
+}
+
+
+Object* FormatResult(Isolate* isolate, const icu::UnicodeString& result) {
+  RETURN_RESULT_OR_FAILURE(
+      isolate, isolate->factory()->NewStringFromTwoByte(Vector<const uint16_t>(
+                   reinterpret_cast<const uint16_t*>(result.getBuffer()),
+                   result.length())));
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_CanonicalizeLanguageTag) {
@@ -413,6 +443,52 @@ RUNTIME_FUNCTION(Runtime_InternalDateParse) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_CachedDateFormat) {
+  HandleScope scope(isolate);
+
+  DCHECK(args.length() == 3);
+
+  CONVERT_ARG_HANDLE_CHECKED(String, locale, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, options, 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, date, 2);
+
+  icu::SimpleDateFormat* date_format =
+      DateFormat::GetCachedDateFormat(isolate, locale, options);
+  if (!date_format) return isolate->ThrowIllegalOperation();
+  if (DateFormat::HasUnknownTimeZone(date_format)) {
+    Handle<String> time_zone = isolate->factory()->NewStringFromStaticChars(
+        "timeZone");
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewRangeError(MessageTemplate::kUnsupportedTimeZone,
+                               JSReceiver::GetDataProperty(options,
+                                                           time_zone)));
+  }
+
+  Handle<Object> value;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, value, Object::ToNumber(date));
+  double date_ms = value->Number();
+  if (!std::isfinite(date_ms)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewRangeError(MessageTemplate::kDateRange));
+  }
+  // Clip the time value like the Date constructor does.
+  if (-DateCache::kMaxTimeInMs <= date_ms &&
+      date_ms <= DateCache::kMaxTimeInMs) {
+    date_ms = DoubleToInteger(date_ms) + 0.0;
+  } else {
+    date_ms = std::numeric_limits<double>::quiet_NaN();
+  }
+
+  // The conversion above may have run JavaScript that cleared the cache.
+  date_format = DateFormat::GetCachedDateFormat(isolate, locale, options);
+  if (!date_format) return isolate->ThrowIllegalOperation();
+
+  icu::UnicodeString result;
+  date_format->format(date_ms, result);
+  return FormatResult(isolate, result);
+}
+
+
 RUNTIME_FUNCTION(Runtime_CreateNumberFormat) {
   HandleScope scope(isolate);
 
@@ -518,6 +594,25 @@ RUNTIME_FUNCTION(Runtime_InternalNumberParse) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_CachedNumberFormat) {
+  HandleScope scope(isolate);
+
+  DCHECK(args.length() == 3);
+
+  CONVERT_ARG_HANDLE_CHECKED(String, locale, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, options, 1);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(number, 2);
+
+  icu::DecimalFormat* number_format =
+      NumberFormat::GetCachedNumberFormat(isolate, locale, options);
+  if (!number_format) return isolate->ThrowIllegalOperation();
+
+  icu::UnicodeString result;
+  number_format->format(number->Number(), result);
+  return FormatResult(isolate, result);
+}
+
+
 RUNTIME_FUNCTION(Runtime_CreateCollator) {
   HandleScope scope(isolate);
 
@@ -567,23 +662,29 @@ RUNTIME_FUNCTION(Runtime_InternalCompare) {
   icu::Collator* collator = Collator::UnpackCollator(isolate, collator_holder);
   if (!collator) return isolate->ThrowIllegalOperation();
 
+  return CompareStrings(isolate, collator, string1, string2);
+}
+
+
+RUNTIME_FUNCTION(Runtime_CachedCompare) {
+  HandleScope scope(isolate);
+
+  DCHECK(args.length() == 4);
+
+  CONVERT_ARG_HANDLE_CHECKED(String, locale, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, options, 1);
+  CONVERT_ARG_HANDLE_CHECKED(String, string1, 2);
+  CONVERT_ARG_HANDLE_CHECKED(String, string2, 3);
+
+  // Flattening may allocate and trigger a GC that clears the cache, so it
+  // has to happen before the cached collator is looked up.
   string1 = String::Flatten(string1);
   string2 = String::Flatten(string2);
-  DisallowHeapAllocation no_gc;
-  int32_t length1 = string1->length();
-  int32_t length2 = string2->length();
-  String::FlatContent flat1 = string1->GetFlatContent();
-  String::FlatContent flat2 = string2->GetFlatContent();
-  base::SmartArrayPointer<uc16> sap1;
-  base::SmartArrayPointer<uc16> sap2;
-  const UChar* string_val1 = GetUCharBufferFromFlat(flat1, &sap1, length1);
-  const UChar* string_val2 = GetUCharBufferFromFlat(flat2, &sap2, length2);
-  UErrorCode status = U_ZERO_ERROR;
-  UCollationResult result =
-      collator->compare(string_val1, length1, string_val2, length2, status);
-  if (U_FAILURE(status)) return isolate->ThrowIllegalOperation();
+  icu::Collator* collator =
+      Collator::GetCachedCollator(isolate, locale, options);
+  if (!collator) return isolate->ThrowIllegalOperation();
 
-  return *isolate->factory()->NewNumberFromInt(result);
+  return CompareStrings(isolate, collator, string1, string2);
 }
 
 
@@ -903,8 +903,7 @@ MUST_USE_RESULT static Object* ConvertCaseHelper(
 }
 
 
-static const uintptr_t kOneInEveryByte = kUintptrAllBitsSet / 0xFF;
-static const uintptr_t kAsciiMask = kOneInEveryByte << 7;
+static const uintptr_t kAsciiMask = kHighBitInEveryByte;
 
 // Given a word and two range boundaries returns a word with high bit
 // set in every byte iff the corresponding input byte was strictly in
@@ -125,6 +125,7 @@ namespace internal {
   F(CompileBaseline, 1, 1)                \
   F(CompileOptimized_Concurrent, 1, 1)    \
   F(CompileOptimized_NotConcurrent, 1, 1) \
+  F(DeserializeLazy, 1, 1)                \
   F(NotifyStubFailure, 0, 1)              \
   F(NotifyDeoptimized, 1, 1)              \
   F(CompileForOnStackReplacement, 1, 1)   \
@@ -254,11 +255,14 @@ namespace internal {
   F(CreateDateTimeFormat, 3, 1)              \
   F(InternalDateFormat, 2, 1)                \
   F(InternalDateParse, 2, 1)                 \
+  F(CachedDateFormat, 3, 1)                  \
   F(CreateNumberFormat, 3, 1)                \
   F(InternalNumberFormat, 2, 1)              \
   F(InternalNumberParse, 2, 1)               \
+  F(CachedNumberFormat, 3, 1)                \
   F(CreateCollator, 3, 1)                    \
   F(InternalCompare, 3, 1)                   \
+  F(CachedCompare, 4, 1)                     \
   F(StringNormalize, 2, 1)                   \
   F(CreateBreakIterator, 3, 1)               \
   F(BreakIteratorAdoptText, 2, 1)            \
@@ -0,0 +1,859 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/ryu-dtoa.h"
+
+#include <stdint.h>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/double.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+// The algorithm maps the interval of real numbers that round to the input
+// double to decimal by multiplying its bounds with 128-bit approximations of
+// 5^-q (for inputs >= 1) or 5^i (for inputs < 1). The approximations carry
+// enough bits that the integer parts of the products are exact for every
+// double, so digits can be removed from the bounds until they meet without
+// ever consulting the exact value.
+static const int kPow5InverseBitCount = 125;
+static const int kPow5BitCount = 125;
+
+// kPow5InverseSplit[q] is floor(2^(bitlength(5^q) - 1 + 125) / 5^q) + 1,
+// stored as {low 64 bits, high 64 bits}.
+static const uint64_t kPow5InverseSplit[][2] = {
+  {V8_UINT64_C(0x0000000000000001), V8_UINT64_C(0x2000000000000000)},
+  {V8_UINT64_C(0x999999999999999a), V8_UINT64_C(0x1999999999999999)},
+  {V8_UINT64_C(0x47ae147ae147ae15), V8_UINT64_C(0x147ae147ae147ae1)},
+  {V8_UINT64_C(0x6c8b4395810624de), V8_UINT64_C(0x10624dd2f1a9fbe7)},
+  {V8_UINT64_C(0x7a786c226809d496), V8_UINT64_C(0x1a36e2eb1c432ca5)},
+  {V8_UINT64_C(0x61f9f01b866e43ab), V8_UINT64_C(0x14f8b588e368f084)},
+  {V8_UINT64_C(0xb4c7f34938583622), V8_UINT64_C(0x10c6f7a0b5ed8d36)},
+  {V8_UINT64_C(0x87a6520ec08d236a), V8_UINT64_C(0x1ad7f29abcaf4857)},
+  {V8_UINT64_C(0x9fb841a566d74f88), V8_UINT64_C(0x15798ee2308c39df)},
+  {V8_UINT64_C(0xe62d01511f12a607), V8_UINT64_C(0x112e0be826d694b2)},
+  {V8_UINT64_C(0xd6ae6881cb5109a4), V8_UINT64_C(0x1b7cdfd9d7bdbab7)},
+  {V8_UINT64_C(0xdef1ed34a2a73aea), V8_UINT64_C(0x15fd7fe17964955f)},
+  {V8_UINT64_C(0x7f27f0f6e885c8bb), V8_UINT64_C(0x119799812dea1119)},
+  {V8_UINT64_C(0x650cb4be40d60df8), V8_UINT64_C(0x1c25c268497681c2)},
+  {V8_UINT64_C(0xea70909833de7193), V8_UINT64_C(0x16849b86a12b9b01)},
+  {V8_UINT64_C(0x21f3a6e0297ec143), V8_UINT64_C(0x1203af9ee756159b)},
+  {V8_UINT64_C(0x6985d7cd0f313537), V8_UINT64_C(0x1cd2b297d889bc2b)},
+  {V8_UINT64_C(0x2137dfd73f5a90f9), V8_UINT64_C(0x170ef54646d49689)},
+  {V8_UINT64_C(0xe75fe645cc4873fa), V8_UINT64_C(0x12725dd1d243aba0)},
+  {V8_UINT64_C(0xa5663d3c7a0d865d), V8_UINT64_C(0x1d83c94fb6d2ac34)},
+  {V8_UINT64_C(0x511e976394d79eb1), V8_UINT64_C(0x179ca10c9242235d)},
+  {V8_UINT64_C(0xda7edf82dd794bc1), V8_UINT64_C(0x12e3b40a0e9b4f7d)},
+  {V8_UINT64_C(0x2a6498d1625bac68), V8_UINT64_C(0x1e392010175ee596)},
+  {V8_UINT64_C(0xeeb6e0a781e2f053), V8_UINT64_C(0x182db34012b25144)},
+  {V8_UINT64_C(0x58924d52ce4f26a9), V8_UINT64_C(0x1357c299a88ea76a)},
+  {V8_UINT64_C(0x27507bb7b07ea441), V8_UINT64_C(0x1ef2d0f5da7dd8aa)},
+  {V8_UINT64_C(0x52a6c95fc0655034), V8_UINT64_C(0x18c240c4aecb13bb)},
+  {V8_UINT64_C(0x0eebd44c99eaa690), V8_UINT64_C(0x13ce9a36f23c0fc9)},
+  {V8_UINT64_C(0xb17953adc3110a80), V8_UINT64_C(0x1fb0f6be50601941)},
+  {V8_UINT64_C(0xc12ddc8b02740867), V8_UINT64_C(0x195a5efea6b34767)},
+  {V8_UINT64_C(0x3424b06f3529a052), V8_UINT64_C(0x14484bfeebc29f86)},
+  {V8_UINT64_C(0x901d59f290ee19db), V8_UINT64_C(0x1039d66589687f9e)},
+  {V8_UINT64_C(0x4cfbc31db4b0295f), V8_UINT64_C(0x19f623d5a8a73297)},
+  {V8_UINT64_C(0x3d9635b15d59bab2), V8_UINT64_C(0x14c4e977ba1f5bac)},
+  {V8_UINT64_C(0x97ab5e277de16228), V8_UINT64_C(0x109d8792fb4c4956)},
+  {V8_UINT64_C(0xf2abc9d8c9689d0d), V8_UINT64_C(0x1a95a5b7f87a0ef0)},
+  {V8_UINT64_C(0x5bbca17a3aba173e), V8_UINT64_C(0x154484932d2e725a)},
+  {V8_UINT64_C(0xafca1ac82efb45cb), V8_UINT64_C(0x11039d428a8b8eae)},
+  {V8_UINT64_C(0xb2dcf7a6b1920945), V8_UINT64_C(0x1b38fb9daa78e44a)},
+  {V8_UINT64_C(0xf57d92ebc141a104), V8_UINT64_C(0x15c72fb1552d836e)},
+  {V8_UINT64_C(0xc46475896767b403), V8_UINT64_C(0x116c262777579c58)},
+  {V8_UINT64_C(0x6d6d88dbd8a5ecd2), V8_UINT64_C(0x1be03d0bf225c6f4)},
+  {V8_UINT64_C(0x8abe071646eb23db), V8_UINT64_C(0x164cfda3281e38c3)},
+  {V8_UINT64_C(0x6efe6c11d255b649), V8_UINT64_C(0x11d7314f534b609c)},
+  {V8_UINT64_C(0xb197134fb6ef8a0e), V8_UINT64_C(0x1c8b821885456760)},
+  {V8_UINT64_C(0x27ac0f72f8bfa1a5), V8_UINT64_C(0x16d601ad376ab91a)},
+  {V8_UINT64_C(0xb95672c260994e1e), V8_UINT64_C(0x1244ce242c5560e1)},
+  {V8_UINT64_C(0xf5571e03cdc21695), V8_UINT64_C(0x1d3ae36d13bbce35)},
+  {V8_UINT64_C(0x2aac18030b01abab), V8_UINT64_C(0x17624f8a762fd82b)},
+  {V8_UINT64_C(0xbbbce0026f348956), V8_UINT64_C(0x12b50c6ec4f31355)},
+  {V8_UINT64_C(0x92c7ccd0b1eda889), V8_UINT64_C(0x1dee7a4ad4b81eef)},
+  {V8_UINT64_C(0xdbd30a408e57ba07), V8_UINT64_C(0x17f1fb6f10934bf2)},
+  {V8_UINT64_C(0x7ca8d50071dfc806), V8_UINT64_C(0x1327fc58da0f6ff5)},
+  {V8_UINT64_C(0xfaa7bb33e9660cd6), V8_UINT64_C(0x1ea6608e29b24cbb)},
+  {V8_UINT64_C(0x9552fc298784d711), V8_UINT64_C(0x18851a0b548ea3c9)},
+  {V8_UINT64_C(0xaaa8c9bad2d0ac0e), V8_UINT64_C(0x139dae6f76d88307)},
+  {V8_UINT64_C(0xdddadc5e1e1aace3), V8_UINT64_C(0x1f62b0b257c0d1a5)},
+  {V8_UINT64_C(0x7e48b04b4b488a4f), V8_UINT64_C(0x191bc08eac9a4151)},
+  {V8_UINT64_C(0xcb6d59d5d5d3a1d9), V8_UINT64_C(0x141633a556e1cdda)},
+  {V8_UINT64_C(0x3c577b1177dc817b), V8_UINT64_C(0x1011c2eaabe7d7e2)},
+  {V8_UINT64_C(0xc6f25e825960cf2a), V8_UINT64_C(0x19b604aaaca62636)},
+  {V8_UINT64_C(0x6bf518684780a5bb), V8_UINT64_C(0x14919d5556eb51c5)},
+  {V8_UINT64_C(0x232a79ed06008496), V8_UINT64_C(0x10747ddddf22a7d1)},
+  {V8_UINT64_C(0xd1dd8fe1a3340756), V8_UINT64_C(0x1a53fc9631d10c81)},
+  {V8_UINT64_C(0xa7e4731ae8f66c45), V8_UINT64_C(0x150ffd44f4a73d34)},
+  {V8_UINT64_C(0x531d28e253f8569e), V8_UINT64_C(0x10d9976a5d52975d)},
+  {V8_UINT64_C(0xeb61db03b98d5762), V8_UINT64_C(0x1af5bf109550f22e)},
+  {V8_UINT64_C(0xbc4e48cfc7a445e8), V8_UINT64_C(0x159165a6ddda5b58)},
+  {V8_UINT64_C(0x6371d3d96c836b20), V8_UINT64_C(0x11411e1f17e1e2ad)},
+  {V8_UINT64_C(0x9f1c8628ad9f11cd), V8_UINT64_C(0x1b9b6364f3030448)},
+  {V8_UINT64_C(0xe5b06b53be18db0b), V8_UINT64_C(0x1615e91d8f359d06)},
+  {V8_UINT64_C(0xeaf3890fcb4715a2), V8_UINT64_C(0x11ab20e472914a6b)},
+  {V8_UINT64_C(0x44b8db4c7871bc37), V8_UINT64_C(0x1c45016d841baa46)},
+  {V8_UINT64_C(0x03c715d6c6c1635f), V8_UINT64_C(0x169d9abe03495505)},
+  {V8_UINT64_C(0x3638de456bcde919), V8_UINT64_C(0x1217aefe69077737)},
+  {V8_UINT64_C(0x56c163a2461641c1), V8_UINT64_C(0x1cf2b1970e725858)},
+  {V8_UINT64_C(0xdf011c81d1ab67ce), V8_UINT64_C(0x17288e1271f51379)},
+  {V8_UINT64_C(0x7f3416ce4155eca5), V8_UINT64_C(0x1286d80ec190dc61)},
+  {V8_UINT64_C(0x6520247d3556476e), V8_UINT64_C(0x1da48ce468e7c702)},
+  {V8_UINT64_C(0xea801d30f7783925), V8_UINT64_C(0x17b6d71d20b96c01)},
+  {V8_UINT64_C(0xbb99b0f3f92cfa84), V8_UINT64_C(0x12f8ac174d612334)},
+  {V8_UINT64_C(0x5f5c4e532847f739), V8_UINT64_C(0x1e5aacf215683854)},
+  {V8_UINT64_C(0x7f7d0b75b9d32c2e), V8_UINT64_C(0x18488a5b44536043)},
+  {V8_UINT64_C(0x9930d5f7c7dc2358), V8_UINT64_C(0x136d3b7c36a919cf)},
+  {V8_UINT64_C(0x8eb4898c72f9d226), V8_UINT64_C(0x1f152bf9f10e8fb2)},
+  {V8_UINT64_C(0x722a07a38f2e41b8), V8_UINT64_C(0x18ddbcc7f40ba628)},
+  {V8_UINT64_C(0xc1bb394fa5be9afa), V8_UINT64_C(0x13e497065cd61e86)},
+  {V8_UINT64_C(0x9c5ec2190930f7f6), V8_UINT64_C(0x1fd424d6faf030d7)},
+  {V8_UINT64_C(0x49e56814075a5ff8), V8_UINT64_C(0x197683df2f268d79)},
+  {V8_UINT64_C(0x6e51201005e1e660), V8_UINT64_C(0x145ecfe5bf520ac7)},
+  {V8_UINT64_C(0xf1da800cd181851a), V8_UINT64_C(0x104bd984990e6f05)},
+  {V8_UINT64_C(0x4fc400148268d4f5), V8_UINT64_C(0x1a12f5a0f4e3e4d6)},
+  {V8_UINT64_C(0xd96999aa01ed772b), V8_UINT64_C(0x14dbf7b3f71cb711)},
+  {V8_UINT64_C(0xadee1488018ac5bc), V8_UINT64_C(0x10aff95cc5b09274)},
+  {V8_UINT64_C(0x497ceda668de092c), V8_UINT64_C(0x1ab328946f80ea54)},
+  {V8_UINT64_C(0x3aca57b853e4d424), V8_UINT64_C(0x155c2076bf9a5510)},
+  {V8_UINT64_C(0x623b7960431d7683), V8_UINT64_C(0x1116805effaeaa73)},
+  {V8_UINT64_C(0x9d2bf566d1c8bd9e), V8_UINT64_C(0x1b5733cb32b110b8)},
+  {V8_UINT64_C(0x7dbcc452416d647f), V8_UINT64_C(0x15df5ca28ef40d60)},
+  {V8_UINT64_C(0xcafd69db678ab6cc), V8_UINT64_C(0x117f7d4ed8c33de6)},
+  {V8_UINT64_C(0xab2f0fc572778adf), V8_UINT64_C(0x1bff2ee48e052fd7)},
+  {V8_UINT64_C(0x88f273045b92d580), V8_UINT64_C(0x1665bf1d3e6a8cac)},
+  {V8_UINT64_C(0xd3f528d049424466), V8_UINT64_C(0x11eaff4a98553d56)},
+  {V8_UINT64_C(0xb988414d4203a0a3), V8_UINT64_C(0x1cab3210f3bb9557)},
+  {V8_UINT64_C(0x6139cdd76802e6e9), V8_UINT64_C(0x16ef5b40c2fc7779)},
+  {V8_UINT64_C(0xe761717920025254), V8_UINT64_C(0x125915cd68c9f92d)},
+  {V8_UINT64_C(0xa568b58e999d5086), V8_UINT64_C(0x1d5b561574765b7c)},
+  {V8_UINT64_C(0x5120913ee14aa6d2), V8_UINT64_C(0x177c44ddf6c515fd)},
+  {V8_UINT64_C(0xa74d40ff1aa21f0e), V8_UINT64_C(0x12c9d0b1923744ca)},
+  {V8_UINT64_C(0x0baece64f769cb4a), V8_UINT64_C(0x1e0fb44f50586e11)},
+  {V8_UINT64_C(0x3c8bd850c5ee3c3b), V8_UINT64_C(0x180c903f7379f1a7)},
+  {V8_UINT64_C(0xca0979da37f1c9c9), V8_UINT64_C(0x133d4032c2c7f485)},
+  {V8_UINT64_C(0xa9a8c2f6bfe942db), V8_UINT64_C(0x1ec866b79e0cba6f)},
+  {V8_UINT64_C(0x2153cf2bccba9be3), V8_UINT64_C(0x18a0522c7e709526)},
+  {V8_UINT64_C(0x1aa9728970954982), V8_UINT64_C(0x13b374f06526ddb8)},
+  {V8_UINT64_C(0xf775840f1a88759d), V8_UINT64_C(0x1f8587e7083e2f8c)},
+  {V8_UINT64_C(0x5f9136727ba05e17), V8_UINT64_C(0x19379fec0698260a)},
+  {V8_UINT64_C(0x1940f85b9619e4df), V8_UINT64_C(0x142c7ff0054684d5)},
+  {V8_UINT64_C(0xe100c6afab47ea4c), V8_UINT64_C(0x1023998cd1053710)},
+  {V8_UINT64_C(0xce67a44c453fdd47), V8_UINT64_C(0x19d28f47b4d524e7)},
+  {V8_UINT64_C(0xd852e9d69dccb106), V8_UINT64_C(0x14a8729fc3ddb71f)},
+  {V8_UINT64_C(0x79dbee454b0a2738), V8_UINT64_C(0x1086c219697e2c19)},
+  {V8_UINT64_C(0x295fe3a211a9d859), V8_UINT64_C(0x1a71368f0f30468f)},
+  {V8_UINT64_C(0xbab31c81a7bb137a), V8_UINT64_C(0x15275ed8d8f36ba5)},
+  {V8_UINT64_C(0x6228e39aec95a92f), V8_UINT64_C(0x10ec4be0ad8f8951)},
+  {V8_UINT64_C(0x9d0e38f7e0ef7517), V8_UINT64_C(0x1b13ac9aaf4c0ee8)},
+  {V8_UINT64_C(0xb0d82d931a592a79), V8_UINT64_C(0x15a956e225d67253)},
+  {V8_UINT64_C(0x8d79be0f4847552e), V8_UINT64_C(0x11544581b7dec1dc)},
+  {V8_UINT64_C(0x158f967eda0bbb7c), V8_UINT64_C(0x1bba08cf8c979c94)},
+  {V8_UINT64_C(0x77a611ff14d62f97), V8_UINT64_C(0x162e6d72d6dfb076)},
+  {V8_UINT64_C(0xf951a7ff43de8c79), V8_UINT64_C(0x11bebdf578b2f391)},
+  {V8_UINT64_C(0xc21c3ffed2fdad8e), V8_UINT64_C(0x1c6463225ab7ec1c)},
+  {V8_UINT64_C(0x01b0333242648ad8), V8_UINT64_C(0x16b6b5b5155ff017)},
+  {V8_UINT64_C(0x0159c28e9b83a246), V8_UINT64_C(0x122bc490dde659ac)},
+  {V8_UINT64_C(0xcef604175f3903a3), V8_UINT64_C(0x1d12d41afca3c2ac)},
+  {V8_UINT64_C(0x725e69ac4c2d9c83), V8_UINT64_C(0x17424348ca1c9bbd)},
+  {V8_UINT64_C(0xf5185489d68ae39c), V8_UINT64_C(0x129b69070816e2fd)},
+  {V8_UINT64_C(0xee8d540fbdab05c6), V8_UINT64_C(0x1dc574d80cf16b2f)},
+  {V8_UINT64_C(0xbed77672fe226b05), V8_UINT64_C(0x17d12a4670c1228c)},
+  {V8_UINT64_C(0xff12c528cb4ebc04), V8_UINT64_C(0x130dbb6b8d674ed6)},
+  {V8_UINT64_C(0xcb513b74787df9a0), V8_UINT64_C(0x1e7c5f127bd87e24)},
+  {V8_UINT64_C(0x090dc929f9fe614d), V8_UINT64_C(0x18637f41fcad31b7)},
+  {V8_UINT64_C(0xa0d7d42194cb810a), V8_UINT64_C(0x1382cc34ca2427c5)},
+  {V8_UINT64_C(0x67bfb9cf5478ce77), V8_UINT64_C(0x1f37ad21436d0c6f)},
+  {V8_UINT64_C(0x1fcc94a5dd2d71f9), V8_UINT64_C(0x18f9574dcf8a7059)},
+  {V8_UINT64_C(0x7fd6dd517dbdf4c7), V8_UINT64_C(0x13faac3e3fa1f37a)},
+  {V8_UINT64_C(0xffbe2ee8c92fee0b), V8_UINT64_C(0x1ff779fd329cb8c3)},
+  {V8_UINT64_C(0x6631bf20a0f324d6), V8_UINT64_C(0x1992c7fdc216fa36)},
+  {V8_UINT64_C(0xb827cc1a1a5c1d78), V8_UINT64_C(0x14756ccb01abfb5e)},
+  {V8_UINT64_C(0x935309ae7b7ce460), V8_UINT64_C(0x105df0a267bcc918)},
+  {V8_UINT64_C(0x1eeb42b0c594a099), V8_UINT64_C(0x1a2fe76a3f9474f4)},
+  {V8_UINT64_C(0xe58902270476e6e1), V8_UINT64_C(0x14f31f8832dd2a5c)},
+  {V8_UINT64_C(0xb7a0ce859d2bebe7), V8_UINT64_C(0x10c27fa028b0eeb0)},
+  {V8_UINT64_C(0x59014a6f61dfdfd8), V8_UINT64_C(0x1ad0cc33744e4ab4)},
+  {V8_UINT64_C(0xe0cdd525e7e64cad), V8_UINT64_C(0x1573d68f903ea229)},
+  {V8_UINT64_C(0x4d7177518651d6f1), V8_UINT64_C(0x11297872d9cbb4ee)},
+  {V8_UINT64_C(0x7be8bee8d6e957e8), V8_UINT64_C(0x1b758d848fac54b0)},
+  {V8_UINT64_C(0xfcba3253df211320), V8_UINT64_C(0x15f7a46a0c89dd59)},
+  {V8_UINT64_C(0x63c8284318e74280), V8_UINT64_C(0x1192e9ee706e4aae)},
+  {V8_UINT64_C(0x060d0d3827d86a66), V8_UINT64_C(0x1c1e43171a4a1117)},
+  {V8_UINT64_C(0x6b3da42cecad21eb), V8_UINT64_C(0x167e9c127b6e7412)},
+  {V8_UINT64_C(0x88fe1cf0bd574e56), V8_UINT64_C(0x11fee341fc585cdb)},
+  {V8_UINT64_C(0x419694b462254a23), V8_UINT64_C(0x1ccb0536608d615f)},
+  {V8_UINT64_C(0x67abaa29e81dd4e9), V8_UINT64_C(0x1708d0f84d3de77f)},
+  {V8_UINT64_C(0xb95621bb2017dd87), V8_UINT64_C(0x126d73f9d764b932)},
+  {V8_UINT64_C(0xc223692b668c95a5), V8_UINT64_C(0x1d7becc2f23ac1ea)},
+  {V8_UINT64_C(0xce82ba891ed6de1d), V8_UINT64_C(0x179657025b6234bb)},
+  {V8_UINT64_C(0xa53562074bdf1818), V8_UINT64_C(0x12deac01e2b4f6fc)},
+  {V8_UINT64_C(0x3b889cd87964f359), V8_UINT64_C(0x1e3113363787f194)},
+  {V8_UINT64_C(0xfc6d4a46c783f5e1), V8_UINT64_C(0x18274291c6065adc)},
+  {V8_UINT64_C(0x30576e9f06032b1a), V8_UINT64_C(0x13529ba7d19eaf17)},
+  {V8_UINT64_C(0x1a257dcb3cd1de90), V8_UINT64_C(0x1eea92a61c311825)},
+  {V8_UINT64_C(0x481dfe3c30a7e540), V8_UINT64_C(0x18bba884e35a79b7)},
+  {V8_UINT64_C(0xd34b31c9c0865100), V8_UINT64_C(0x13c9539d82aec7c5)},
+  {V8_UINT64_C(0x5211e942cda3b4cd), V8_UINT64_C(0x1fa885c8d117a609)},
+  {V8_UINT64_C(0x74db21023e1c90a4), V8_UINT64_C(0x19539e3a40dfb807)},
+  {V8_UINT64_C(0xf715b401cb4a0d50), V8_UINT64_C(0x1442e4fb67196005)},
+  {V8_UINT64_C(0xf8de299b09080aa7), V8_UINT64_C(0x103583fc527ab337)},
+  {V8_UINT64_C(0x8e304291a80cddd7), V8_UINT64_C(0x19ef3993b72ab859)},
+  {V8_UINT64_C(0x3e8d020e200a4b13), V8_UINT64_C(0x14bf6142f8eef9e1)},
+  {V8_UINT64_C(0x653d9b3e80083c0f), V8_UINT64_C(0x10991a9bfa58c7e7)},
+  {V8_UINT64_C(0x6ec8f864000d2ce4), V8_UINT64_C(0x1a8e90f9908e0ca5)},
+  {V8_UINT64_C(0x8bd3f9e999a423ea), V8_UINT64_C(0x153eda614071a3b7)},
+  {V8_UINT64_C(0x3ca994bae1501cbb), V8_UINT64_C(0x10ff151a99f482f9)},
+  {V8_UINT64_C(0xc775bac49bb3612b), V8_UINT64_C(0x1b31bb5dc320d18e)},
+  {V8_UINT64_C(0xd2c4956a16291a89), V8_UINT64_C(0x15c162b168e70e0b)},
+  {V8_UINT64_C(0xdbd0778811ba7ba1), V8_UINT64_C(0x11678227871f3e6f)},
+  {V8_UINT64_C(0x2c80bf401c5d929b), V8_UINT64_C(0x1bd8d03f3e9863e6)},
+  {V8_UINT64_C(0xbd33cc3349e47549), V8_UINT64_C(0x16470cff6546b651)},
+  {V8_UINT64_C(0xca8fd68f6e505dd4), V8_UINT64_C(0x11d270cc51055ea7)},
+  {V8_UINT64_C(0x4419574be3b3c953), V8_UINT64_C(0x1c83e7ad4e6efdd9)},
+  {V8_UINT64_C(0x0347790982f63aa9), V8_UINT64_C(0x16cfec8aa52597e1)},
+  {V8_UINT64_C(0xcf6c60d468c4fbba), V8_UINT64_C(0x123ff06eea847980)},
+  {V8_UINT64_C(0xe57a34870e07f92a), V8_UINT64_C(0x1d331a4b10d3f59a)},
+  {V8_UINT64_C(0x512e906c0b399422), V8_UINT64_C(0x175c1508da432ae2)},
+  {V8_UINT64_C(0xda8ba6bcd5c7a9b5), V8_UINT64_C(0x12b010d3e1cf5581)},
+  {V8_UINT64_C(0x90df712e22d90f87), V8_UINT64_C(0x1de6815302e5559c)},
+  {V8_UINT64_C(0xda4c5a8b4f140c6c), V8_UINT64_C(0x17eb9aa8cf1dde16)},
+  {V8_UINT64_C(0xaea37ba2a5a9a38a), V8_UINT64_C(0x1322e220a5b17e78)},
+  {V8_UINT64_C(0x7dd25f6aa2a905a9), V8_UINT64_C(0x1e9e369aa2b59727)},
+  {V8_UINT64_C(0x97db7f888220d154), V8_UINT64_C(0x187e92154ef7ac1f)},
+  {V8_UINT64_C(0x797c6606ce80a777), V8_UINT64_C(0x139874ddd8c6234c)},
+  {V8_UINT64_C(0x8f2d700ae4010bf1), V8_UINT64_C(0x1f5a549627a36bad)},
+  {V8_UINT64_C(0x0c2459a25000d65a), V8_UINT64_C(0x191510781fb5efbe)},
+  {V8_UINT64_C(0x701d1481d99a4515), V8_UINT64_C(0x1410d9f9b2f7f2fe)},
+  {V8_UINT64_C(0xc017439b147b6a77), V8_UINT64_C(0x100d7b2e28c65bfe)},
+  {V8_UINT64_C(0xccf205c4ed9243f2), V8_UINT64_C(0x19af2b7d0e0a2cca)},
+  {V8_UINT64_C(0x0a5b37d0be0e9cc2), V8_UINT64_C(0x148c22ca71a1bd6f)},
+  {V8_UINT64_C(0x0848f973cb3ee3ce), V8_UINT64_C(0x10701bd527b4978c)},
+  {V8_UINT64_C(0xda0e5bec78649fb0), V8_UINT64_C(0x1a4cf9550c5425ac)},
+  {V8_UINT64_C(0x7b3eaff060507fc0), V8_UINT64_C(0x150a6110d6a9b7bd)},
+  {V8_UINT64_C(0x95cbbff380406633), V8_UINT64_C(0x10d51a73deee2c97)},
+  {V8_UINT64_C(0xefac665266cd7052), V8_UINT64_C(0x1aee90b964b04758)},
+  {V8_UINT64_C(0x2623850eb8a459db), V8_UINT64_C(0x158ba6fab6f36c47)},
+  {V8_UINT64_C(0x1e82d0d893b6ae49), V8_UINT64_C(0x113c85955f29236c)},
+  {V8_UINT64_C(0xfd9e1af41f8ab075), V8_UINT64_C(0x1b9408eefea838ac)},
+  {V8_UINT64_C(0x97b1af29b2d559f7), V8_UINT64_C(0x16100725988693bd)},
+  {V8_UINT64_C(0xac8e25baf5777b2c), V8_UINT64_C(0x11a66c1e139edc97)},
+  {V8_UINT64_C(0x7a7d092b2258c513), V8_UINT64_C(0x1c3d79c9b8fe2dbf)},
+  {V8_UINT64_C(0x61fda0ef4ead6a76), V8_UINT64_C(0x169794a160cb57cc)},
+  {V8_UINT64_C(0xe7fe1a590bbdeec5), V8_UINT64_C(0x1212dd4de7091309)},
+  {V8_UINT64_C(0xa6635d5b45fcb13a), V8_UINT64_C(0x1ceafbafd80e84dc)},
+  {V8_UINT64_C(0x851c4aaf6b308dc8), V8_UINT64_C(0x172262f3133ed0b0)},
+  {V8_UINT64_C(0xd0e36ef2bc26d7d4), V8_UINT64_C(0x1281e8c275cbda26)},
+  {V8_UINT64_C(0xb49f17eac6a48c86), V8_UINT64_C(0x1d9ca79d894629d7)},
+  {V8_UINT64_C(0x2a18dfef0550706b), V8_UINT64_C(0x17b08617a104ee46)},
+  {V8_UINT64_C(0x54e0b3259dd9f389), V8_UINT64_C(0x12f39e794d9d8b6b)},
+  {V8_UINT64_C(0x87cdeb6f62f65274), V8_UINT64_C(0x1e5297287c2f4578)},
+  {V8_UINT64_C(0xd30b22bf825ea85d), V8_UINT64_C(0x18421286c9bf6ac6)},
+  {V8_UINT64_C(0x0f3c1bcc684bb9e4), V8_UINT64_C(0x13680ed23aff889f)},
+  {V8_UINT64_C(0x18602c7a4079296d), V8_UINT64_C(0x1f0ce4839198da98)},
+  {V8_UINT64_C(0x46b356c833942124), V8_UINT64_C(0x18d71d360e13e213)},
+  {V8_UINT64_C(0x388f78a029434db6), V8_UINT64_C(0x13df4a91a4dcb4dc)},
+  {V8_UINT64_C(0x5a7f2766a86baf8a), V8_UINT64_C(0x1fcbaa82a1612160)},
+  {V8_UINT64_C(0x153285ebb9efbfa2), V8_UINT64_C(0x196fbb9bb44db44d)},
+  {V8_UINT64_C(0xaa8ed189618c994e), V8_UINT64_C(0x145962e2f6a4903d)},
+  {V8_UINT64_C(0xeed8a7a11ad6e10c), V8_UINT64_C(0x1047824f2bb6d9ca)},
+  {V8_UINT64_C(0x7e27729b5e249b45), V8_UINT64_C(0x1a0c03b1df8af611)},
+  {V8_UINT64_C(0xfe85f549181d4904), V8_UINT64_C(0x14d6695b193bf80d)},
+  {V8_UINT64_C(0xcb9e5dd4134aa0d0), V8_UINT64_C(0x10ab877c142ff9a4)},
+  {V8_UINT64_C(0xdf63c9535211014d), V8_UINT64_C(0x1aac0bf9b9e65c3a)},
+  {V8_UINT64_C(0x191ca10f74da6771), V8_UINT64_C(0x15566ffafb1eb02f)},
+  {V8_UINT64_C(0xadb080d92a4852c1), V8_UINT64_C(0x1111f32f2f4bc025)},
+  {V8_UINT64_C(0x15e7348eaa0d5134), V8_UINT64_C(0x1b4feb7eb212cd09)},
+  {V8_UINT64_C(0xab1f5d3eee710dc4), V8_UINT64_C(0x15d98932280f0a6d)},
+  {V8_UINT64_C(0xbc1917658b8da49d), V8_UINT64_C(0x117ad428200c0857)},
+  {V8_UINT64_C(0x2cf4f23c127c3a94), V8_UINT64_C(0x1bf7b9d9cce00d59)},
+  {V8_UINT64_C(0xf0c3f4fcdb969543), V8_UINT64_C(0x165fc7e170b33de0)},
+  {V8_UINT64_C(0x5a365d9716121103), V8_UINT64_C(0x11e6398126f5cb1a)},
+  {V8_UINT64_C(0x9056fc24f01ce804), V8_UINT64_C(0x1ca38f350b22de90)},
+  {V8_UINT64_C(0xd9df301d8ce3ecd0), V8_UINT64_C(0x16e93f5da2824ba6)},
+  {V8_UINT64_C(0xe17f59b13d8323da), V8_UINT64_C(0x125432b14ecea2eb)},
+  {V8_UINT64_C(0x68cbc2b52f38395c), V8_UINT64_C(0x1d53844ee47dd179)},
+  {V8_UINT64_C(0x53d6355dbf602de3), V8_UINT64_C(0x177603725064a794)},
+  {V8_UINT64_C(0xa9782ab165e68b1c), V8_UINT64_C(0x12c4cf8ea6b6ec76)},
+  {V8_UINT64_C(0x0f26aab56fd744fa), V8_UINT64_C(0x1e07b27dd78b13f1)},
+  {V8_UINT64_C(0x3f52222abfdf6a62), V8_UINT64_C(0x18062864ac6f4327)},
+  {V8_UINT64_C(0x65db4e88997f884e), V8_UINT64_C(0x1338205089f29c1f)},
+  {V8_UINT64_C(0x6fc54a7428cc0d4a), V8_UINT64_C(0x1ec033b40fea9365)},
+  {V8_UINT64_C(0x596aa1f68709a43b), V8_UINT64_C(0x1899c2f673220f84)},
+  {V8_UINT64_C(0xadeee7f86c07b696), V8_UINT64_C(0x13ae3591f5b4d936)},
+  {V8_UINT64_C(0x497e3ff3e00c5756), V8_UINT64_C(0x1f7d228322baf524)},
+  {V8_UINT64_C(0xd464fff64cd6ac45), V8_UINT64_C(0x1930e868e89590e9)},
+  {V8_UINT64_C(0x4383fff83d7889d1), V8_UINT64_C(0x14272053ed4473ee)},
+  {V8_UINT64_C(0xcf9cccc69793a174), V8_UINT64_C(0x101f4d0ff1038ff1)},
+  {V8_UINT64_C(0x7f6147a425b90252), V8_UINT64_C(0x19cbae7fe805b31c)},
+  {V8_UINT64_C(0xcc4dd2e9b7c7350f), V8_UINT64_C(0x14a2f1ffecd15c16)},
+  {V8_UINT64_C(0x3d0b0f215fd290d9), V8_UINT64_C(0x10825b3323dab012)},
+  {V8_UINT64_C(0x61ab4b689950e7c1), V8_UINT64_C(0x1a6a2b85062ab350)},
+  {V8_UINT64_C(0x4e22a2ba1440b967), V8_UINT64_C(0x1521bc6a6b555c40)},
+  {V8_UINT64_C(0x0b4ee894dd009453), V8_UINT64_C(0x10e7c9eebc4449cd)},
+  {V8_UINT64_C(0x1217da87c800ed51), V8_UINT64_C(0x1b0c764ac6d3a948)},
+  {V8_UINT64_C(0xdb46486ca000bdda), V8_UINT64_C(0x15a391d56bdc876c)},
+  {V8_UINT64_C(0x490506bd4ccd64af), V8_UINT64_C(0x114fa7ddefe39f8a)},
+  {V8_UINT64_C(0xa8080ac87ae23ab1), V8_UINT64_C(0x1bb2a62fe638ff43)},
+  {V8_UINT64_C(0x5339a239fbe82ef4), V8_UINT64_C(0x162884f31e93ff69)},
+  {V8_UINT64_C(0x75c7b4fb2fecf25d), V8_UINT64_C(0x11ba03f5b20fff87)},
+  {V8_UINT64_C(0x22d92191e647ea2e), V8_UINT64_C(0x1c5cd322b67fff3f)},
+  {V8_UINT64_C(0xb57a8141850654f2), V8_UINT64_C(0x16b0a8e891ffff65)},
+  {V8_UINT64_C(0xc4620101373843f5), V8_UINT64_C(0x1226ed86db3332b7)},
+  {V8_UINT64_C(0x3a366801f1f39fee), V8_UINT64_C(0x1d0b15a491eb8459)},
+  {V8_UINT64_C(0xfb5eb99b27f6198b), V8_UINT64_C(0x173c115074bc69e0)},
+  {V8_UINT64_C(0x2f7efae2865e7ad6), V8_UINT64_C(0x129674405d6387e7)},
+  {V8_UINT64_C(0xe597f7d0d6fd9156), V8_UINT64_C(0x1dbd86cd6238d971)},
+  {V8_UINT64_C(0x8479930d78cadaab), V8_UINT64_C(0x17cad23de82d7ac1)},
+  {V8_UINT64_C(0xd06142712d6f1556), V8_UINT64_C(0x1308a831868ac89a)},
+  {V8_UINT64_C(0x4d686a4eaf182222), V8_UINT64_C(0x1e74404f3daada91)},
+  {V8_UINT64_C(0xa453883ef279b4e8), V8_UINT64_C(0x185d003f6488aeda)},
+  {V8_UINT64_C(0xe9dc6cff28615d87), V8_UINT64_C(0x137d99cc506d58ae)},
+  {V8_UINT64_C(0xa960ae650d6895a4), V8_UINT64_C(0x1f2f5c7a1a488de4)},
+  {V8_UINT64_C(0xbab3beb73ded4483), V8_UINT64_C(0x18f2b061aea07183)},
+  {V8_UINT64_C(0x2ef6322c318a9d36), V8_UINT64_C(0x13f559e7bee6c136)},
+};
+
+// kPow5Split[i] is 5^i scaled to exactly 125 significant bits, stored as
+// {low 64 bits, high 64 bits}.
+static const uint64_t kPow5Split[][2] = {
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1000000000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1400000000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1900000000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1f40000000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1388000000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x186a000000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1e84800000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1312d00000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x17d7840000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1dcd650000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x12a05f2000000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x174876e800000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1d1a94a200000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x12309ce540000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x16bcc41e90000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1c6bf52634000000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x11c37937e0800000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x16345785d8a00000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1bc16d674ec80000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1158e460913d0000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x15af1d78b58c4000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1b1ae4d6e2ef5000)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x10f0cf064dd59200)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x152d02c7e14af680)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x1a784379d99db420)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x108b2a2c28029094)},
+  {V8_UINT64_C(0x0000000000000000), V8_UINT64_C(0x14adf4b7320334b9)},
+  {V8_UINT64_C(0x4000000000000000), V8_UINT64_C(0x19d971e4fe8401e7)},
+  {V8_UINT64_C(0x8800000000000000), V8_UINT64_C(0x1027e72f1f128130)},
+  {V8_UINT64_C(0xaa00000000000000), V8_UINT64_C(0x1431e0fae6d7217c)},
+  {V8_UINT64_C(0xd480000000000000), V8_UINT64_C(0x193e5939a08ce9db)},
+  {V8_UINT64_C(0xc9a0000000000000), V8_UINT64_C(0x1f8def8808b02452)},
+  {V8_UINT64_C(0xbe04000000000000), V8_UINT64_C(0x13b8b5b5056e16b3)},
+  {V8_UINT64_C(0xad85000000000000), V8_UINT64_C(0x18a6e32246c99c60)},
+  {V8_UINT64_C(0xd8e6400000000000), V8_UINT64_C(0x1ed09bead87c0378)},
+  {V8_UINT64_C(0x878fe80000000000), V8_UINT64_C(0x13426172c74d822b)},
+  {V8_UINT64_C(0x6973e20000000000), V8_UINT64_C(0x1812f9cf7920e2b6)},
+  {V8_UINT64_C(0x03d0da8000000000), V8_UINT64_C(0x1e17b84357691b64)},
+  {V8_UINT64_C(0x8262889000000000), V8_UINT64_C(0x12ced32a16a1b11e)},
+  {V8_UINT64_C(0x22fb2ab400000000), V8_UINT64_C(0x178287f49c4a1d66)},
+  {V8_UINT64_C(0xabb9f56100000000), V8_UINT64_C(0x1d6329f1c35ca4bf)},
+  {V8_UINT64_C(0xcb54395ca0000000), V8_UINT64_C(0x125dfa371a19e6f7)},
+  {V8_UINT64_C(0xbe2947b3c8000000), V8_UINT64_C(0x16f578c4e0a060b5)},
+  {V8_UINT64_C(0x2db399a0ba000000), V8_UINT64_C(0x1cb2d6f618c878e3)},
+  {V8_UINT64_C(0xfc90400474400000), V8_UINT64_C(0x11efc659cf7d4b8d)},
+  {V8_UINT64_C(0x7bb4500591500000), V8_UINT64_C(0x166bb7f0435c9e71)},
+  {V8_UINT64_C(0xdaa16406f5a40000), V8_UINT64_C(0x1c06a5ec5433c60d)},
+  {V8_UINT64_C(0xa8a4de8459868000), V8_UINT64_C(0x118427b3b4a05bc8)},
+  {V8_UINT64_C(0xd2ce16256fe82000), V8_UINT64_C(0x15e531a0a1c872ba)},
+  {V8_UINT64_C(0x87819baecbe22800), V8_UINT64_C(0x1b5e7e08ca3a8f69)},
+  {V8_UINT64_C(0xf4b1014d3f6d5900), V8_UINT64_C(0x111b0ec57e6499a1)},
+  {V8_UINT64_C(0x71dd41a08f48af40), V8_UINT64_C(0x1561d276ddfdc00a)},
+  {V8_UINT64_C(0x0e549208b31adb10), V8_UINT64_C(0x1aba4714957d300d)},
+  {V8_UINT64_C(0x28f4db456ff0c8ea), V8_UINT64_C(0x10b46c6cdd6e3e08)},
+  {V8_UINT64_C(0x33321216cbecfb24), V8_UINT64_C(0x14e1878814c9cd8a)},
+  {V8_UINT64_C(0xbffe969c7ee839ed), V8_UINT64_C(0x1a19e96a19fc40ec)},
+  {V8_UINT64_C(0xf7ff1e21cf512434), V8_UINT64_C(0x105031e2503da893)},
+  {V8_UINT64_C(0xf5fee5aa43256d41), V8_UINT64_C(0x14643e5ae44d12b8)},
+  {V8_UINT64_C(0x337e9f14d3eec892), V8_UINT64_C(0x197d4df19d605767)},
+  {V8_UINT64_C(0x005e46da08ea7ab6), V8_UINT64_C(0x1fdca16e04b86d41)},
+  {V8_UINT64_C(0xa03aec4845928cb2), V8_UINT64_C(0x13e9e4e4c2f34448)},
+  {V8_UINT64_C(0xc849a75a56f72fde), V8_UINT64_C(0x18e45e1df3b0155a)},
+  {V8_UINT64_C(0x7a5c1130ecb4fbd6), V8_UINT64_C(0x1f1d75a5709c1ab1)},
+  {V8_UINT64_C(0xec798abe93f11d65), V8_UINT64_C(0x13726987666190ae)},
+  {V8_UINT64_C(0xa797ed6e38ed64bf), V8_UINT64_C(0x184f03e93ff9f4da)},
+  {V8_UINT64_C(0x517de8c9c728bdef), V8_UINT64_C(0x1e62c4e38ff87211)},
+  {V8_UINT64_C(0xd2eeb17e1c7976b5), V8_UINT64_C(0x12fdbb0e39fb474a)},
+  {V8_UINT64_C(0x87aa5ddda397d462), V8_UINT64_C(0x17bd29d1c87a191d)},
+  {V8_UINT64_C(0xe994f5550c7dc97b), V8_UINT64_C(0x1dac74463a989f64)},
+  {V8_UINT64_C(0x11fd195527ce9ded), V8_UINT64_C(0x128bc8abe49f639f)},
+  {V8_UINT64_C(0xd67c5faa71c24568), V8_UINT64_C(0x172ebad6ddc73c86)},
+  {V8_UINT64_C(0x8c1b77950e32d6c2), V8_UINT64_C(0x1cfa698c95390ba8)},
+  {V8_UINT64_C(0x57912abd28dfc639), V8_UINT64_C(0x121c81f7dd43a749)},
+  {V8_UINT64_C(0xad75756c7317b7c8), V8_UINT64_C(0x16a3a275d494911b)},
+  {V8_UINT64_C(0x98d2d2c78fdda5ba), V8_UINT64_C(0x1c4c8b1349b9b562)},
+  {V8_UINT64_C(0x9f83c3bcb9ea8794), V8_UINT64_C(0x11afd6ec0e14115d)},
+  {V8_UINT64_C(0x0764b4abe8652979), V8_UINT64_C(0x161bcca7119915b5)},
+  {V8_UINT64_C(0x493de1d6e27e73d7), V8_UINT64_C(0x1ba2bfd0d5ff5b22)},
+  {V8_UINT64_C(0x6dc6ad264d8f0866), V8_UINT64_C(0x1145b7e285bf98f5)},
+  {V8_UINT64_C(0xc938586fe0f2ca80), V8_UINT64_C(0x159725db272f7f32)},
+  {V8_UINT64_C(0x7b866e8bd92f7d20), V8_UINT64_C(0x1afcef51f0fb5eff)},
+  {V8_UINT64_C(0xad34051767bdae34), V8_UINT64_C(0x10de1593369d1b5f)},
+  {V8_UINT64_C(0x9881065d41ad19c1), V8_UINT64_C(0x15159af804446237)},
+  {V8_UINT64_C(0x7ea147f492186032), V8_UINT64_C(0x1a5b01b605557ac5)},
+  {V8_UINT64_C(0x6f24ccf8db4f3c1f), V8_UINT64_C(0x1078e111c3556cbb)},
+  {V8_UINT64_C(0x4aee003712230b27), V8_UINT64_C(0x14971956342ac7ea)},
+  {V8_UINT64_C(0xdda98044d6abcdf0), V8_UINT64_C(0x19bcdfabc13579e4)},
+  {V8_UINT64_C(0x0a89f02b062b60b6), V8_UINT64_C(0x10160bcb58c16c2f)},
+  {V8_UINT64_C(0xcd2c6c35c7b638e4), V8_UINT64_C(0x141b8ebe2ef1c73a)},
+  {V8_UINT64_C(0x8077874339a3c71d), V8_UINT64_C(0x1922726dbaae3909)},
+  {V8_UINT64_C(0xe0956914080cb8e4), V8_UINT64_C(0x1f6b0f092959c74b)},
+  {V8_UINT64_C(0x6c5d61ac8507f38e), V8_UINT64_C(0x13a2e965b9d81c8f)},
+  {V8_UINT64_C(0x4774ba17a649f072), V8_UINT64_C(0x188ba3bf284e23b3)},
+  {V8_UINT64_C(0x1951e89d8fdc6c8f), V8_UINT64_C(0x1eae8caef261aca0)},
+  {V8_UINT64_C(0x0fd3316279e9c3d9), V8_UINT64_C(0x132d17ed577d0be4)},
+  {V8_UINT64_C(0x13c7fdbb186434cf), V8_UINT64_C(0x17f85de8ad5c4edd)},
+  {V8_UINT64_C(0x58b9fd29de7d4203), V8_UINT64_C(0x1df67562d8b36294)},
+  {V8_UINT64_C(0xb7743e3a2b0e4942), V8_UINT64_C(0x12ba095dc7701d9c)},
+  {V8_UINT64_C(0xe5514dc8b5d1db92), V8_UINT64_C(0x17688bb5394c2503)},
+  {V8_UINT64_C(0xdea5a13ae3465277), V8_UINT64_C(0x1d42aea2879f2e44)},
+  {V8_UINT64_C(0x0b2784c4ce0bf38a), V8_UINT64_C(0x1249ad2594c37ceb)},
+  {V8_UINT64_C(0xcdf165f6018ef06d), V8_UINT64_C(0x16dc186ef9f45c25)},
+  {V8_UINT64_C(0x416dbf7381f2ac88), V8_UINT64_C(0x1c931e8ab871732f)},
+  {V8_UINT64_C(0x88e497a83137abd5), V8_UINT64_C(0x11dbf316b346e7fd)},
+  {V8_UINT64_C(0xeb1dbd923d8596ca), V8_UINT64_C(0x1652efdc6018a1fc)},
+  {V8_UINT64_C(0x25e52cf6cce6fc7d), V8_UINT64_C(0x1be7abd3781eca7c)},
+  {V8_UINT64_C(0x97af3c1a40105dce), V8_UINT64_C(0x1170cb642b133e8d)},
+  {V8_UINT64_C(0xfd9b0b20d0147542), V8_UINT64_C(0x15ccfe3d35d80e30)},
+  {V8_UINT64_C(0x3d01cde904199292), V8_UINT64_C(0x1b403dcc834e11bd)},
+  {V8_UINT64_C(0x462120b1a28ffb9b), V8_UINT64_C(0x1108269fd210cb16)},
+  {V8_UINT64_C(0xd7a968de0b33fa82), V8_UINT64_C(0x154a3047c694fddb)},
+  {V8_UINT64_C(0xcd93c3158e00f923), V8_UINT64_C(0x1a9cbc59b83a3d52)},
+  {V8_UINT64_C(0xc07c59ed78c09bb6), V8_UINT64_C(0x10a1f5b813246653)},
+  {V8_UINT64_C(0xb09b7068d6f0c2a3), V8_UINT64_C(0x14ca732617ed7fe8)},
+  {V8_UINT64_C(0xdcc24c830cacf34c), V8_UINT64_C(0x19fd0fef9de8dfe2)},
+  {V8_UINT64_C(0xc9f96fd1e7ec180f), V8_UINT64_C(0x103e29f5c2b18bed)},
+  {V8_UINT64_C(0x3c77cbc661e71e13), V8_UINT64_C(0x144db473335deee9)},
+  {V8_UINT64_C(0x8b95beb7fa60e598), V8_UINT64_C(0x1961219000356aa3)},
+  {V8_UINT64_C(0x6e7b2e65f8f91efe), V8_UINT64_C(0x1fb969f40042c54c)},
+  {V8_UINT64_C(0xc50cfcffbb9bb35f), V8_UINT64_C(0x13d3e2388029bb4f)},
+  {V8_UINT64_C(0xb6503c3faa82a037), V8_UINT64_C(0x18c8dac6a0342a23)},
+  {V8_UINT64_C(0xa3e44b4f95234844), V8_UINT64_C(0x1efb1178484134ac)},
+  {V8_UINT64_C(0xe66eaf11bd360d2b), V8_UINT64_C(0x135ceaeb2d28c0eb)},
+  {V8_UINT64_C(0xe00a5ad62c839075), V8_UINT64_C(0x183425a5f872f126)},
+  {V8_UINT64_C(0x980cf18bb7a47493), V8_UINT64_C(0x1e412f0f768fad70)},
+  {V8_UINT64_C(0x5f0816f752c6c8dc), V8_UINT64_C(0x12e8bd69aa19cc66)},
+  {V8_UINT64_C(0xf6ca1cb527787b13), V8_UINT64_C(0x17a2ecc414a03f7f)},
+  {V8_UINT64_C(0xf47ca3e2715699d7), V8_UINT64_C(0x1d8ba7f519c84f5f)},
+  {V8_UINT64_C(0xf8cde66d86d62026), V8_UINT64_C(0x127748f9301d319b)},
+  {V8_UINT64_C(0xf7016008e88ba830), V8_UINT64_C(0x17151b377c247e02)},
+  {V8_UINT64_C(0xb4c1b80b22ae923c), V8_UINT64_C(0x1cda62055b2d9d83)},
+  {V8_UINT64_C(0x50f91306f5ad1b65), V8_UINT64_C(0x12087d4358fc8272)},
+  {V8_UINT64_C(0xe53757c8b318623f), V8_UINT64_C(0x168a9c942f3ba30e)},
+  {V8_UINT64_C(0x9e852dbadfde7acf), V8_UINT64_C(0x1c2d43b93b0a8bd2)},
+  {V8_UINT64_C(0xa3133c94cbeb0cc1), V8_UINT64_C(0x119c4a53c4e69763)},
+  {V8_UINT64_C(0x8bd80bb9fee5cff1), V8_UINT64_C(0x16035ce8b6203d3c)},
+  {V8_UINT64_C(0xaece0ea87e9f43ee), V8_UINT64_C(0x1b843422e3a84c8b)},
+  {V8_UINT64_C(0x4d40c9294f238a75), V8_UINT64_C(0x1132a095ce492fd7)},
+  {V8_UINT64_C(0x2090fb73a2ec6d12), V8_UINT64_C(0x157f48bb41db7bcd)},
+  {V8_UINT64_C(0x68b53a508ba78856), V8_UINT64_C(0x1adf1aea12525ac0)},
+  {V8_UINT64_C(0x417144725748b536), V8_UINT64_C(0x10cb70d24b7378b8)},
+  {V8_UINT64_C(0x51cd958eed1ae283), V8_UINT64_C(0x14fe4d06de5056e6)},
+  {V8_UINT64_C(0xe640faf2a8619b24), V8_UINT64_C(0x1a3de04895e46c9f)},
+  {V8_UINT64_C(0xefe89cd7a93d00f7), V8_UINT64_C(0x1066ac2d5daec3e3)},
+  {V8_UINT64_C(0xebe2c40d938c4134), V8_UINT64_C(0x14805738b51a74dc)},
+  {V8_UINT64_C(0x26db7510f86f5181), V8_UINT64_C(0x19a06d06e2611214)},
+  {V8_UINT64_C(0x9849292a9b4592f1), V8_UINT64_C(0x100444244d7cab4c)},
+  {V8_UINT64_C(0xbe5b73754216f7ad), V8_UINT64_C(0x1405552d60dbd61f)},
+  {V8_UINT64_C(0xadf25052929cb598), V8_UINT64_C(0x1906aa78b912cba7)},
+  {V8_UINT64_C(0x996ee4673743e2ff), V8_UINT64_C(0x1f485516e7577e91)},
+  {V8_UINT64_C(0xffe54ec0828a6ddf), V8_UINT64_C(0x138d352e5096af1a)},
+  {V8_UINT64_C(0xbfdea270a32d0957), V8_UINT64_C(0x18708279e4bc5ae1)},
+  {V8_UINT64_C(0x2fd64b0ccbf84bad), V8_UINT64_C(0x1e8ca3185deb719a)},
+  {V8_UINT64_C(0x5de5eee7ff7b2f4c), V8_UINT64_C(0x1317e5ef3ab32700)},
+  {V8_UINT64_C(0x755f6aa1ff59fb1f), V8_UINT64_C(0x17dddf6b095ff0c0)},
+  {V8_UINT64_C(0x92b7454a7f3079e7), V8_UINT64_C(0x1dd55745cbb7ecf0)},
+  {V8_UINT64_C(0x5bb28b4e8f7e4c30), V8_UINT64_C(0x12a5568b9f52f416)},
+  {V8_UINT64_C(0xf29f2e22335ddf3c), V8_UINT64_C(0x174eac2e8727b11b)},
+  {V8_UINT64_C(0xef46f9aac035570b), V8_UINT64_C(0x1d22573a28f19d62)},
+  {V8_UINT64_C(0xd58c5c0ab8215667), V8_UINT64_C(0x123576845997025d)},
+  {V8_UINT64_C(0x4aef730d6629ac01), V8_UINT64_C(0x16c2d4256ffcc2f5)},
+  {V8_UINT64_C(0x9dab4fd0bfb41701), V8_UINT64_C(0x1c73892ecbfbf3b2)},
+  {V8_UINT64_C(0xa28b11e277d08e60), V8_UINT64_C(0x11c835bd3f7d784f)},
+  {V8_UINT64_C(0x8b2dd65b15c4b1f9), V8_UINT64_C(0x163a432c8f5cd663)},
+  {V8_UINT64_C(0x6df94bf1db35de77), V8_UINT64_C(0x1bc8d3f7b3340bfc)},
+  {V8_UINT64_C(0xc4bbcf772901ab0a), V8_UINT64_C(0x115d847ad000877d)},
+  {V8_UINT64_C(0x35eac354f34215cd), V8_UINT64_C(0x15b4e5998400a95d)},
+  {V8_UINT64_C(0x8365742a30129b40), V8_UINT64_C(0x1b221effe500d3b4)},
+  {V8_UINT64_C(0xd21f689a5e0ba108), V8_UINT64_C(0x10f5535fef208450)},
+  {V8_UINT64_C(0x06a742c0f58e894a), V8_UINT64_C(0x1532a837eae8a565)},
+  {V8_UINT64_C(0x4851137132f22b9d), V8_UINT64_C(0x1a7f5245e5a2cebe)},
+  {V8_UINT64_C(0xed32ac26bfd75b42), V8_UINT64_C(0x108f936baf85c136)},
+  {V8_UINT64_C(0xa87f57306fcd3212), V8_UINT64_C(0x14b378469b673184)},
+  {V8_UINT64_C(0xd29f2cfc8bc07e97), V8_UINT64_C(0x19e056584240fde5)},
+  {V8_UINT64_C(0xa3a37c1dd7584f1e), V8_UINT64_C(0x102c35f729689eaf)},
+  {V8_UINT64_C(0x8c8c5b254d2e62e6), V8_UINT64_C(0x14374374f3c2c65b)},
+  {V8_UINT64_C(0x6faf71eea079fb9f), V8_UINT64_C(0x1945145230b377f2)},
+  {V8_UINT64_C(0x0b9b4e6a48987a87), V8_UINT64_C(0x1f965966bce055ef)},
+  {V8_UINT64_C(0x674111026d5f4c94), V8_UINT64_C(0x13bdf7e0360c35b5)},
+  {V8_UINT64_C(0xc111554308b71fba), V8_UINT64_C(0x18ad75d8438f4322)},
+  {V8_UINT64_C(0x7155aa93cae4e7a8), V8_UINT64_C(0x1ed8d34e547313eb)},
+  {V8_UINT64_C(0x26d58a9c5ecf10c9), V8_UINT64_C(0x13478410f4c7ec73)},
+  {V8_UINT64_C(0xf08aed437682d4fb), V8_UINT64_C(0x1819651531f9e78f)},
+  {V8_UINT64_C(0xecada89454238a3a), V8_UINT64_C(0x1e1fbe5a7e786173)},
+  {V8_UINT64_C(0x73ec895cb4963664), V8_UINT64_C(0x12d3d6f88f0b3ce8)},
+  {V8_UINT64_C(0x90e7abb3e1bbc3fd), V8_UINT64_C(0x1788ccb6b2ce0c22)},
+  {V8_UINT64_C(0x352196a0da2ab4fd), V8_UINT64_C(0x1d6affe45f818f2b)},
+  {V8_UINT64_C(0x0134fe24885ab11e), V8_UINT64_C(0x1262dfeebbb0f97b)},
+  {V8_UINT64_C(0xc1823dadaa715d65), V8_UINT64_C(0x16fb97ea6a9d37d9)},
+  {V8_UINT64_C(0x31e2cd19150db4bf), V8_UINT64_C(0x1cba7de5054485d0)},
+  {V8_UINT64_C(0x1f2dc02fad2890f7), V8_UINT64_C(0x11f48eaf234ad3a2)},
+  {V8_UINT64_C(0xa6f9303b9872b535), V8_UINT64_C(0x1671b25aec1d888a)},
+  {V8_UINT64_C(0x50b77c4a7e8f6282), V8_UINT64_C(0x1c0e1ef1a724eaad)},
+  {V8_UINT64_C(0x5272adae8f199d91), V8_UINT64_C(0x1188d357087712ac)},
+  {V8_UINT64_C(0x670f591a32e004f6), V8_UINT64_C(0x15eb082cca94d757)},
+  {V8_UINT64_C(0x40d32f60bf980633), V8_UINT64_C(0x1b65ca37fd3a0d2d)},
+  {V8_UINT64_C(0x4883fd9c77bf03e0), V8_UINT64_C(0x111f9e62fe44483c)},
+  {V8_UINT64_C(0x5aa4fd0395aec4d8), V8_UINT64_C(0x156785fbbdd55a4b)},
+  {V8_UINT64_C(0x314e3c447b1a760e), V8_UINT64_C(0x1ac1677aad4ab0de)},
+  {V8_UINT64_C(0xded0e5aaccf089c9), V8_UINT64_C(0x10b8e0acac4eae8a)},
+  {V8_UINT64_C(0x96851f15802cac3b), V8_UINT64_C(0x14e718d7d7625a2d)},
+  {V8_UINT64_C(0xfc2666dae037d74a), V8_UINT64_C(0x1a20df0dcd3af0b8)},
+  {V8_UINT64_C(0x9d980048cc22e68e), V8_UINT64_C(0x10548b68a044d673)},
+  {V8_UINT64_C(0x84fe005aff2ba032), V8_UINT64_C(0x1469ae42c8560c10)},
+  {V8_UINT64_C(0xa63d8071bef6883e), V8_UINT64_C(0x198419d37a6b8f14)},
+  {V8_UINT64_C(0xcfcce08e2eb42a4e), V8_UINT64_C(0x1fe52048590672d9)},
+  {V8_UINT64_C(0x21e00c58dd309a70), V8_UINT64_C(0x13ef342d37a407c8)},
+  {V8_UINT64_C(0x2a580f6f147cc10d), V8_UINT64_C(0x18eb0138858d09ba)},
+  {V8_UINT64_C(0xb4ee134ad99bf150), V8_UINT64_C(0x1f25c186a6f04c28)},
+  {V8_UINT64_C(0x7114cc0ec80176d2), V8_UINT64_C(0x137798f428562f99)},
+  {V8_UINT64_C(0xcd59ff127a01d486), V8_UINT64_C(0x18557f31326bbb7f)},
+  {V8_UINT64_C(0xc0b07ed7188249a8), V8_UINT64_C(0x1e6adefd7f06aa5f)},
+  {V8_UINT64_C(0xd86e4f466f516e09), V8_UINT64_C(0x1302cb5e6f642a7b)},
+  {V8_UINT64_C(0xce89e3180b25c98b), V8_UINT64_C(0x17c37e360b3d351a)},
+  {V8_UINT64_C(0x822c5bde0def3bee), V8_UINT64_C(0x1db45dc38e0c8261)},
+  {V8_UINT64_C(0xf15bb96ac8b58575), V8_UINT64_C(0x1290ba9a38c7d17c)},
+  {V8_UINT64_C(0x2db2a7c57ae2e6d2), V8_UINT64_C(0x1734e940c6f9c5dc)},
+  {V8_UINT64_C(0x391f51b6d99ba086), V8_UINT64_C(0x1d022390f8b83753)},
+  {V8_UINT64_C(0x03b3931248014454), V8_UINT64_C(0x1221563a9b732294)},
+  {V8_UINT64_C(0x04a077d6da019569), V8_UINT64_C(0x16a9abc9424feb39)},
+  {V8_UINT64_C(0x45c895cc9081fac3), V8_UINT64_C(0x1c5416bb92e3e607)},
+  {V8_UINT64_C(0x8b9d5d9fda513cba), V8_UINT64_C(0x11b48e353bce6fc4)},
+  {V8_UINT64_C(0xae84b507d0e58be8), V8_UINT64_C(0x1621b1c28ac20bb5)},
+  {V8_UINT64_C(0x1a25e249c51eeee3), V8_UINT64_C(0x1baa1e332d728ea3)},
+  {V8_UINT64_C(0xf057ad6e1b33554d), V8_UINT64_C(0x114a52dffc679925)},
+  {V8_UINT64_C(0x6c6d98c9a2002aa1), V8_UINT64_C(0x159ce797fb817f6f)},
+  {V8_UINT64_C(0x4788fefc0a803549), V8_UINT64_C(0x1b04217dfa61df4b)},
+  {V8_UINT64_C(0x0cb59f5d8690214e), V8_UINT64_C(0x10e294eebc7d2b8f)},
+  {V8_UINT64_C(0xcfe30734e83429a1), V8_UINT64_C(0x151b3a2a6b9c7672)},
+  {V8_UINT64_C(0x83dbc9022241340a), V8_UINT64_C(0x1a6208b50683940f)},
+  {V8_UINT64_C(0xb2695da15568c086), V8_UINT64_C(0x107d457124123c89)},
+  {V8_UINT64_C(0x1f03b509aac2f0a7), V8_UINT64_C(0x149c96cd6d16cbac)},
+  {V8_UINT64_C(0x26c4a24c1573acd1), V8_UINT64_C(0x19c3bc80c85c7e97)},
+  {V8_UINT64_C(0x783ae56f8d684c03), V8_UINT64_C(0x101a55d07d39cf1e)},
+  {V8_UINT64_C(0x16499ecb70c25f03), V8_UINT64_C(0x1420eb449c8842e6)},
+  {V8_UINT64_C(0x9bdc067e4cf2f6c4), V8_UINT64_C(0x19292615c3aa539f)},
+  {V8_UINT64_C(0x82d3081de02fb476), V8_UINT64_C(0x1f736f9b3494e887)},
+  {V8_UINT64_C(0xb1c3e512ac1dd0c9), V8_UINT64_C(0x13a825c100dd1154)},
+  {V8_UINT64_C(0xde34de57572544fc), V8_UINT64_C(0x18922f31411455a9)},
+  {V8_UINT64_C(0x55c215ed2cee963b), V8_UINT64_C(0x1eb6bafd91596b14)},
+  {V8_UINT64_C(0xb5994db43c151de5), V8_UINT64_C(0x133234de7ad7e2ec)},
+  {V8_UINT64_C(0xe2ffa1214b1a655e), V8_UINT64_C(0x17fec216198ddba7)},
+  {V8_UINT64_C(0xdbbf89699de0feb6), V8_UINT64_C(0x1dfe729b9ff15291)},
+  {V8_UINT64_C(0x2957b5e202ac9f31), V8_UINT64_C(0x12bf07a143f6d39b)},
+  {V8_UINT64_C(0xf3ada35a8357c6fe), V8_UINT64_C(0x176ec98994f48881)},
+  {V8_UINT64_C(0x70990c31242db8bd), V8_UINT64_C(0x1d4a7bebfa31aaa2)},
+  {V8_UINT64_C(0x865fa79eb69c9376), V8_UINT64_C(0x124e8d737c5f0aa5)},
+  {V8_UINT64_C(0xe7f791866443b854), V8_UINT64_C(0x16e230d05b76cd4e)},
+  {V8_UINT64_C(0xa1f575e7fd54a669), V8_UINT64_C(0x1c9abd04725480a2)},
+  {V8_UINT64_C(0xa53969b0fe54e801), V8_UINT64_C(0x11e0b622c774d065)},
+  {V8_UINT64_C(0x0e87c41d3dea2202), V8_UINT64_C(0x1658e3ab7952047f)},
+  {V8_UINT64_C(0xd229b5248d64aa82), V8_UINT64_C(0x1bef1c9657a6859e)},
+  {V8_UINT64_C(0x435a1136d85eea91), V8_UINT64_C(0x117571ddf6c81383)},
+  {V8_UINT64_C(0x143095848e76a536), V8_UINT64_C(0x15d2ce55747a1864)},
+  {V8_UINT64_C(0x193cbae5b2144e83), V8_UINT64_C(0x1b4781ead1989e7d)},
+  {V8_UINT64_C(0x2fc5f4cf8f4cb112), V8_UINT64_C(0x110cb132c2ff630e)},
+  {V8_UINT64_C(0xbbb77203731fdd56), V8_UINT64_C(0x154fdd7f73bf3bd1)},
+  {V8_UINT64_C(0x2aa54e844fe7d4ac), V8_UINT64_C(0x1aa3d4df50af0ac6)},
+  {V8_UINT64_C(0xdaa75112b1f0e4eb), V8_UINT64_C(0x10a6650b926d66bb)},
+  {V8_UINT64_C(0xd15125575e6d1e26), V8_UINT64_C(0x14cffe4e7708c06a)},
+  {V8_UINT64_C(0x85a56ead360865b0), V8_UINT64_C(0x1a03fde214caf085)},
+  {V8_UINT64_C(0x7387652c41c53f8e), V8_UINT64_C(0x10427ead4cfed653)},
+  {V8_UINT64_C(0x50693e7752368f71), V8_UINT64_C(0x14531e58a03e8be8)},
+  {V8_UINT64_C(0x64838e1526c4334e), V8_UINT64_C(0x1967e5eec84e2ee2)},
+  {V8_UINT64_C(0xfda4719a70754022), V8_UINT64_C(0x1fc1df6a7a61ba9a)},
+  {V8_UINT64_C(0xde86c70086494815), V8_UINT64_C(0x13d92ba28c7d14a0)},
+  {V8_UINT64_C(0x162878c0a7db9a1a), V8_UINT64_C(0x18cf768b2f9c59c9)},
+  {V8_UINT64_C(0x5bb296f0d1d280a1), V8_UINT64_C(0x1f03542dfb83703b)},
+  {V8_UINT64_C(0x194f9e5683239064), V8_UINT64_C(0x1362149cbd322625)},
+  {V8_UINT64_C(0x5fa385ec23ec747e), V8_UINT64_C(0x183a99c3ec7eafae)},
+  {V8_UINT64_C(0xf78c67672ce7919d), V8_UINT64_C(0x1e494034e79e5b99)},
+  {V8_UINT64_C(0x3ab7c0a07c10bb02), V8_UINT64_C(0x12edc82110c2f940)},
+  {V8_UINT64_C(0x4965b0c89b14e9c3), V8_UINT64_C(0x17a93a2954f3b790)},
+  {V8_UINT64_C(0x5bbf1cfac1da2433), V8_UINT64_C(0x1d9388b3aa30a574)},
+  {V8_UINT64_C(0xb957721cb92856a0), V8_UINT64_C(0x127c35704a5e6768)},
+  {V8_UINT64_C(0xe7ad4ea3e7726c48), V8_UINT64_C(0x171b42cc5cf60142)},
+  {V8_UINT64_C(0xa198a24ce14f075a), V8_UINT64_C(0x1ce2137f74338193)},
+  {V8_UINT64_C(0x44ff65700cd16498), V8_UINT64_C(0x120d4c2fa8a030fc)},
+  {V8_UINT64_C(0x563f3ecc1005bdbe), V8_UINT64_C(0x16909f3b92c83d3b)},
+  {V8_UINT64_C(0x2bcf0e7f14072d2e), V8_UINT64_C(0x1c34c70a777a4c8a)},
+  {V8_UINT64_C(0x5b61690f6c847c3d), V8_UINT64_C(0x11a0fc668aac6fd6)},
+  {V8_UINT64_C(0xf239c35347a59b4c), V8_UINT64_C(0x16093b802d578bcb)},
+  {V8_UINT64_C(0xeec83428198f021f), V8_UINT64_C(0x1b8b8a6038ad6ebe)},
+  {V8_UINT64_C(0x553d20990ff96153), V8_UINT64_C(0x1137367c236c6537)},
+  {V8_UINT64_C(0x2a8c68bf53f7b9a8), V8_UINT64_C(0x1585041b2c477e85)},
+  {V8_UINT64_C(0x752f82ef28f5a812), V8_UINT64_C(0x1ae64521f7595e26)},
+  {V8_UINT64_C(0x093db1d57999890b), V8_UINT64_C(0x10cfeb353a97dad8)},
+  {V8_UINT64_C(0x0b8d1e4ad7ffeb4e), V8_UINT64_C(0x1503e602893dd18e)},
+  {V8_UINT64_C(0x8e7065dd8dffe622), V8_UINT64_C(0x1a44df832b8d45f1)},
+  {V8_UINT64_C(0xf9063faa78bfefd5), V8_UINT64_C(0x106b0bb1fb384bb6)},
+  {V8_UINT64_C(0xb747cf9516efebca), V8_UINT64_C(0x1485ce9e7a065ea4)},
+  {V8_UINT64_C(0xe519c37a5cabe6bd), V8_UINT64_C(0x19a742461887f64d)},
+  {V8_UINT64_C(0xaf301a2c79eb7036), V8_UINT64_C(0x1008896bcf54f9f0)},
+  {V8_UINT64_C(0xdafc20b798664c43), V8_UINT64_C(0x140aabc6c32a386c)},
+  {V8_UINT64_C(0x11bb28e57e7fdf54), V8_UINT64_C(0x190d56b873f4c688)},
+  {V8_UINT64_C(0x1629f31ede1fd72a), V8_UINT64_C(0x1f50ac6690f1f82a)},
+  {V8_UINT64_C(0x4dda37f34ad3e67a), V8_UINT64_C(0x13926bc01a973b1a)},
+  {V8_UINT64_C(0xe150c5f01d88e019), V8_UINT64_C(0x187706b0213d09e0)},
+  {V8_UINT64_C(0x19a4f76c24eb181f), V8_UINT64_C(0x1e94c85c298c4c59)},
+  {V8_UINT64_C(0xb0071aa39712ef13), V8_UINT64_C(0x131cfd3999f7afb7)},
+  {V8_UINT64_C(0x9c08e14c7cd7aad8), V8_UINT64_C(0x17e43c8800759ba5)},
+  {V8_UINT64_C(0x030b199f9c0d958e), V8_UINT64_C(0x1ddd4baa0093028f)},
+  {V8_UINT64_C(0x61e6f003c1887d79), V8_UINT64_C(0x12aa4f4a405be199)},
+  {V8_UINT64_C(0xba60ac04b1ea9cd7), V8_UINT64_C(0x1754e31cd072d9ff)},
+  {V8_UINT64_C(0xa8f8d705de65440d), V8_UINT64_C(0x1d2a1be4048f907f)},
+  {V8_UINT64_C(0xc99b8663aaff4a88), V8_UINT64_C(0x123a516e82d9ba4f)},
+  {V8_UINT64_C(0xbc0267fc95bf1d2a), V8_UINT64_C(0x16c8e5ca239028e3)},
+  {V8_UINT64_C(0xab0301fbbb2ee474), V8_UINT64_C(0x1c7b1f3cac74331c)},
+  {V8_UINT64_C(0xeae1e13d54fd4ec9), V8_UINT64_C(0x11ccf385ebc89ff1)},
+  {V8_UINT64_C(0x659a598caa3ca27b), V8_UINT64_C(0x1640306766bac7ee)},
+  {V8_UINT64_C(0xff00efefd4cbcb1a), V8_UINT64_C(0x1bd03c81406979e9)},
+  {V8_UINT64_C(0x3f6095f5e4ff5ef0), V8_UINT64_C(0x116225d0c841ec32)},
+  {V8_UINT64_C(0xcf38bb735e3f36ac), V8_UINT64_C(0x15baaf44fa52673e)},
+  {V8_UINT64_C(0x8306ea5035cf0457), V8_UINT64_C(0x1b295b1638e7010e)},
+  {V8_UINT64_C(0x11e4527221a162b6), V8_UINT64_C(0x10f9d8ede39060a9)},
+  {V8_UINT64_C(0x565d670eaa09bb64), V8_UINT64_C(0x15384f295c7478d3)},
+  {V8_UINT64_C(0x2bf4c0d2548c2a3d), V8_UINT64_C(0x1a8662f3b3919708)},
+  {V8_UINT64_C(0x1b78f88374d79a66), V8_UINT64_C(0x1093fdd8503afe65)},
+  {V8_UINT64_C(0x625736a4520d8100), V8_UINT64_C(0x14b8fd4e6449bdfe)},
+  {V8_UINT64_C(0xfaed044d6690e140), V8_UINT64_C(0x19e73ca1fd5c2d7d)},
+  {V8_UINT64_C(0xbcd422b0601a8cc8), V8_UINT64_C(0x103085e53e599c6e)},
+  {V8_UINT64_C(0x6c092b5c78212ffa), V8_UINT64_C(0x143ca75e8df0038a)},
+  {V8_UINT64_C(0x070b763396297bf8), V8_UINT64_C(0x194bd136316c046d)},
+  {V8_UINT64_C(0x48ce53c07bb3daf6), V8_UINT64_C(0x1f9ec583bdc70588)},
+  {V8_UINT64_C(0x2d80f4584d5068da), V8_UINT64_C(0x13c33b72569c6375)},
+  {V8_UINT64_C(0x78e1316e60a48310), V8_UINT64_C(0x18b40a4eec437c52)},
+};
+
+
+// Returns ceil(log2(5^e)) for 0 < e <= 3528, and 1 for e == 0.
+static inline int Pow5Bits(int e) {
+  DCHECK(0 <= e && e <= 3528);
+  return static_cast<int>((static_cast<uint32_t>(e) * 1217359) >> 19) + 1;
+}
+
+
+// Returns floor(log10(2^e)) for 0 <= e <= 1650.
+static inline int Log10Pow2(int e) {
+  DCHECK(0 <= e && e <= 1650);
+  return static_cast<int>((static_cast<uint32_t>(e) * 78913) >> 18);
+}
+
+
+// Returns floor(log10(5^e)) for 0 <= e <= 2620.
+static inline int Log10Pow5(int e) {
+  DCHECK(0 <= e && e <= 2620);
+  return static_cast<int>((static_cast<uint32_t>(e) * 732923) >> 20);
+}
+
+
+static inline bool IsMultipleOfPowerOf5(uint64_t value, int p) {
+  int count = 0;
+  while (value > 0 && value % 5 == 0) {
+    value /= 5;
+    count++;
+  }
+  return count >= p;
+}
+
+
+static inline bool IsMultipleOfPowerOf2(uint64_t value, int p) {
+  DCHECK(0 <= p && p < 64);
+  return (value & ((static_cast<uint64_t>(1) << p) - 1)) == 0;
+}
+
+
+// Returns the bits [shift, shift + 64) of the 192-bit product of m and the
+// 128-bit multiplier. m has at most 55 significant bits.
+static inline uint64_t MultiplyAndShift(uint64_t m, const uint64_t* multiplier,
+                                        int shift) {
+  DCHECK(64 < shift && shift < 128);
+  uint64_t high1;
+  uint64_t low1 = base::bits::UnsignedMul128(m, multiplier[1], &high1);
+  uint64_t high0;
+  base::bits::UnsignedMul128(m, multiplier[0], &high0);
+  uint64_t sum = high0 + low1;
+  if (sum < high0) high1++;
+  int distance = shift - 64;
+  return (high1 << (64 - distance)) | (sum >> distance);
+}
+
+
+void RyuDtoa(double v, Vector<char> buffer, int* length, int* decimal_point) {
+  DCHECK(v > 0);
+  DCHECK(!Double(v).IsSpecial());
+
+  // Step 1: Decode the double as m2 * 2^e2. The bounds of the rounding
+  // interval are computed at twice the precision, so the significand is
+  // scaled by 4 below and the exponent lowered by 2 here.
+  Double double_v(v);
+  uint64_t m2 = double_v.Significand();
+  int e2 = double_v.Exponent() - 2;
+  // With an even significand, numbers exactly on the bounds read back as v.
+  bool accept_bounds = (m2 & 1) == 0;
+
+  // Step 2: The interval of numbers that round to v is [mm, mp] * 2^e2,
+  // where the lower bound is closer to v if v is a power of two.
+  uint64_t mv = 4 * m2;
+  uint32_t mm_shift = double_v.LowerBoundaryIsCloser() ? 0 : 1;
+
+  // Step 3: Convert the interval to decimal, as vm, vr, vp * 10^e10. Also
+  // track whether the lower bound and vr are exact, which decides whether
+  // the lower bound itself is a valid representation and whether vr lies
+  // exactly halfway between two candidates.
+  uint64_t vr, vp, vm;
+  int e10;
+  bool vm_is_trailing_zeros = false;
+  bool vr_is_trailing_zeros = false;
+  if (e2 >= 0) {
+    int q = Log10Pow2(e2) - (e2 > 3 ? 1 : 0);
+    e10 = q;
+    int k = kPow5InverseBitCount + Pow5Bits(q) - 1;
+    int i = -e2 + q + k;
+    DCHECK(q < static_cast<int>(arraysize(kPow5InverseSplit)));
+    const uint64_t* multiplier = kPow5InverseSplit[q];
+    vr = MultiplyAndShift(mv, multiplier, i);
+    vp = MultiplyAndShift(mv + 2, multiplier, i);
+    vm = MultiplyAndShift(mv - 1 - mm_shift, multiplier, i);
+    if (q <= 21) {
+      // The values are exact if they are multiples of 5^q. Only one of mp,
+      // mv and mm can be a multiple of 5, if any.
+      if (mv % 5 == 0) {
+        vr_is_trailing_zeros = IsMultipleOfPowerOf5(mv, q);
+      } else if (accept_bounds) {
+        vm_is_trailing_zeros = IsMultipleOfPowerOf5(mv - 1 - mm_shift, q);
+      } else if (IsMultipleOfPowerOf5(mv + 2, q)) {
+        // The exact upper bound is excluded.
+        vp--;
+      }
+    }
+  } else {
+    int q = Log10Pow5(-e2) - (-e2 > 1 ? 1 : 0);
+    e10 = q + e2;
+    int i = -e2 - q;
+    int k = Pow5Bits(i) - kPow5BitCount;
+    int j = q - k;
+    DCHECK(i < static_cast<int>(arraysize(kPow5Split)));
+    const uint64_t* multiplier = kPow5Split[i];
+    vr = MultiplyAndShift(mv, multiplier, j);
+    vp = MultiplyAndShift(mv + 2, multiplier, j);
+    vm = MultiplyAndShift(mv - 1 - mm_shift, multiplier, j);
+    if (q <= 1) {
+      // The values are exact if they have at least q trailing zero bits.
+      // mv = 4 * m2 always has two.
+      vr_is_trailing_zeros = true;
+      if (accept_bounds) {
+        // mm = mv - 1 - mm_shift has a trailing zero bit iff mm_shift is 1.
+        vm_is_trailing_zeros = mm_shift == 1;
+      } else {
+        // mp = mv + 2 always has a trailing zero bit.
+        vp--;
+      }
+    } else if (q < 63) {
+      vr_is_trailing_zeros = IsMultipleOfPowerOf2(mv, q);
+    }
+  }
+
+  // Step 4: Remove digits while the bounds still differ, and round vr with
+  // the removed digits.
+  int removed = 0;
+  uint64_t output;
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+    // General case, which happens rarely.
+    int last_removed_digit = 0;
+    while (vp / 10 > vm / 10) {
+      vm_is_trailing_zeros &= vm % 10 == 0;
+      vr_is_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = static_cast<int>(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+    if (vm_is_trailing_zeros) {
+      // The lower bound itself is a valid, shorter representation.
+      while (vm % 10 == 0) {
+        vr_is_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = static_cast<int>(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        removed++;
+      }
+    }
+    if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+      // Round halfway cases to even.
+      last_removed_digit = 4;
+    }
+    // Take vr + 1 if vr is outside the interval or must be rounded up.
+    output = vr + ((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) ||
+                   last_removed_digit >= 5);
+  } else {
+    // Common case: none of the values is exact.
+    bool round_up = false;
+    if (vp / 100 > vm / 100) {
+      // Remove two digits at a time.
+      round_up = vr % 100 >= 50;
+      vr /= 100;
+      vp /= 100;
+      vm /= 100;
+      removed += 2;
+    }
+    while (vp / 10 > vm / 10) {
+      round_up = vr % 10 >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+    output = vr + (vr == vm || round_up);
+  }
+  int exponent = e10 + removed;
+
+  // Rounding up may have produced trailing zeros.
+  while (output % 10 == 0) {
+    output /= 10;
+    exponent++;
+  }
+
+  // Step 5: Print the digits.
+  int digits = 0;
+  for (uint64_t rest = output; rest > 0; rest /= 10) digits++;
+  DCHECK(digits <= kRyuDtoaMaximalLength);
+  for (int i = digits - 1; i >= 0; i--) {
+    buffer[i] = static_cast<char>('0' + output % 10);
+    output /= 10;
+  }
+  buffer[digits] = '\0';
+  *length = digits;
+  *decimal_point = digits + exponent;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,36 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_RYU_DTOA_H_
+#define V8_RYU_DTOA_H_
+
+#include "src/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// RyuDtoa will produce at most kRyuDtoaMaximalLength digits. This does not
+// include the terminating '\0' character.
+const int kRyuDtoaMaximalLength = 17;
+
+// Computes the shortest decimal representation of v with the Ryu algorithm
+// (Ulf Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018).
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// Unlike FastDtoa, RyuDtoa always succeeds: it only needs 128-bit
+// multiplications with precomputed powers of five and never falls back to
+// bignum arithmetic. The digits in the buffer are the shortest representation
+// that reads back as v. Among those, the one closest to v is chosen, and
+// halfway cases are rounded to an even last digit.
+// There will be *length digits inside the buffer followed by a null
+// terminator.
+void RyuDtoa(double v, Vector<char> buffer, int* length, int* decimal_point);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_RYU_DTOA_H_
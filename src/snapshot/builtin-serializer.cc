@@ -0,0 +1,78 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/builtin-serializer.h"
+#include "src/snapshot/startup-serializer.h"
+
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+BuiltinSerializer::BuiltinSerializer(Isolate* isolate,
+                                     StartupSerializer* startup_serializer,
+                                     SnapshotByteSink* sink)
+    : Serializer(isolate, sink),
+      startup_serializer_(startup_serializer),
+      code_(NULL) {
+  InitializeCodeAddressMap();
+}
+
+BuiltinSerializer::~BuiltinSerializer() {}
+
+// static
+void BuiltinSerializer::CreateTrampolines(Isolate* isolate,
+                                          Handle<Code>* trampolines) {
+  Builtins* builtins = isolate->builtins();
+  Handle<Code> deserialize_lazy = builtins->DeserializeLazy();
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    trampolines[i] = Handle<Code>::null();
+    if (!FLAG_lazy_deserialization || !Builtins::IsLazyDeserializable(i)) {
+      continue;
+    }
+    // Small builtins are cheaper to deserialize with the isolate than to
+    // replace by a trampoline.
+    Code* code = builtins->builtin(static_cast<Builtins::Name>(i));
+    if (code->Size() <= 2 * deserialize_lazy->Size()) continue;
+    trampolines[i] = isolate->factory()->CopyCode(deserialize_lazy);
+    trampolines[i]->set_builtin_index(i);
+  }
+}
+
+void BuiltinSerializer::Serialize(Code* code) {
+  DCHECK_EQ(Code::BUILTIN, code->kind());
+  code_ = code;
+  Object* root = code;
+  VisitPointer(&root);
+  SerializeDeferredObjects();
+  Pad();
+}
+
+void BuiltinSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
+                                        WhereToPoint where_to_point, int skip) {
+  int root_index = root_index_map_.Lookup(obj);
+  if (root_index != RootIndexMap::kInvalidRootIndex) {
+    PutRoot(root_index, obj, how_to_code, where_to_point, skip);
+    return;
+  }
+
+  if (SerializeKnownObject(obj, how_to_code, where_to_point, skip)) return;
+
+  FlushSkip(skip);
+
+  if (obj == code_ || obj == code_->relocation_info() ||
+      obj == code_->handler_table()) {
+    ObjectSerializer serializer(this, obj, sink_, how_to_code, where_to_point);
+    serializer.Serialize();
+    return;
+  }
+
+  int cache_index = startup_serializer_->PartialSnapshotCacheIndex(obj);
+  sink_->Put(kPartialSnapshotCache + how_to_code + where_to_point,
+             "PartialSnapshotCache");
+  sink_->PutInt(cache_index, "partial_snapshot_cache_index");
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,46 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_BUILTIN_SERIALIZER_H_
+#define V8_SNAPSHOT_BUILTIN_SERIALIZER_H_
+
+#include "src/snapshot/serializer.h"
+
+namespace v8 {
+namespace internal {
+
+class StartupSerializer;
+
+// Serializes the code of a builtin that is deserialized on first use. Only
+// the code object and its metadata go into the builtin's own snapshot; all
+// other objects it refers to are in the startup snapshot, and are referenced
+// through the partial snapshot cache.
+class BuiltinSerializer : public Serializer {
+ public:
+  BuiltinSerializer(Isolate* isolate, StartupSerializer* startup_serializer,
+                    SnapshotByteSink* sink);
+  ~BuiltinSerializer() override;
+
+  // Create a trampoline for each builtin that is worth deserializing lazily,
+  // and a null handle for the others. The handles are created in the
+  // caller's HandleScope, which has to stay open until the snapshot is
+  // complete.
+  static void CreateTrampolines(Isolate* isolate,
+                                Handle<Code>* trampolines);
+
+  void Serialize(Code* code);
+
+ private:
+  void SerializeObject(HeapObject* o, HowToCode how_to_code,
+                       WhereToPoint where_to_point, int skip) override;
+
+  StartupSerializer* startup_serializer_;
+  Code* code_;
+  DISALLOW_COPY_AND_ASSIGN(BuiltinSerializer);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_BUILTIN_SERIALIZER_H_
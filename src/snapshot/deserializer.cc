@@ -158,6 +158,21 @@ MaybeHandle<SharedFunctionInfo> Deserializer::DeserializeCode(
   }
 }
 
+Handle<Code> Deserializer::DeserializeBuiltin(Isolate* isolate) {
+  Initialize(isolate);
+  if (!ReserveSpace()) V8::FatalProcessOutOfMemory("deserialize builtin");
+
+  DisallowHeapAllocation no_gc;
+  Object* root;
+  VisitPointer(&root);
+  DeserializeDeferredObjects();
+  Code* code = Code::cast(root);
+  Assembler::FlushICache(isolate, code->instruction_start(),
+                         code->instruction_size());
+  isolate->heap()->RegisterReservationsForBlackAllocation(reservations_);
+  return Handle<Code>(code, isolate);
+}
+
 Deserializer::~Deserializer() {
   // TODO(svenpanne) Re-enable this assertion when v8 initialization is fixed.
   // DCHECK(source_.AtEOF());
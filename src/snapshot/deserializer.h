@@ -53,6 +53,9 @@ class Deserializer : public SerializerDeserializer {
   // Deserialize a shared function info. Fail gracefully.
   MaybeHandle<SharedFunctionInfo> DeserializeCode(Isolate* isolate);
 
+  // Deserialize the code of a lazily deserialized builtin.
+  Handle<Code> DeserializeBuiltin(Isolate* isolate);
+
   // Add an object to back an attached reference. The order to add objects must
   // mirror the order they are added in the serializer.
   void AddAttachedObject(Handle<HeapObject> attached_object) {
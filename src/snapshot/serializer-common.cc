@@ -33,7 +33,12 @@ uint32_t ExternalReferenceEncoder::Encode(Address address) const {
   DCHECK_NOT_NULL(address);
   HashMap::Entry* entry =
       const_cast<HashMap*>(map_)->Lookup(address, Hash(address));
-  DCHECK_NOT_NULL(entry);
+  if (entry == NULL) {
+    // Embedder callbacks have to be registered as external references to be
+    // serialized.
+    V8_Fatal(__FILE__, __LINE__, "Unknown external reference %p",
+             static_cast<void*>(address));
+  }
   return static_cast<uint32_t>(reinterpret_cast<intptr_t>(entry->value));
 }
 
@@ -9,6 +9,7 @@
 #include "src/api.h"
 #include "src/base/platform/platform.h"
 #include "src/full-codegen/full-codegen.h"
+#include "src/profiler/cpu-profiler.h"
 #include "src/snapshot/deserializer.h"
 #include "src/snapshot/snapshot-source-sink.h"
 #include "src/version.h"
@@ -19,7 +20,8 @@ namespace internal {
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(v8::StartupData* snapshot_blob) {
   return !Snapshot::ExtractStartupData(snapshot_blob).is_empty() &&
-         !Snapshot::ExtractContextData(snapshot_blob).is_empty();
+         Snapshot::ExtractNumContexts(snapshot_blob) > 0 &&
+         !Snapshot::ExtractContextData(snapshot_blob, 0).is_empty();
 }
 #endif  // DEBUG
 
@@ -64,18 +66,77 @@ bool Snapshot::Initialize(Isolate* isolate) {
     int bytes = startup_data.length();
     PrintF("[Deserializing isolate (%d bytes) took %0.3f ms]\n", bytes, ms);
   }
+  if (success) {
+    for (int i = 0; i < Builtins::builtin_count; i++) {
+      if (ExtractBuiltinData(blob, i).is_empty()) continue;
+      isolate->builtins()->MarkAsLazy(static_cast<Builtins::Name>(i));
+    }
+    // Embedders may release their snapshot blob once the isolate and its
+    // contexts are created, unless they promise to keep it alive.
+    bool blob_outlives_isolate = blob == DefaultSnapshotBlob() ||
+                                 isolate->snapshot_blob_outlives_isolate();
+    if (!FLAG_lazy_deserialization || !blob_outlives_isolate) {
+      EnsureBuiltinsAreDeserialized(isolate);
+    }
+  }
   return success;
 }
 
 
+Handle<Code> Snapshot::DeserializeBuiltin(Isolate* isolate,
+                                          Builtins::Name name) {
+  DCHECK(!isolate->builtins()->IsDeserialized(name));
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+
+  Vector<const byte> builtin_data =
+      ExtractBuiltinData(isolate->snapshot_blob(), name);
+  SnapshotData snapshot_data(builtin_data);
+  Deserializer deserializer(&snapshot_data);
+  Handle<Code> code = deserializer.DeserializeBuiltin(isolate);
+  DCHECK_EQ(name, code->builtin_index());
+  isolate->builtins()->InstallDeserializedCode(name, *code);
+  PROFILE(isolate,
+          CodeCreateEvent(Logger::BUILTIN_TAG, AbstractCode::cast(*code),
+                          isolate->builtins()->name(name)));
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    int bytes = builtin_data.length();
+    PrintF("[Deserializing builtin %s (%d bytes) took %0.3f ms]\n",
+           isolate->builtins()->name(name), bytes, ms);
+  }
+  return code;
+}
+
+
+void Snapshot::EnsureBuiltinsAreDeserialized(Isolate* isolate) {
+  HandleScope scope(isolate);
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    Builtins::Name name = static_cast<Builtins::Name>(i);
+    if (!isolate->builtins()->IsDeserialized(name)) {
+      DeserializeBuiltin(isolate, name);
+    }
+  }
+}
+
+
+bool Snapshot::HasContextSnapshot(Isolate* isolate, size_t context_index) {
+  if (!isolate->snapshot_available()) return false;
+  return context_index <
+         static_cast<size_t>(ExtractNumContexts(isolate->snapshot_blob()));
+}
+
+
 MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
-    Isolate* isolate, Handle<JSGlobalProxy> global_proxy) {
-  if (!isolate->snapshot_available()) return Handle<Context>();
+    Isolate* isolate, Handle<JSGlobalProxy> global_proxy,
+    size_t context_index) {
+  if (!HasContextSnapshot(isolate, context_index)) return Handle<Context>();
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
 
   const v8::StartupData* blob = isolate->snapshot_blob();
-  Vector<const byte> context_data = ExtractContextData(blob);
+  Vector<const byte> context_data =
+      ExtractContextData(blob, static_cast<int>(context_index));
   SnapshotData snapshot_data(context_data);
   Deserializer deserializer(&snapshot_data);
 
@@ -95,29 +156,34 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
 
 void CalculateFirstPageSizes(bool is_default_snapshot,
                              const SnapshotData& startup_snapshot,
-                             const SnapshotData& context_snapshot,
+                             const List<SnapshotData*>& context_snapshots,
                              uint32_t* sizes_out) {
   Vector<const SerializedData::Reservation> startup_reservations =
       startup_snapshot.Reservations();
-  Vector<const SerializedData::Reservation> context_reservations =
-      context_snapshot.Reservations();
   int startup_index = 0;
-  int context_index = 0;
+  int num_contexts = context_snapshots.length();
+  List<Vector<const SerializedData::Reservation> > context_reservations(
+      num_contexts);
+  List<int> context_indices(num_contexts);
+  for (int i = 0; i < num_contexts; i++) {
+    context_reservations.Add(context_snapshots[i]->Reservations());
+    context_indices.Add(0);
+  }
 
   if (FLAG_profile_deserialization) {
     int startup_total = 0;
-    int context_total = 0;
     for (auto& reservation : startup_reservations) {
       startup_total += reservation.chunk_size();
     }
-    for (auto& reservation : context_reservations) {
-      context_total += reservation.chunk_size();
+    PrintF("Deserialization will reserve:\n%10d bytes per isolate\n",
+           startup_total);
+    for (int i = 0; i < num_contexts; i++) {
+      int context_total = 0;
+      for (auto& reservation : context_reservations[i]) {
+        context_total += reservation.chunk_size();
+      }
+      PrintF("%10d bytes per context #%d\n", context_total, i);
     }
-    PrintF(
-        "Deserialization will reserve:\n"
-        "%10d bytes per isolate\n"
-        "%10d bytes per context\n",
-        startup_total, context_total);
   }
 
   for (int space = 0; space < i::Serializer::kNumberOfSpaces; space++) {
@@ -126,9 +192,16 @@ void CalculateFirstPageSizes(bool is_default_snapshot,
       single_chunk = false;
       startup_index++;
     }
-    while (!context_reservations[context_index].is_last()) {
-      single_chunk = false;
-      context_index++;
+    // Size the first page for the largest context.
+    uint32_t context_chunk_size = 0;
+    for (int i = 0; i < num_contexts; i++) {
+      int& index = context_indices[i];
+      while (!context_reservations[i][index].is_last()) {
+        single_chunk = false;
+        index++;
+      }
+      context_chunk_size =
+          Max(context_chunk_size, context_reservations[i][index].chunk_size());
     }
 
     uint32_t required = kMaxUInt32;
@@ -138,7 +211,7 @@ void CalculateFirstPageSizes(bool is_default_snapshot,
       // of the first page. For this, we add the chunk sizes and some extra
       // allowance. This way we achieve a smaller startup memory footprint.
       required = (startup_reservations[startup_index].chunk_size() +
-                  2 * context_reservations[context_index].chunk_size()) +
+                  2 * context_chunk_size) +
                  Page::kObjectStartOffset;
       // Add a small allowance to the code space for small scripts.
       if (space == CODE_SPACE) required += 32 * KB;
@@ -156,49 +229,91 @@ void CalculateFirstPageSizes(bool is_default_snapshot,
       DCHECK(single_chunk);
     }
     startup_index++;
-    context_index++;
+    for (int i = 0; i < num_contexts; i++) context_indices[i]++;
   }
 
   DCHECK_EQ(startup_reservations.length(), startup_index);
-  DCHECK_EQ(context_reservations.length(), context_index);
+  for (int i = 0; i < num_contexts; i++) {
+    DCHECK_EQ(context_reservations[i].length(), context_indices[i]);
+  }
 }
 
 
 v8::StartupData Snapshot::CreateSnapshotBlob(
-    const i::StartupSerializer& startup_ser,
-    const i::PartialSerializer& context_ser, Snapshot::Metadata metadata) {
-  SnapshotData startup_snapshot(startup_ser);
-  SnapshotData context_snapshot(context_ser);
+    const SnapshotData& startup_snapshot,
+    const List<SnapshotData*>& context_snapshots,
+    const List<SnapshotData*>& builtin_snapshots,
+    Snapshot::Metadata metadata) {
+  int num_contexts = context_snapshots.length();
+  DCHECK_LT(0, num_contexts);
+  DCHECK_EQ(Builtins::builtin_count, builtin_snapshots.length());
   Vector<const byte> startup_data = startup_snapshot.RawData();
-  Vector<const byte> context_data = context_snapshot.RawData();
 
   uint32_t first_page_sizes[kNumPagedSpaces];
 
   CalculateFirstPageSizes(!metadata.embeds_script(), startup_snapshot,
-                          context_snapshot, first_page_sizes);
+                          context_snapshots, first_page_sizes);
 
   int startup_length = startup_data.length();
-  int context_length = context_data.length();
-  int context_offset = ContextOffset(startup_length);
-
-  int length = context_offset + context_length;
+  int startup_offset = StartupDataOffset(num_contexts);
+  int length = startup_offset + startup_length;
+  for (int i = 0; i < num_contexts; i++) {
+    length += context_snapshots[i]->RawData().length();
+  }
+  int builtins_offset = length;
+  length += (Builtins::builtin_count + 1) * kInt32Size;
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    if (builtin_snapshots[i] == NULL) continue;
+    length += builtin_snapshots[i]->RawData().length();
+  }
   char* data = new char[length];
 
   memcpy(data + kMetadataOffset, &metadata.RawValue(), kInt32Size);
   memcpy(data + kFirstPageSizesOffset, first_page_sizes,
          kNumPagedSpaces * kInt32Size);
-  memcpy(data + kStartupLengthOffset, &startup_length, kInt32Size);
-  memcpy(data + kStartupDataOffset, startup_data.begin(), startup_length);
-  memcpy(data + context_offset, context_data.begin(), context_length);
-  v8::StartupData result = {data, length};
+  memcpy(data + kNumContextsOffset, &num_contexts, kInt32Size);
+  memcpy(data + kBuiltinsOffsetOffset, &builtins_offset, kInt32Size);
+  memcpy(data + startup_offset, startup_data.begin(), startup_length);
+
+  if (FLAG_profile_deserialization) {
+    PrintF("Snapshot blob consists of:\n%10d bytes for startup\n",
+           startup_length);
+  }
 
+  int context_offset = startup_offset + startup_length;
+  for (int i = 0; i < num_contexts; i++) {
+    Vector<const byte> context_data = context_snapshots[i]->RawData();
+    int context_length = context_data.length();
+    memcpy(data + ContextOffsetOffset(i), &context_offset, kInt32Size);
+    memcpy(data + context_offset, context_data.begin(), context_length);
+    context_offset += context_length;
+    if (FLAG_profile_deserialization) {
+      PrintF("%10d bytes for context #%d\n", context_length, i);
+    }
+  }
+  DCHECK_EQ(builtins_offset, context_offset);
+
+  int builtin_offset = builtins_offset + (Builtins::builtin_count + 1) *
+                                             kInt32Size;
+  int lazy_builtins_length = 0;
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    memcpy(data + builtins_offset + i * kInt32Size, &builtin_offset,
+           kInt32Size);
+    if (builtin_snapshots[i] == NULL) continue;
+    Vector<const byte> builtin_data = builtin_snapshots[i]->RawData();
+    memcpy(data + builtin_offset, builtin_data.begin(), builtin_data.length());
+    builtin_offset += builtin_data.length();
+    lazy_builtins_length += builtin_data.length();
+  }
+  memcpy(data + builtins_offset + Builtins::builtin_count * kInt32Size,
+         &builtin_offset, kInt32Size);
+  DCHECK_EQ(length, builtin_offset);
   if (FLAG_profile_deserialization) {
-    PrintF(
-        "Snapshot blob consists of:\n"
-        "%10d bytes for startup\n"
-        "%10d bytes for context\n",
-        startup_length, context_length);
+    PrintF("%10d bytes for lazily deserialized builtins\n",
+           lazy_builtins_length);
   }
+
+  v8::StartupData result = {data, length};
   return result;
 }
 
@@ -210,29 +325,81 @@ Snapshot::Metadata Snapshot::ExtractMetadata(const v8::StartupData* data) {
 }
 
 
+int Snapshot::ExtractBuiltinsOffset(const v8::StartupData* data) {
+  CHECK_LT(kFirstContextOffsetOffset, data->raw_size);
+  int builtins_offset;
+  memcpy(&builtins_offset, data->data + kBuiltinsOffsetOffset, kInt32Size);
+  CHECK_LT(builtins_offset, data->raw_size);
+  return builtins_offset;
+}
+
+
+int Snapshot::ExtractNumContexts(const v8::StartupData* data) {
+  CHECK_LT(kFirstContextOffsetOffset, data->raw_size);
+  int num_contexts;
+  memcpy(&num_contexts, data->data + kNumContextsOffset, kInt32Size);
+  return num_contexts;
+}
+
+
 Vector<const byte> Snapshot::ExtractStartupData(const v8::StartupData* data) {
-  DCHECK_LT(kIntSize, data->raw_size);
-  int startup_length;
-  memcpy(&startup_length, data->data + kStartupLengthOffset, kInt32Size);
-  DCHECK_LT(startup_length, data->raw_size);
+  int num_contexts = ExtractNumContexts(data);
+  CHECK_LT(0, num_contexts);
+  int startup_offset = StartupDataOffset(num_contexts);
+  CHECK_LT(startup_offset, data->raw_size);
+  int first_context_offset;
+  memcpy(&first_context_offset, data->data + ContextOffsetOffset(0),
+         kInt32Size);
+  CHECK_LT(first_context_offset, data->raw_size);
+  int startup_length = first_context_offset - startup_offset;
   const byte* startup_data =
-      reinterpret_cast<const byte*>(data->data + kStartupDataOffset);
+      reinterpret_cast<const byte*>(data->data + startup_offset);
   return Vector<const byte>(startup_data, startup_length);
 }
 
 
-Vector<const byte> Snapshot::ExtractContextData(const v8::StartupData* data) {
-  DCHECK_LT(kIntSize, data->raw_size);
-  int startup_length;
-  memcpy(&startup_length, data->data + kStartupLengthOffset, kIntSize);
-  int context_offset = ContextOffset(startup_length);
+Vector<const byte> Snapshot::ExtractContextData(const v8::StartupData* data,
+                                                int index) {
+  int num_contexts = ExtractNumContexts(data);
+  CHECK_LT(index, num_contexts);
+
+  int context_offset;
+  memcpy(&context_offset, data->data + ContextOffsetOffset(index),
+         kInt32Size);
+  int next_context_offset;
+  if (index == num_contexts - 1) {
+    next_context_offset = ExtractBuiltinsOffset(data);
+  } else {
+    memcpy(&next_context_offset, data->data + ContextOffsetOffset(index + 1),
+           kInt32Size);
+    CHECK_LT(next_context_offset, data->raw_size);
+  }
+
   const byte* context_data =
       reinterpret_cast<const byte*>(data->data + context_offset);
-  DCHECK_LT(context_offset, data->raw_size);
-  int context_length = data->raw_size - context_offset;
+  int context_length = next_context_offset - context_offset;
   return Vector<const byte>(context_data, context_length);
 }
 
+
+Vector<const byte> Snapshot::ExtractBuiltinData(const v8::StartupData* data,
+                                                int index) {
+  DCHECK(index >= 0 && index < Builtins::builtin_count);
+  int offset_offset = ExtractBuiltinsOffset(data) + index * kInt32Size;
+  CHECK_LT(offset_offset + kInt32Size, data->raw_size);
+  int builtin_offset;
+  int next_builtin_offset;
+  memcpy(&builtin_offset, data->data + offset_offset, kInt32Size);
+  memcpy(&next_builtin_offset, data->data + offset_offset + kInt32Size,
+         kInt32Size);
+  CHECK_LE(next_builtin_offset, data->raw_size);
+
+  const byte* builtin_data =
+      reinterpret_cast<const byte*>(data->data + builtin_offset);
+  int builtin_length = next_builtin_offset - builtin_offset;
+  return Vector<const byte>(builtin_data, builtin_length);
+}
+
 SnapshotData::SnapshotData(const Serializer& ser) {
   DisallowHeapAllocation no_gc;
   List<Reservation> reservations;
@@ -14,6 +14,7 @@ namespace internal {
 // Forward declarations.
 class Isolate;
 class PartialSerializer;
+class SnapshotData;
 class StartupSerializer;
 
 class Snapshot : public AllStatic {
@@ -36,9 +37,13 @@ class Snapshot : public AllStatic {
   // Initialize the Isolate from the internal snapshot. Returns false if no
   // snapshot could be found.
   static bool Initialize(Isolate* isolate);
-  // Create a new context using the internal partial snapshot.
+  // Create a new context from the partial snapshot with the given index.
+  // Index 0 is the context that Context::New deserializes.
   static MaybeHandle<Context> NewContextFromSnapshot(
-      Isolate* isolate, Handle<JSGlobalProxy> global_proxy);
+      Isolate* isolate, Handle<JSGlobalProxy> global_proxy,
+      size_t context_index = 0);
+
+  static bool HasContextSnapshot(Isolate* isolate, size_t context_index);
 
   static bool HaveASnapshotToStartFrom(Isolate* isolate);
 
@@ -46,13 +51,22 @@ class Snapshot : public AllStatic {
 
   static uint32_t SizeOfFirstPage(Isolate* isolate, AllocationSpace space);
 
+  // Deserialize the code of a lazily deserialized builtin and install it in
+  // the builtins table.
+  static Handle<Code> DeserializeBuiltin(Isolate* isolate,
+                                         Builtins::Name name);
+
+  // Deserialize all builtins that have not been deserialized yet.
+  static void EnsureBuiltinsAreDeserialized(Isolate* isolate);
 
   // To be implemented by the snapshot source.
   static const v8::StartupData* DefaultSnapshotBlob();
 
   static v8::StartupData CreateSnapshotBlob(
-      const StartupSerializer& startup_ser,
-      const PartialSerializer& context_ser, Snapshot::Metadata metadata);
+      const SnapshotData& startup_snapshot,
+      const List<SnapshotData*>& context_snapshots,
+      const List<SnapshotData*>& builtin_snapshots,
+      Snapshot::Metadata metadata);
 
 #ifdef DEBUG
   static bool SnapshotIsValid(v8::StartupData* snapshot_blob);
@@ -60,26 +74,44 @@ class Snapshot : public AllStatic {
 
  private:
   static Vector<const byte> ExtractStartupData(const v8::StartupData* data);
-  static Vector<const byte> ExtractContextData(const v8::StartupData* data);
+  static Vector<const byte> ExtractContextData(const v8::StartupData* data,
+                                               int index);
+  static Vector<const byte> ExtractBuiltinData(const v8::StartupData* data,
+                                               int index);
+  static int ExtractNumContexts(const v8::StartupData* data);
+  static int ExtractBuiltinsOffset(const v8::StartupData* data);
   static Metadata ExtractMetadata(const v8::StartupData* data);
 
   // Snapshot blob layout:
   // [0] metadata
   // [1 - 6] pre-calculated first page sizes for paged spaces
-  // [7] serialized start up data length
+  // [7] number of contexts N
+  // [8] offset to the builtins section
+  // [9] offset to context 0
+  // ... offset to context N - 1
   // ... serialized start up data
-  // ... serialized context data
+  // ... serialized context 0 data
+  // ... serialized context N - 1 data
+  // ... offsets to the data of each builtin, and to the end of the blob
+  // ... serialized data of the lazily deserialized builtins
+  // Builtins that are deserialized with the isolate have empty data.
 
   static const int kNumPagedSpaces = LAST_PAGED_SPACE - FIRST_PAGED_SPACE + 1;
 
   static const int kMetadataOffset = 0;
   static const int kFirstPageSizesOffset = kMetadataOffset + kInt32Size;
-  static const int kStartupLengthOffset =
+  static const int kNumContextsOffset =
       kFirstPageSizesOffset + kNumPagedSpaces * kInt32Size;
-  static const int kStartupDataOffset = kStartupLengthOffset + kInt32Size;
+  static const int kBuiltinsOffsetOffset = kNumContextsOffset + kInt32Size;
+  static const int kFirstContextOffsetOffset =
+      kBuiltinsOffsetOffset + kInt32Size;
+
+  static int StartupDataOffset(int num_contexts) {
+    return kFirstContextOffsetOffset + num_contexts * kInt32Size;
+  }
 
-  static int ContextOffset(int startup_length) {
-    return kStartupDataOffset + startup_length;
+  static int ContextOffsetOffset(int index) {
+    return kFirstContextOffsetOffset + index * kInt32Size;
   }
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(Snapshot);
@@ -15,7 +15,9 @@ StartupSerializer::StartupSerializer(
     FunctionCodeHandling function_code_handling)
     : Serializer(isolate, sink),
       function_code_handling_(function_code_handling),
-      serializing_builtins_(false) {
+      serializing_builtins_(false),
+      next_partial_cache_index_(0),
+      lazy_builtin_trampolines_(NULL) {
   InitializeCodeAddressMap();
 }
 
@@ -27,6 +29,20 @@ void StartupSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
                                         WhereToPoint where_to_point, int skip) {
   DCHECK(!obj->IsJSFunction());
 
+  if (obj->IsCode() && Code::cast(obj)->kind() == Code::BUILTIN &&
+      Code::cast(obj)->builtin_index() >= 0) {
+    // Refer to lazily deserialized builtins through their trampoline. This
+    // also replaces the trampolines that are left over from the snapshot the
+    // isolate was created from.
+    int index = Code::cast(obj)->builtin_index();
+    if (lazy_builtin_trampolines_ != NULL &&
+        !lazy_builtin_trampolines_[index].is_null()) {
+      obj = *lazy_builtin_trampolines_[index];
+    } else {
+      obj = isolate()->builtins()->builtin(static_cast<Builtins::Name>(index));
+    }
+  }
+
   if (function_code_handling_ == CLEAR_FUNCTION_CODE) {
     if (obj->IsCode()) {
       Code* code = Code::cast(obj);
@@ -90,6 +106,19 @@ void StartupSerializer::SerializeWeakReferencesAndDeferred() {
   Pad();
 }
 
+int StartupSerializer::PartialSnapshotCacheIndex(HeapObject* heap_object) {
+  int index = partial_cache_index_map_.LookupOrInsert(
+      heap_object, next_partial_cache_index_);
+  if (index == PartialCacheIndexMap::kInvalidIndex) {
+    // This object is not part of the partial snapshot cache yet. Add it to the
+    // startup snapshot so we can refer to it via partial snapshot index from
+    // the partial snapshot.
+    VisitPointer(reinterpret_cast<Object**>(&heap_object));
+    return next_partial_cache_index_++;
+  }
+  return index;
+}
+
 void StartupSerializer::Synchronize(VisitorSynchronization::SyncTag tag) {
   // We expect the builtins tag after builtins have been serialized.
   DCHECK(!serializing_builtins_ || tag == VisitorSynchronization::kBuiltins);
@@ -6,6 +6,7 @@
 #define V8_SNAPSHOT_STARTUP_SERIALIZER_H_
 
 #include <bitset>
+#include "src/address-map.h"
 #include "src/snapshot/serializer.h"
 
 namespace v8 {
@@ -28,7 +29,40 @@ class StartupSerializer : public Serializer {
   void SerializeStrongReferences();
   void SerializeWeakReferencesAndDeferred();
 
+  // Returns the index of |o| in the partial snapshot cache, adding it to the
+  // cache if needed. The cache is shared by all partial serializers, so the
+  // index is the same in every context snapshot.
+  int PartialSnapshotCacheIndex(HeapObject* o);
+
+  // References to the builtins with a trampoline in |trampolines| are
+  // serialized as references to the trampoline, which deserializes the
+  // builtin on first use. See BuiltinSerializer::CreateTrampolines.
+  void set_lazy_builtin_trampolines(Handle<Code>* trampolines) {
+    lazy_builtin_trampolines_ = trampolines;
+  }
+
  private:
+  class PartialCacheIndexMap : public AddressMapBase {
+   public:
+    PartialCacheIndexMap() : map_(HashMap::PointersMatch) {}
+
+    static const int kInvalidIndex = -1;
+
+    // Lookup object in the map. Return its index if found, or create
+    // a new entry with new_index as value, and return kInvalidIndex.
+    int LookupOrInsert(HeapObject* obj, int new_index) {
+      HashMap::Entry* entry = LookupEntry(&map_, obj, false);
+      if (entry != NULL) return GetValue(entry);
+      SetValue(LookupEntry(&map_, obj, true), static_cast<uint32_t>(new_index));
+      return kInvalidIndex;
+    }
+
+   private:
+    HashMap map_;
+
+    DISALLOW_COPY_AND_ASSIGN(PartialCacheIndexMap);
+  };
+
   // The StartupSerializer has to serialize the root array, which is slightly
   // different.
   void VisitPointers(Object** start, Object** end) override;
@@ -46,6 +80,9 @@ class StartupSerializer : public Serializer {
   bool serializing_builtins_;
   bool serializing_immortal_immovables_roots_;
   std::bitset<Heap::kStrongRootListLength> root_has_been_serialized_;
+  PartialCacheIndexMap partial_cache_index_map_;
+  int next_partial_cache_index_;
+  Handle<Code>* lazy_builtin_trampolines_;
   DISALLOW_COPY_AND_ASSIGN(StartupSerializer);
 };
 
@@ -230,6 +230,65 @@ inline int FindFirstCharacter(Vector<const PatternChar> pattern,
 }
 
 
+// Returns a word with the lowest bit of every character lane set.
+template <typename SubjectChar>
+inline uintptr_t OneInEveryChar() {
+  return kUintptrAllBitsSet / static_cast<SubjectChar>(-1);
+}
+
+
+// Returns a word with the high bit of every character lane set iff the
+// corresponding character of w is zero. Unlike ByteLessThanMask this is exact
+// per lane, so no carries leak into neighboring lanes.
+template <typename SubjectChar>
+inline uintptr_t ZeroCharMask(uintptr_t w) {
+  const uintptr_t kLowBits =
+      OneInEveryChar<SubjectChar>() * (static_cast<SubjectChar>(-1) >> 1);
+  return ~(((w & kLowBits) + kLowBits) | w | kLowBits);
+}
+
+
+// Finds the first position at which both the first and the last character of
+// a pattern of length >= 2 match. Candidate positions are filtered a machine
+// word at a time by comparing the characters at the first and last pattern
+// offsets for all lanes at once; only words with a hit in both are checked
+// character by character.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(Vector<const PatternChar> pattern,
+                                     Vector<const SubjectChar> subject,
+                                     int index) {
+  DCHECK_LE(2, pattern.length());
+  const int last_offset = pattern.length() - 1;
+  const int max_n = subject.length() - last_offset;
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char = static_cast<SubjectChar>(pattern[last_offset]);
+  const SubjectChar* chars = subject.start();
+  const int kCharsPerWord = sizeof(uintptr_t) / sizeof(SubjectChar);
+  const uintptr_t first_word = OneInEveryChar<SubjectChar>() * first_char;
+  const uintptr_t last_word = OneInEveryChar<SubjectChar>() * last_char;
+
+  int pos = index;
+  for (; max_n - pos >= kCharsPerWord; pos += kCharsPerWord) {
+    uintptr_t first_diff =
+        ReadUnalignedValue<uintptr_t>(chars + pos) ^ first_word;
+    uintptr_t last_diff =
+        ReadUnalignedValue<uintptr_t>(chars + pos + last_offset) ^ last_word;
+    if (ZeroCharMask<SubjectChar>(first_diff | last_diff) == 0) continue;
+    for (int i = pos; i < pos + kCharsPerWord; i++) {
+      if (chars[i] == first_char && chars[i + last_offset] == last_char) {
+        return i;
+      }
+    }
+  }
+  for (; pos < max_n; pos++) {
+    if (chars[pos] == first_char && chars[pos + last_offset] == last_char) {
+      return pos;
+    }
+  }
+  return -1;
+}
+
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -282,15 +341,15 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindFirstAndLastCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
     i++;
     // Loop extracted to separate function to allow using return to do
-    // a deeper break.
-    if (CharCompare(pattern.start() + 1,
-                    subject.start() + i,
-                    pattern_length - 1)) {
+    // a deeper break. The first and last characters are known to match.
+    if (pattern_length == 2 ||
+        CharCompare(pattern.start() + 1, subject.start() + i,
+                    pattern_length - 2)) {
       return i - 1;
     }
   }
@@ -526,17 +585,18 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = FindFirstAndLastCharacter(pattern, subject, i);
       if (i == -1) return -1;
       DCHECK_LE(i, n);
+      // The first and last characters are known to match.
       int j = 1;
-      do {
+      while (j < pattern_length - 1) {
         if (pattern[j] != subject[i + j]) {
           break;
         }
         j++;
-      } while (j < pattern_length);
-      if (j == pattern_length) {
+      }
+      if (j == pattern_length - 1) {
         return i;
       }
       badness += j;
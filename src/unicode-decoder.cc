@@ -5,26 +5,71 @@
 
 #include "src/unicode-inl.h"
 #include "src/unicode-decoder.h"
+#include "src/utils.h"
 #include <stdio.h>
 #include <stdlib.h>
 
 namespace unibrow {
 
+// Returns the length of the ASCII prefix of the stream, checking a word at a
+// time once the stream is aligned.
+static inline size_t AsciiPrefixLength(const uint8_t* stream, size_t length) {
+  const uint8_t* start = stream;
+  const uint8_t* limit = stream + length;
+  if (length >= sizeof(uintptr_t)) {
+    while (reinterpret_cast<uintptr_t>(stream) % sizeof(uintptr_t) != 0) {
+      if (*stream > Utf8::kMaxOneByteChar) return stream - start;
+      ++stream;
+    }
+    DCHECK(Utf8::kMaxOneByteChar == 0x7F);
+    const uintptr_t non_ascii_mask = static_cast<uintptr_t>(-1) / 0xFF * 0x80;
+    while (stream + sizeof(uintptr_t) <= limit &&
+           (*reinterpret_cast<const uintptr_t*>(stream) & non_ascii_mask) ==
+               0) {
+      stream += sizeof(uintptr_t);
+    }
+  }
+  while (stream < limit && *stream <= Utf8::kMaxOneByteChar) ++stream;
+  return stream - start;
+}
+
+
 void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
                             const uint8_t* stream, size_t stream_length) {
   // Assume everything will fit in the buffer and stream won't be needed.
   last_byte_of_buffer_unused_ = false;
+  is_one_byte_ = true;
   unbuffered_start_ = NULL;
   unbuffered_length_ = 0;
   bool writing_to_buffer = true;
   // Loop until stream is read, writing to buffer as long as buffer has space.
   size_t utf16_length = 0;
   while (stream_length != 0) {
+    if (*stream <= Utf8::kMaxOneByteChar) {
+      // Decode a run of ASCII characters in one go.
+      size_t run = AsciiPrefixLength(stream, stream_length);
+      if (writing_to_buffer) {
+        size_t buffered = buffer_length - utf16_length;
+        if (run < buffered) buffered = run;
+        v8::internal::CopyChars(buffer, stream, buffered);
+        buffer += buffered;
+        if (utf16_length + buffered == buffer_length) {
+          writing_to_buffer = false;
+          unbuffered_start_ = stream + buffered;
+          unbuffered_length_ = stream_length - buffered;
+        }
+      }
+      utf16_length += run;
+      stream += run;
+      stream_length -= run;
+      continue;
+    }
     size_t cursor = 0;
     uint32_t character = Utf8::ValueOf(stream, stream_length, &cursor);
     DCHECK(cursor > 0 && cursor <= stream_length);
     stream += cursor;
     stream_length -= cursor;
+    if (character > Latin1::kMaxChar) is_one_byte_ = false;
     bool is_two_characters = character > Utf16::kMaxNonSurrogateCharCode;
     utf16_length += is_two_characters ? 2 : 1;
     // Don't need to write to the buffer, but still need utf16_length.
@@ -62,6 +107,16 @@ void Utf8DecoderBase::WriteUtf16Slow(const uint8_t* stream,
                                      size_t stream_length, uint16_t* data,
                                      size_t data_length) {
   while (data_length != 0) {
+    if (*stream <= Utf8::kMaxOneByteChar) {
+      size_t run = AsciiPrefixLength(
+          stream, stream_length < data_length ? stream_length : data_length);
+      v8::internal::CopyChars(data, stream, run);
+      stream += run;
+      stream_length -= run;
+      data += run;
+      data_length -= run;
+      continue;
+    }
     size_t cursor = 0;
     uint32_t character = Utf8::ValueOf(stream, stream_length, &cursor);
     // There's a total lack of bounds checking for stream
@@ -81,4 +136,31 @@ void Utf8DecoderBase::WriteUtf16Slow(const uint8_t* stream,
   }
 }
 
+
+void Utf8DecoderBase::WriteOneByteSlow(const uint8_t* stream,
+                                       size_t stream_length, uint8_t* data,
+                                       size_t data_length) {
+  while (data_length != 0) {
+    if (*stream <= Utf8::kMaxOneByteChar) {
+      size_t run = AsciiPrefixLength(
+          stream, stream_length < data_length ? stream_length : data_length);
+      v8::internal::CopyChars(data, stream, run);
+      stream += run;
+      stream_length -= run;
+      data += run;
+      data_length -= run;
+      continue;
+    }
+    size_t cursor = 0;
+    uint32_t character = Utf8::ValueOf(stream, stream_length, &cursor);
+    // Bounds were checked and all characters found to be Latin-1 in Reset.
+    DCHECK(character <= Latin1::kMaxChar);
+    stream += cursor;
+    DCHECK(stream_length >= cursor);
+    stream_length -= cursor;
+    *data++ = static_cast<uint8_t>(character);
+    data_length -= 1;
+  }
+}
+
 }  // namespace unibrow
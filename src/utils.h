@@ -1548,6 +1548,48 @@ static inline void WriteUnalignedUInt32(void* p, uint32_t value) {
   WriteUnalignedValue(p, value);
 }
 
+// ----------------------------------------------------------------------------
+// Word-at-a-time byte scanning.
+
+const uintptr_t kOneInEveryByte = kUintptrAllBitsSet / 0xFF;
+const uintptr_t kHighBitInEveryByte = kOneInEveryByte << 7;
+
+// Returns a word that is non-zero iff the word w contains a byte strictly
+// less than n. Only the high bits of the bytes may be set in the result.
+// Requires n <= 0x80.
+inline uintptr_t ByteLessThanMask(uintptr_t w, uint8_t n) {
+  return (w - kOneInEveryByte * n) & ~w & kHighBitInEveryByte;
+}
+
+// Returns a word that is non-zero iff the word w contains the byte c.
+inline uintptr_t ByteEqualMask(uintptr_t w, uint8_t c) {
+  return ByteLessThanMask(w ^ (kOneInEveryByte * c), 1);
+}
+
+// Characters that terminate the body of a JSON string literal, and that
+// JSON.stringify has to escape: '"', '\\' and the control characters.
+inline bool IsJsonStringSpecialChar(uc32 c) {
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+// Returns the index of the first JSON string special character in
+// chars[start, end), or end if there is none. Ordinary characters are
+// skipped a machine word at a time.
+inline int FindJsonStringSpecialChar(const uint8_t* chars, int start,
+                                     int end) {
+  int pos = start;
+  while (end - pos >= kIntptrSize) {
+    uintptr_t w = ReadUnalignedValue<uintptr_t>(chars + pos);
+    if ((ByteEqualMask(w, '"') | ByteEqualMask(w, '\\') |
+         ByteLessThanMask(w, 0x20)) != 0) {
+      break;
+    }
+    pos += kIntptrSize;
+  }
+  while (pos < end && !IsJsonStringSpecialChar(chars[pos])) pos++;
+  return pos;
+}
+
 }  // namespace internal
 }  // namespace v8
 
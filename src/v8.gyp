@@ -1031,6 +1031,8 @@
         'regexp/regexp-macro-assembler-irregexp.h',
         'regexp/regexp-macro-assembler-tracer.cc',
         'regexp/regexp-macro-assembler-tracer.h',
+        'regexp/regexp-nfa.cc',
+        'regexp/regexp-nfa.h',
         'regexp/regexp-macro-assembler.cc',
         'regexp/regexp-macro-assembler.h',
         'regexp/regexp-parser.cc',
@@ -1074,11 +1076,15 @@
         'runtime/runtime-utils.h',
         'runtime/runtime.cc',
         'runtime/runtime.h',
+        'ryu-dtoa.cc',
+        'ryu-dtoa.h',
         'safepoint-table.cc',
         'safepoint-table.h',
         'signature.h',
         'simulator.h',
         'small-pointer-list.h',
+        'snapshot/builtin-serializer.cc',
+        'snapshot/builtin-serializer.h',
         'snapshot/code-serializer.cc',
         'snapshot/code-serializer.h',
         'snapshot/deserializer.cc',
@@ -1917,13 +1923,23 @@
       'include_dirs+': [
         '..',
         '../include',
+        # To be able to find base/trace_event/common/trace_event_common.h
+        '../..',
       ],
       'sources': [
         '../include/libplatform/libplatform.h',
+        '../include/libplatform/v8-tracing.h',
         'libplatform/default-platform.cc',
         'libplatform/default-platform.h',
         'libplatform/task-queue.cc',
         'libplatform/task-queue.h',
+        'libplatform/tracing/trace-buffer.cc',
+        'libplatform/tracing/trace-buffer.h',
+        'libplatform/tracing/trace-config.cc',
+        'libplatform/tracing/trace-object.cc',
+        'libplatform/tracing/trace-writer.cc',
+        'libplatform/tracing/trace-writer.h',
+        'libplatform/tracing/tracing-controller.cc',
         'libplatform/worker-thread.cc',
         'libplatform/worker-thread.h',
       ],
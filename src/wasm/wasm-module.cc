@@ -521,8 +521,9 @@ uint32_t* StartCompilationTasks(
         new WasmCompilationTask(isolate, &compilation_units, &executed_units,
                                 pending_tasks.get(), &result_mutex, &next_unit);
     task_ids[i] = task->id();
-    V8::GetCurrentPlatform()->CallOnBackgroundThread(
-        task, v8::Platform::kShortRunningTask);
+    V8::GetCurrentPlatform()->CallPrioritizedOnBackgroundThread(
+        reinterpret_cast<v8::Isolate*>(isolate), task,
+        v8::Platform::kUserBlockingTask);
   }
   return task_ids;
 }
@@ -166,6 +166,7 @@
         'test-regexp.cc',
         'test-reloc-info.cc',
         'test-representation.cc',
+        'test-ryu-dtoa.cc',
         'test-sampler-api.cc',
         'test-serialize.cc',
         'test-simd.cc',
@@ -17968,6 +17968,101 @@ THREADED_TEST(GetHeapStatistics) {
 }
 
 
+class RuntimeCallStatsVisitorImpl : public v8::RuntimeCallStatsVisitor {
+ public:
+  void VisitCounter(const char* name, int64_t count,
+                    int64_t time_in_microseconds) override {
+    CHECK_LT(0, count);
+    CHECK_LE(0, time_in_microseconds);
+    if (strcmp(name, "API_Object_New") == 0) object_new_count_ = count;
+    if (strcmp(name, "API_Function_Call") == 0) function_call_count_ = count;
+    total_time_ += time_in_microseconds;
+    counters_++;
+  }
+
+  int counters_ = 0;
+  int64_t object_new_count_ = 0;
+  int64_t function_call_count_ = 0;
+  int64_t total_time_ = 0;
+};
+
+
+TEST(SampledRuntimeCallStats) {
+  static const int kCalls = 10000;
+  i::FLAG_runtime_call_stats_sampling = 10;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  isolate->ResetRuntimeCallStats();
+  for (int i = 0; i < kCalls; i++) {
+    v8::HandleScope inner_scope(isolate);
+    v8::Object::New(isolate);
+  }
+  RuntimeCallStatsVisitorImpl visitor;
+  isolate->GetRuntimeCallStats(&visitor);
+  // Only about one in ten calls is timed, but the counts are scaled back up.
+  CHECK_LT(kCalls / 2, visitor.object_new_count_);
+  CHECK_GT(kCalls * 2, visitor.object_new_count_);
+  CHECK_EQ(0, visitor.object_new_count_ % 10);
+
+  isolate->ResetRuntimeCallStats();
+  RuntimeCallStatsVisitorImpl empty_visitor;
+  isolate->GetRuntimeCallStats(&empty_visitor);
+  CHECK_EQ(0, empty_visitor.counters_);
+  i::FLAG_runtime_call_stats_sampling = 0;
+}
+
+
+static void NewObjectCallback(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  args.GetReturnValue().Set(v8::Object::New(args.GetIsolate()));
+}
+
+
+static int64_t CallNewObjectFunction(v8::Isolate* isolate,
+                                     RuntimeCallStatsVisitorImpl* visitor) {
+  static const int kCalls = 10000;
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Function> function =
+      v8::Function::New(context, NewObjectCallback).ToLocalChecked();
+  isolate->ResetRuntimeCallStats();
+  v8::base::ElapsedTimer timer;
+  timer.Start();
+  for (int i = 0; i < kCalls; i++) {
+    v8::HandleScope inner_scope(isolate);
+    function->Call(context, v8::Undefined(isolate), 0, NULL).ToLocalChecked();
+  }
+  int64_t elapsed = timer.Elapsed().InMicroseconds();
+  isolate->GetRuntimeCallStats(visitor);
+  return elapsed;
+}
+
+
+TEST(SampledRuntimeCallStatsNestedCalls) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // When every call is timed, own times do not overlap, so they cannot add
+  // up to more than the time spent.
+  i::FLAG_runtime_call_stats_sampling = 1;
+  RuntimeCallStatsVisitorImpl all_visitor;
+  int64_t elapsed = CallNewObjectFunction(isolate, &all_visitor);
+  CHECK_LT(0, all_visitor.function_call_count_);
+  CHECK_EQ(all_visitor.function_call_count_, all_visitor.object_new_count_);
+  CHECK_LE(all_visitor.total_time_, elapsed);
+
+  // Calls are sampled together with the calls nested in them, so every
+  // sampled call of the function also accounts for its nested call.
+  i::FLAG_runtime_call_stats_sampling = 10;
+  RuntimeCallStatsVisitorImpl sampled_visitor;
+  CallNewObjectFunction(isolate, &sampled_visitor);
+  CHECK_LT(0, sampled_visitor.function_call_count_);
+  CHECK_EQ(sampled_visitor.function_call_count_,
+           sampled_visitor.object_new_count_);
+  i::FLAG_runtime_call_stats_sampling = 0;
+}
+
+
 class VisitorImpl : public v8::ExternalResourceVisitor {
  public:
   explicit VisitorImpl(TestResource** resource) {
@@ -19142,6 +19237,125 @@ TEST(GCCallbacks) {
   isolate->RemoveGCEpilogueCallback(EpilogueCallbackAlloc);
 }
 
+struct GCEventCounts {
+  int scavenges;
+  int mark_compacts;
+};
+
+
+static void GCEventCallback(v8::Isolate* isolate, const v8::GCEvent& event,
+                            void* data) {
+  GCEventCounts* counts = static_cast<GCEventCounts*>(data);
+  CHECK_NOT_NULL(event.reason);
+  CHECK_LE(0, event.duration_ms);
+  CHECK_LT(0, event.scope_count);
+  for (int i = 0; i < event.scope_count; i++) {
+    CHECK_NOT_NULL(event.scope_names[i]);
+    CHECK_LE(0, event.scope_times_ms[i]);
+    if (strcmp(event.scope_names[i], "V8.GC_MC_MARK") == 0) {
+      CHECK_EQ(event.mark_ms, event.scope_times_ms[i]);
+    }
+  }
+  if (event.type == v8::kGCTypeScavenge) {
+    CHECK_EQ(0, event.mark_ms);
+    counts->scavenges++;
+  } else {
+    CHECK_EQ(v8::kGCTypeMarkSweepCompact, event.type);
+    CHECK_EQ(0, event.scavenge_ms);
+    CHECK_LE(event.mark_ms, event.duration_ms);
+    counts->mark_compacts++;
+  }
+  CHECK_LT(0, event.heap_used_after);
+  CHECK_LT(0, event.heap_committed_after);
+}
+
+
+TEST(GCEventCallbackAndLatencyStatistics) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  GCEventCounts counts = {0, 0};
+  isolate->ResetGCLatencyStatistics();
+  isolate->SetGCEventCallback(GCEventCallback, &counts);
+  CcTest::heap()->CollectGarbage(i::NEW_SPACE);
+  CcTest::heap()->CollectGarbage(i::NEW_SPACE);
+  CcTest::heap()->CollectAllGarbage();
+  CHECK_EQ(2, counts.scavenges);
+  CHECK_EQ(1, counts.mark_compacts);
+
+  v8::GCLatencyStatistics scavenges;
+  CHECK(isolate->GetGCLatencyStatistics(v8::kGCTypeScavenge, &scavenges));
+  CHECK_EQ(2u, scavenges.count());
+  CHECK_LE(scavenges.p50_ms(), scavenges.p99_ms());
+  CHECK_LE(scavenges.p99_ms(), scavenges.max_ms());
+  CHECK_LE(scavenges.max_ms(), scavenges.total_ms());
+  v8::GCLatencyStatistics mark_compacts;
+  CHECK(isolate->GetGCLatencyStatistics(v8::kGCTypeMarkSweepCompact,
+                                        &mark_compacts));
+  CHECK_EQ(1u, mark_compacts.count());
+  CHECK_EQ(mark_compacts.max_ms(), mark_compacts.p999_ms());
+  CHECK(!isolate->GetGCLatencyStatistics(v8::kGCTypeIncrementalMarking,
+                                         &mark_compacts));
+
+  isolate->SetGCEventCallback(nullptr);
+  isolate->ResetGCLatencyStatistics();
+  CcTest::heap()->CollectGarbage(i::NEW_SPACE);
+  CHECK_EQ(2, counts.scavenges);
+  CHECK(isolate->GetGCLatencyStatistics(v8::kGCTypeScavenge, &scavenges));
+  CHECK_EQ(1u, scavenges.count());
+  CHECK(isolate->GetGCLatencyStatistics(v8::kGCTypeMarkSweepCompact,
+                                        &mark_compacts));
+  CHECK_EQ(0u, mark_compacts.count());
+  CHECK_EQ(0, mark_compacts.p50_ms());
+}
+
+
+static size_t HeapObjectCount(v8::Isolate* isolate, const char* type,
+                              const char* sub_type) {
+  size_t count = 0;
+  for (size_t i = 0; i < isolate->NumberOfTrackedHeapObjectTypes(); i++) {
+    v8::HeapObjectStatistics statistics;
+    if (!isolate->GetHeapObjectStatisticsAtLastGC(&statistics, i)) continue;
+    if (strcmp(statistics.object_type(), type) == 0 &&
+        strcmp(statistics.object_sub_type(), sub_type) == 0) {
+      CHECK_LE(statistics.object_count(), statistics.object_size());
+      count += statistics.object_count();
+    }
+  }
+  return count;
+}
+
+
+TEST(TrackHeapObjectStatistics) {
+  if (i::FLAG_track_gc_object_stats) return;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::HeapObjectStatistics statistics;
+  CHECK(!isolate->GetHeapObjectStatisticsAtLastGC(&statistics, 0));
+
+  isolate->SetTrackHeapObjectStatistics(true);
+  CompileRun(
+      "var arrays = [];"
+      "for (var i = 0; i < 1000; i++) arrays.push([i]);"
+      "var sparse = [];"
+      "sparse[1000000] = 1;");
+  // Objects marked incrementally are counted, too.
+  i::heap::SimulateIncrementalMarking(CcTest::heap());
+  CcTest::heap()->CollectAllGarbage();
+  size_t arrays = HeapObjectCount(isolate, "JS_ARRAY_TYPE", "");
+  CHECK_LE(1000u, arrays);
+  CHECK_LE(1u, HeapObjectCount(isolate, "FIXED_ARRAY_TYPE",
+                               "DICTIONARY_ELEMENTS_SUB_TYPE"));
+  CHECK_LE(1u, HeapObjectCount(isolate, "CODE_TYPE", "CODE_KIND/BUILTIN"));
+
+  CompileRun("arrays = null;");
+  CcTest::heap()->CollectAllGarbage();
+  CHECK_GT(arrays - 900, HeapObjectCount(isolate, "JS_ARRAY_TYPE", ""));
+
+  isolate->SetTrackHeapObjectStatistics(false);
+  CHECK(!isolate->GetHeapObjectStatisticsAtLastGC(&statistics, 0));
+}
+
 
 THREADED_TEST(TwoByteStringInOneByteCons) {
   // See Chromium issue 47824.
@@ -572,6 +572,85 @@ TEST(CollectCpuProfile) {
   profile->Delete();
 }
 
+class TestChunkListener : public v8::CpuProfileChunkListener {
+ public:
+  TestChunkListener() : chunks_(0), samples_(0) {}
+
+  void OnChunk(const v8::CpuProfileChunk& chunk) override {
+    ++chunks_;
+    for (int i = 0; i < chunk.nodes_count; ++i) {
+      const v8::CpuProfileChunk::Node& node = chunk.nodes[i];
+      CHECK_EQ(0u, nodes_.count(node.id));
+      if (nodes_.empty()) {
+        CHECK_EQ(0u, node.parent_id);
+        CHECK_EQ(0, strcmp("(root)", node.function_name));
+      } else {
+        CHECK_EQ(1u, nodes_.count(node.parent_id));
+      }
+      nodes_[node.id] = node.function_name;
+    }
+    for (int i = 0; i < chunk.samples_count; ++i) {
+      CHECK_EQ(1u, nodes_.count(chunk.samples[i]));
+      CHECK_GE(chunk.time_deltas[i], 0);
+    }
+    samples_ += chunk.samples_count;
+  }
+
+  int chunks() const { return chunks_; }
+  int samples() const { return samples_; }
+  const std::map<unsigned, std::string>& nodes() const { return nodes_; }
+
+ private:
+  int chunks_;
+  int samples_;
+  std::map<unsigned, std::string> nodes_;
+};
+
+
+static int CountNodes(const v8::CpuProfileNode* node) {
+  int count = 1;
+  for (int i = 0; i < node->GetChildrenCount(); ++i) {
+    count += CountNodes(node->GetChild(i));
+  }
+  return count;
+}
+
+
+TEST(StreamingCpuProfile) {
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::CpuProfiler* cpu_profiler = env->GetIsolate()->GetCpuProfiler();
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 200)};
+
+  TestChunkListener listener;
+  v8::Local<v8::String> profile_name = v8_str("streaming");
+  cpu_profiler->SetSamplingInterval(100);
+  cpu_profiler->StartStreamingProfiling(profile_name, &listener, 10);
+  function->Call(env.local(), env->Global(), arraysize(args), args)
+      .ToLocalChecked();
+  v8::CpuProfile* profile = cpu_profiler->StopProfiling(profile_name);
+  CHECK(profile);
+
+  // Samples are only delivered to the listener, but the call tree is kept.
+  CHECK_LT(1, listener.chunks());
+  CHECK_LT(0, listener.samples());
+  CHECK_EQ(0, profile->GetSamplesCount());
+  CHECK_EQ(static_cast<size_t>(CountNodes(profile->GetTopDownRoot())),
+           listener.nodes().size());
+  bool found_loop = false;
+  for (const auto& node : listener.nodes()) {
+    if (node.second == "loop") found_loop = true;
+  }
+  CHECK(found_loop);
+
+  profile->Delete();
+}
+
+
 static const char* hot_deopt_no_frame_entry_test_source =
     "%NeverOptimizeFunction(foo);\n"
     "%NeverOptimizeFunction(start);\n"
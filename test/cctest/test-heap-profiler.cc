@@ -1020,6 +1020,70 @@ TEST(HeapSnapshotJSONSerialization) {
 }
 
 
+TEST(HeapSnapshotStreaming) {
+  // Use tiny buffers to make the serializer read the spilled edges in many
+  // windows and evict strings from its table.
+  i::FLAG_heap_snapshot_streaming_buffer = 64;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "function B(x) { this.x = x; }\n"
+      "var a = new A('streamed string');\n"
+      "var b = new B(a);");
+  TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  i::ScopedVector<char> json(stream.size());
+  stream.WriteTo(json);
+
+  OneByteResource* json_res = new OneByteResource(json);
+  v8::Local<v8::String> json_string =
+      v8::String::NewExternalOneByte(env->GetIsolate(), json_res)
+          .ToLocalChecked();
+  env->Global()
+      ->Set(env.local(), v8_str("json_snapshot"), json_string)
+      .FromJust();
+  // The counts in the header match the arrays, and the path
+  // <root> -> <global>.b.x.s leads to the string.
+  v8::Local<v8::Value> result = CompileRun(
+      "var parsed = JSON.parse(json_snapshot);\n"
+      "var meta = parsed.snapshot.meta;\n"
+      "var node_fields = meta.node_fields.length;\n"
+      "var edge_fields = meta.edge_fields.length;\n"
+      "var count_offset = meta.node_fields.indexOf('edge_count');\n"
+      "var property_type = meta.edge_types[0].indexOf('property');\n"
+      "var first_edges = [];\n"
+      "for (var i = 0, e = 0; i * node_fields < parsed.nodes.length; ++i) {\n"
+      "  first_edges[i] = e;\n"
+      "  e += edge_fields * parsed.nodes[i * node_fields + count_offset];\n"
+      "}\n"
+      "first_edges[i] = e;\n"
+      "function Child(pos, name) {\n"
+      "  var node = pos / node_fields;\n"
+      "  for (var i = first_edges[node]; i < first_edges[node + 1];\n"
+      "       i += edge_fields) {\n"
+      "    if (parsed.edges[i] === property_type &&\n"
+      "        parsed.strings[parsed.edges[i + 1]] === name) {\n"
+      "      return parsed.edges[i + 2];\n"
+      "    }\n"
+      "  }\n"
+      "  return null;\n"
+      "}\n"
+      "var global_pos = parsed.edges[edge_fields + 2];\n"
+      "var s = Child(Child(Child(global_pos, 'b'), 'x'), 's');\n"
+      "var counts = parsed.snapshot;\n"
+      "counts.node_count * node_fields === parsed.nodes.length &&\n"
+      "    counts.edge_count * edge_fields === parsed.edges.length &&\n"
+      "    e === parsed.edges.length &&\n"
+      "    parsed.strings[parsed.nodes[s + 1]] === 'streamed string';");
+  CHECK(result->BooleanValue(env.local()).FromJust());
+  i::FLAG_heap_snapshot_streaming_buffer = 1 << 20;
+}
+
+
 TEST(HeapSnapshotJSONSerializationAborting) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -3010,6 +3074,82 @@ TEST(SamplingHeapProfiler) {
 }
 
 
+TEST(SamplingHeapProfilerRetention) {
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Turn off always_opt. Inlining can cause stack traces to be shorter than
+  // what we expect in this test.
+  v8::internal::FLAG_always_opt = false;
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  const char* script_source =
+      "var kept = [];\n"
+      "function retained() { return new Array(64); }\n"
+      "function garbage() { return new Array(64); }\n"
+      "var foo = function() {\n"
+      "  for (var i = 0; i < 256; ++i) {\n"
+      "    kept.push(retained());\n"
+      "    garbage();\n"
+      "  }\n"
+      "}\n"
+      "foo();";
+  const char* retained_names[] = {"", "foo", "retained"};
+  const char* garbage_names[] = {"", "foo", "garbage"};
+
+  {
+    heap_profiler->StartSamplingHeapProfiler(
+        64, 16, v8::HeapProfiler::kSamplingKeepCollectedSites);
+    CompileRun(script_source);
+    CcTest::heap()->CollectAllGarbage();
+    CcTest::heap()->CollectAllGarbage();
+
+    v8::base::SmartPointer<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile());
+    CHECK(!profile.is_empty());
+
+    auto node_retained =
+        FindAllocationProfileNode(*profile, ArrayVector(retained_names));
+    CHECK(node_retained);
+    CHECK_GT(node_retained->retained_size, 0u);
+    CHECK_GE(node_retained->allocated_size, node_retained->retained_size);
+    CHECK(!node_retained->samples.empty());
+    for (auto sample : node_retained->samples) {
+      CHECK_GT(sample.size, 0u);
+      CHECK_GE(sample.allocation_time_ms, 0);
+      CHECK_GE(sample.gc_count, 2u);
+    }
+
+    // The site is kept although all its objects are gone.
+    auto node_garbage =
+        FindAllocationProfileNode(*profile, ArrayVector(garbage_names));
+    CHECK(node_garbage);
+    CHECK_GT(node_garbage->allocated_size, 0u);
+    CHECK_EQ(0u, node_garbage->retained_size);
+    CHECK(node_garbage->samples.empty());
+
+    heap_profiler->StopSamplingHeapProfiler();
+  }
+
+  {
+    heap_profiler->StartSamplingHeapProfiler(64);
+    CompileRun(script_source);
+    CcTest::heap()->CollectAllGarbage();
+
+    v8::base::SmartPointer<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile());
+    CHECK(!profile.is_empty());
+    CHECK(FindAllocationProfileNode(*profile, ArrayVector(retained_names)));
+    CHECK(!FindAllocationProfileNode(*profile, ArrayVector(garbage_names)));
+
+    heap_profiler->StopSamplingHeapProfiler();
+  }
+}
+
+
 TEST(SamplingHeapProfilerApiAllocation) {
   v8::HandleScope scope(v8::Isolate::GetCurrent());
   LocalContext env;
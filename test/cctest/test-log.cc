@@ -30,12 +30,14 @@
 #ifdef __linux__
 #include <pthread.h>
 #include <signal.h>
+#include <time.h>
 #include <unistd.h>
 #include <cmath>
 #endif  // __linux__
 
 #include "src/v8.h"
 
+#include "src/api.h"
 #include "src/log.h"
 #include "src/log-utils.h"
 #include "src/profiler/cpu-profiler.h"
@@ -45,6 +47,7 @@
 #include "src/version.h"
 #include "src/vm-state-inl.h"
 #include "test/cctest/cctest.h"
+#include "test/cctest/heap/heap-utils.h"
 
 using v8::internal::Address;
 using v8::internal::EmbeddedVector;
@@ -563,6 +566,128 @@ TEST(LogVersion) {
 }
 
 
+TEST(LogAsyncWritesAllLines) {
+  SETUP_FLAGS();
+  bool saved_log_async = i::FLAG_log_async;
+  i::FLAG_log_async = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    ScopedLoggerInitializer initialize_logger(saved_log, saved_prof, isolate);
+    Logger* logger = initialize_logger.logger();
+
+    // Write several times the ring buffer size.
+    const int kLines = 3 * static_cast<int>(i::Log::kRingBufferSize) / 16;
+    for (int i = 0; i < kLines; i++) logger->IntEvent("async-line", i);
+
+    bool exists = false;
+    i::Vector<const char> log(
+        i::ReadFile(initialize_logger.StopLoggingGetTempFile(), &exists, true));
+    CHECK(exists);
+    int expected = 0;
+    const char* end = log.start() + log.length();
+    for (const char* line = log.start(); line < end;) {
+      const char* next = static_cast<const char*>(
+          memchr(line, '\n', end - line));
+      CHECK_NOT_NULL(next);
+      int value;
+      if (sscanf(line, "async-line,%d", &value) == 1) {
+        CHECK_EQ(expected, value);
+        expected++;
+      }
+      line = next + 1;
+    }
+    CHECK_EQ(kLines, expected);
+    log.Dispose();
+  }
+  isolate->Dispose();
+  i::FLAG_log_async = saved_log_async;
+}
+
+
+static uint64_t ReadVarint(const char** pos) {
+  uint64_t value = 0;
+  int shift = 0;
+  uint8_t byte;
+  do {
+    byte = static_cast<uint8_t>(*(*pos)++);
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  return value;
+}
+
+
+TEST(LogBinaryFormat) {
+  SETUP_FLAGS();
+  bool saved_log_binary = i::FLAG_log_binary;
+  i::FLAG_log_binary = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    ScopedLoggerInitializer initialize_logger(saved_log, saved_prof, isolate);
+    Logger* logger = initialize_logger.logger();
+    CompileRun("function binaryLogged() { return 42; } binaryLogged();");
+    logger->LogCompiledFunctions();
+
+    bool exists = false;
+    i::Vector<const char> log(
+        i::ReadFile(initialize_logger.StopLoggingGetTempFile(), &exists, true));
+    CHECK(exists);
+    const char* pos = log.start();
+    const char* end = log.start() + log.length();
+    int magic_length = StrLength(i::Log::kBinaryLogMagic);
+    CHECK_EQ(0, strncmp(pos, i::Log::kBinaryLogMagic, magic_length));
+    CHECK_EQ('\n', pos[magic_length]);
+    pos += magic_length + 1;
+
+    bool found_version = false;
+    bool found_tags = false;
+    bool found_function = false;
+    while (pos < end) {
+      int type = *pos++;
+      uint64_t length = ReadVarint(&pos);
+      const char* record_end = pos + length;
+      CHECK_LE(record_end, end);
+      std::string text;
+      switch (type) {
+        case i::Log::kTextRecord:
+          text.assign(pos, length);
+          if (text.find("v8-version,") == 0) found_version = true;
+          if (text.find("binary-log-tags,code-creation,") == 0) {
+            found_tags = true;
+          }
+          break;
+        case i::Log::kCodeCreationRecord: {
+          CHECK_LT(ReadVarint(&pos),
+                   static_cast<uint64_t>(Logger::NUMBER_OF_LOG_EVENTS));
+          ReadVarint(&pos);                // Kind.
+          CHECK_NE(0u, ReadVarint(&pos));  // Address.
+          ReadVarint(&pos);                // Size.
+          text.assign(pos, record_end - pos);
+          if (text.find("\"binaryLogged ") == 0) found_function = true;
+          break;
+        }
+        case i::Log::kTickRecord:
+          break;
+        default:
+          UNREACHABLE();
+      }
+      pos = record_end;
+    }
+    CHECK_EQ(end, pos);
+    CHECK(found_version);
+    CHECK(found_tags);
+    CHECK(found_function);
+    log.Dispose();
+  }
+  isolate->Dispose();
+  i::FLAG_log_binary = saved_log_binary;
+}
+
+
 // https://crbug.com/539892
 // CodeCreateEvents with really large names should not crash.
 TEST(Issue539892) {
@@ -615,3 +740,176 @@ TEST(Issue539892) {
   }
   isolate->Dispose();
 }
+
+
+#if V8_OS_LINUX
+namespace {
+
+class CountingSampler : public i::Sampler {
+ public:
+  CountingSampler(i::Isolate* isolate, int interval)
+      : Sampler(isolate, interval), ticks_(0) {}
+
+  int ticks() const { return v8::base::NoBarrier_Load(&ticks_); }
+
+ protected:
+  void Tick(i::TickSample* sample) override {
+    v8::base::NoBarrier_AtomicIncrement(&ticks_, 1);
+  }
+
+ private:
+  v8::base::Atomic32 ticks_;
+};
+
+
+double ThreadCpuTimeInMs() {
+  struct timespec ts;
+  CHECK_EQ(0, clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts));
+  return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+
+// Record types and field offsets of the jitdump format written by
+// --perf-prof.
+const uint32_t kJitDumpMagic = 0x4A695444;
+const uint32_t kJitCodeLoad = 0;
+const uint32_t kJitCodeMove = 1;
+const uint32_t kJitCodeUnwindingInfo = 4;
+const int kJitCodeLoadAddressOffset = 32;
+const int kJitCodeLoadIdOffset = 48;
+const int kJitCodeLoadNameOffset = 56;
+const int kJitCodeMoveOldAddressOffset = 32;
+const int kJitCodeMoveNewAddressOffset = 40;
+const int kJitCodeMoveIdOffset = 56;
+
+template <typename T>
+T ReadJitDumpField(const char* record, int offset) {
+  T value;
+  memcpy(&value, record + offset, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+
+// Samplers on the same thread share its CPU time timer, so each of them gets
+// one sample per interval of CPU time rather than one per sampler.
+TEST(ProfSamplersShareThreadCpuTimer) {
+  i::FLAG_prof_cpu_timers = true;
+  const int kIntervalMs = 1;
+  CountingSampler sampler1(CcTest::i_isolate(), kIntervalMs);
+  CountingSampler sampler2(CcTest::i_isolate(), kIntervalMs);
+  sampler1.Start();
+  sampler1.IncreaseProfilingDepth();
+  sampler2.Start();
+  sampler2.IncreaseProfilingDepth();
+
+  double start = ThreadCpuTimeInMs();
+  volatile double x = 10;
+  while (ThreadCpuTimeInMs() - start < 200) x = std::sin(x);
+  double elapsed = ThreadCpuTimeInMs() - start;
+
+  sampler2.DecreaseProfilingDepth();
+  sampler2.Stop();
+  sampler1.DecreaseProfilingDepth();
+  sampler1.Stop();
+
+  int max_ticks = static_cast<int>(elapsed / kIntervalMs) + 10;
+  CHECK_LT(0, sampler1.ticks());
+  CHECK_LE(sampler1.ticks(), max_ticks);
+  CHECK_LT(0, sampler2.ticks());
+  CHECK_LE(sampler2.ticks(), max_ticks);
+}
+
+
+// A compacting GC that moves logged code writes a move record with the code
+// index of its load record. On x64 the unwinding info of the code comes
+// right before the load record.
+TEST(PerfJitDumpFollowsCodeMoves) {
+  SETUP_FLAGS();
+  bool saved_perf_prof = i::FLAG_perf_prof;
+  bool saved_perf_prof_unwinding_info = i::FLAG_perf_prof_unwinding_info;
+  i::FLAG_perf_prof = true;
+  i::FLAG_perf_prof_unwinding_info = true;
+  i::FLAG_manual_evacuation_candidates_selection = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  uint64_t old_start;
+  uint64_t new_start;
+  {
+    ScopedLoggerInitializer initialize_logger(saved_log, saved_prof, isolate);
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    i::Heap* heap = i_isolate->heap();
+    {
+      // Put the code on a fresh page, which can be evacuated.
+      i::AlwaysAllocateScope always_allocate(i_isolate);
+      i::heap::SimulateFullSpace(heap->code_space());
+      CompileRun("function perfMoved() { return 42; } perfMoved();");
+    }
+    i::Handle<i::JSFunction> fun = i::Handle<i::JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("perfMoved")));
+    old_start = reinterpret_cast<uint64_t>(fun->code()->instruction_start());
+    i::Page* evac_page = i::Page::FromAddress(fun->code()->address());
+    CHECK(!evac_page->NeverEvacuate());
+    evac_page->SetFlag(i::MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+    heap->CollectAllGarbage();
+    new_start = reinterpret_cast<uint64_t>(fun->code()->instruction_start());
+    CHECK_NE(old_start, new_start);
+  }
+  // The last logger closes the file.
+  isolate->Dispose();
+
+  i::EmbeddedVector<char, 64> dump_name;
+  i::SNPrintF(dump_name, "./jit-%d.dump", v8::base::OS::GetCurrentProcessId());
+  bool exists = false;
+  i::Vector<const char> dump(i::ReadFile(dump_name.start(), &exists, true));
+  CHECK(exists);
+  unlink(dump_name.start());
+
+  const char* pos = dump.start();
+  const char* end = dump.start() + dump.length();
+  CHECK_EQ(kJitDumpMagic, ReadJitDumpField<uint32_t>(pos, 0));
+  pos += ReadJitDumpField<uint32_t>(pos, 8);
+
+  bool found_load = false;
+  bool found_move = false;
+  uint64_t code_id = 0;
+  uint32_t previous_event = kJitCodeLoad;
+  while (pos < end) {
+    uint32_t event = ReadJitDumpField<uint32_t>(pos, 0);
+    uint32_t size = ReadJitDumpField<uint32_t>(pos, 4);
+    CHECK_LE(16u, size);
+    CHECK_LE(pos + size, end);
+    if (event == kJitCodeLoad &&
+        ReadJitDumpField<uint64_t>(pos, kJitCodeLoadAddressOffset) ==
+            old_start &&
+        strstr(pos + kJitCodeLoadNameOffset, "perfMoved") != nullptr) {
+#if V8_TARGET_ARCH_X64
+      CHECK_EQ(kJitCodeUnwindingInfo, previous_event);
+#else
+      CHECK_NE(kJitCodeUnwindingInfo, previous_event);
+#endif
+      found_load = true;
+      code_id = ReadJitDumpField<uint64_t>(pos, kJitCodeLoadIdOffset);
+    } else if (event == kJitCodeMove &&
+               ReadJitDumpField<uint64_t>(
+                   pos, kJitCodeMoveOldAddressOffset) == old_start) {
+      CHECK(found_load);
+      CHECK_EQ(code_id, ReadJitDumpField<uint64_t>(pos, kJitCodeMoveIdOffset));
+      CHECK_EQ(new_start,
+               ReadJitDumpField<uint64_t>(pos, kJitCodeMoveNewAddressOffset));
+      found_move = true;
+    }
+    previous_event = event;
+    pos += size;
+  }
+  CHECK_EQ(end, pos);
+  CHECK(found_load);
+  CHECK(found_move);
+  dump.Dispose();
+
+  i::FLAG_perf_prof = saved_perf_prof;
+  i::FLAG_perf_prof_unwinding_info = saved_perf_prof_unwinding_info;
+}
+#endif  // V8_OS_LINUX
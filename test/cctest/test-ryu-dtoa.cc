@@ -0,0 +1,109 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdlib.h>
+
+#include "src/v8.h"
+
+#include "src/bignum-dtoa.h"
+#include "src/double.h"
+#include "src/ryu-dtoa.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/gay-shortest.h"
+
+using namespace v8::internal;
+
+static const int kBufferSize = 100;
+
+
+static void CheckShortest(const char* expected_digits, int expected_point,
+                          double v) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  RyuDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp(expected_digits, buffer.start()));
+  CHECK_EQ(StrLength(expected_digits), length);
+  CHECK_EQ(expected_point, point);
+}
+
+
+TEST(RyuDtoaShortestVariousDoubles) {
+  CheckShortest("5", -323, 5e-324);
+  CheckShortest("17976931348623157", 309, 1.7976931348623157e308);
+  CheckShortest("4294967272", 10, 4294967272.0);
+  CheckShortest("4185580496821357", 299, 4.1855804968213567e298);
+  CheckShortest("5562684646268003", -308, 5.5626846462680035e-309);
+  CheckShortest("2147483648", 10, 2147483648.0);
+  CheckShortest("35844466002796428", 299, 3.5844466002796428e+298);
+  CheckShortest("1", 1, 1.0);
+  CheckShortest("1", 0, 0.1);
+  CheckShortest("3", 0, 0.3);
+  CheckShortest("30000000000000004", 0, 0.1 + 0.2);
+  CheckShortest("1", 24, 1e23);
+  CheckShortest("9007199254740992", 16, 9007199254740992.0);
+
+  uint64_t smallest_normal64 = V8_2PART_UINT64_C(0x00100000, 00000000);
+  CheckShortest("22250738585072014", -307,
+                Double(smallest_normal64).value());
+
+  uint64_t largest_denormal64 = V8_2PART_UINT64_C(0x000FFFFF, FFFFFFFF);
+  CheckShortest("2225073858507201", -307, Double(largest_denormal64).value());
+
+  // Halfway cases are rounded to even.
+  CheckShortest("12381497353139132", 16, 1238149735313913.25);
+  CheckShortest("6652004574757002", 15, 665200457475700.25);
+}
+
+
+TEST(RyuDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  bool needed_max_length = false;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    double v = current_test.v;
+    RyuDtoa(v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    if (length == kRyuDtoaMaximalLength) needed_max_length = true;
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.start()));
+  }
+  CHECK(needed_max_length);
+}
+
+
+TEST(RyuDtoaMatchesBignumDtoa) {
+  char ryu_container[kBufferSize];
+  char bignum_container[kBufferSize];
+  Vector<char> ryu_buffer(ryu_container, kBufferSize);
+  Vector<char> bignum_buffer(bignum_container, kBufferSize);
+  int ryu_length, bignum_length;
+  int ryu_point, bignum_point;
+
+  // Powers of two and their neighbours exercise the asymmetric boundaries
+  // and the exact bounds.
+  for (int exponent = -1074; exponent < 1024; exponent++) {
+    double power = std::ldexp(1.0, exponent);
+    double candidates[] = {power, Double(power).NextDouble(),
+                           Double(Double(power).AsUint64() - 1).value()};
+    for (size_t i = 0; i < arraysize(candidates); i++) {
+      double v = candidates[i];
+      if (v <= 0 || Double(v).IsSpecial()) continue;
+      RyuDtoa(v, ryu_buffer, &ryu_length, &ryu_point);
+      BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, bignum_buffer, &bignum_length,
+                 &bignum_point);
+      bignum_buffer[bignum_length] = '\0';
+      CHECK_EQ(bignum_length, ryu_length);
+      CHECK_EQ(bignum_point, ryu_point);
+      CHECK_EQ(0, strcmp(bignum_buffer.start(), ryu_buffer.start()));
+    }
+  }
+}
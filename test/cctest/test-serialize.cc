@@ -885,6 +885,233 @@ TEST(CustomSnapshotDataBlobImmortalImmovableRoots) {
   source.Dispose();
 }
 
+TEST(SnapshotCreatorMultipleContexts) {
+  DisableTurbofan();
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator;
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun("var f = function() { return 1; }");
+      CHECK_EQ(0u, creator.AddContext(context));
+    }
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun("var f = function() { return 2; }");
+      CHECK_EQ(1u, creator.AddContext(context));
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+  }
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blob;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      ExpectInt32("f()", 1);
+    }
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context =
+          v8::Context::FromSnapshot(isolate, 1).ToLocalChecked();
+      v8::Context::Scope context_scope(context);
+      ExpectInt32("f()", 2);
+    }
+    {
+      v8::HandleScope handle_scope(isolate);
+      CHECK(v8::Context::FromSnapshot(isolate, 2).IsEmpty());
+    }
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+}
+
+static void SerializedCallback(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  args.GetReturnValue().Set(v8_num(42));
+}
+
+static intptr_t original_external_references[] = {
+    reinterpret_cast<intptr_t>(SerializedCallback), 0};
+
+TEST(SnapshotCreatorTemplates) {
+  DisableTurbofan();
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator(original_external_references);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::FunctionTemplate> callback =
+          v8::FunctionTemplate::New(isolate, SerializedCallback);
+      v8::Local<v8::ObjectTemplate> global_template =
+          v8::ObjectTemplate::New(isolate);
+      global_template->Set(v8_str("f"), callback);
+      v8::Local<v8::Context> context =
+          v8::Context::New(isolate, NULL, global_template);
+      v8::Context::Scope context_scope(context);
+      ExpectInt32("f()", 42);
+      CHECK_EQ(0u, creator.AddContext(context));
+      CHECK_EQ(0u, creator.AddTemplate(callback));
+      CHECK_EQ(1u, creator.AddTemplate(global_template));
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+  }
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blob;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  params.external_references = original_external_references;
+  v8::Isolate* isolate = v8::Isolate::New(params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    // The function instantiated from the global template is restored.
+    ExpectInt32("f()", 42);
+
+    // Templates can be retrieved and instantiated again.
+    v8::Local<v8::FunctionTemplate> callback =
+        v8::FunctionTemplate::FromSnapshot(isolate, 0).ToLocalChecked();
+    v8::Local<v8::Function> function =
+        callback->GetFunction(context).ToLocalChecked();
+    CHECK(context->Global()->Set(context, v8_str("g"), function).FromJust());
+    ExpectInt32("g()", 42);
+    CHECK(!v8::ObjectTemplate::FromSnapshot(isolate, 1).IsEmpty());
+
+    // Out-of-range indices and template kind mismatches yield nothing.
+    CHECK(v8::FunctionTemplate::FromSnapshot(isolate, 1).IsEmpty());
+    CHECK(v8::ObjectTemplate::FromSnapshot(isolate, 0).IsEmpty());
+    CHECK(v8::FunctionTemplate::FromSnapshot(isolate, 2).IsEmpty());
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+}
+
+TEST(CustomSnapshotDataBlobLazyBuiltins) {
+  DisableTurbofan();
+  FLAG_lazy_deserialization = true;
+  v8::StartupData data = v8::V8::CreateSnapshotDataBlob();
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &data;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    delete[] data.data;  // We can dispose of the snapshot blob now.
+    v8::Context::Scope c_scope(context);
+
+    // Builtins in embedder blobs are deserialized with the isolate.
+    Builtins* builtins = reinterpret_cast<Isolate*>(isolate)->builtins();
+    for (int i = 0; i < Builtins::builtin_count; i++) {
+      CHECK(builtins->IsDeserialized(static_cast<Builtins::Name>(i)));
+    }
+
+    // The first call through a trampoline installs the builtin's code.
+    ExpectInt32("Math.floor(2.5)", 2);
+    Handle<JSFunction> floor = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("Math.floor")));
+    Code* code = builtins->builtin(Builtins::kMathFloor);
+    CHECK_EQ(code, floor->code());
+    CHECK_EQ(code, floor->shared()->code());
+    ExpectInt32("Math.floor(-2.5)", -3);
+  }
+  isolate->Dispose();
+}
+
+TEST(DefaultSnapshotLazyBuiltins) {
+  // Without a default snapshot all builtins are generated.
+  if (Snapshot::DefaultSnapshotBlob() == NULL) return;
+  DisableTurbofan();
+  FLAG_lazy_deserialization = true;
+
+  v8::Isolate::CreateParams params;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope c_scope(context);
+
+    // The default blob outlives the isolate, so builtins with a trampoline
+    // are only deserialized from it on their first call.
+    Builtins* builtins = reinterpret_cast<Isolate*>(isolate)->builtins();
+    CHECK(!builtins->IsDeserialized(Builtins::kMathFloor));
+    ExpectInt32("Math.floor(2.5)", 2);
+    CHECK(builtins->IsDeserialized(Builtins::kMathFloor));
+    Handle<JSFunction> floor = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("Math.floor")));
+    Code* code = builtins->builtin(Builtins::kMathFloor);
+    CHECK_EQ(Code::BUILTIN, code->kind());
+    CHECK_EQ(Builtins::kMathFloor, code->builtin_index());
+    CHECK_EQ(code, floor->code());
+    CHECK_EQ(code, floor->shared()->code());
+    ExpectInt32("Math.floor(-2.5)", -3);
+  }
+  isolate->Dispose();
+}
+
+TEST(CustomSnapshotDataBlobOutlivesIsolateLazyBuiltins) {
+  DisableTurbofan();
+  FLAG_lazy_deserialization = true;
+  v8::StartupData data = v8::V8::CreateSnapshotDataBlob();
+
+  // Isolates created from a blob that outlives them only deserialize the
+  // builtins they use.
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &data;
+  params.snapshot_blob_outlives_isolate = true;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolates[] = {v8::Isolate::New(params),
+                             v8::Isolate::New(params)};
+  Code* char_code_at_code[arraysize(isolates)];
+  for (size_t i = 0; i < arraysize(isolates); i++) {
+    v8::Isolate* isolate = isolates[i];
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope c_scope(context);
+
+    Builtins* builtins = reinterpret_cast<Isolate*>(isolate)->builtins();
+    int num_lazy = 0;
+    for (int j = 0; j < Builtins::builtin_count; j++) {
+      if (!builtins->IsDeserialized(static_cast<Builtins::Name>(j))) {
+        num_lazy++;
+      }
+    }
+    CHECK_LT(0, num_lazy);
+
+    ExpectInt32("'abc'.charCodeAt(1)", 98);
+    CHECK(builtins->IsDeserialized(Builtins::kStringPrototypeCharCodeAt));
+    Handle<JSFunction> char_code_at = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("String.prototype.charCodeAt")));
+    CHECK_EQ(builtins->builtin(Builtins::kStringPrototypeCharCodeAt),
+             char_code_at->code());
+    char_code_at_code[i] = char_code_at->code();
+  }
+  // Each isolate deserializes its own copy of the builtin.
+  CHECK_NE(char_code_at_code[0], char_code_at_code[1]);
+  for (v8::Isolate* isolate : isolates) isolate->Dispose();
+  delete[] data.data;
+}
+
 TEST(TestThatAlwaysSucceeds) {
 }
 
@@ -32,6 +32,9 @@
 
 #include <stdlib.h>
 
+#include <string>
+#include <vector>
+
 #include "src/v8.h"
 
 #include "src/api.h"
@@ -924,6 +927,71 @@ TEST(Utf8Conversion) {
 }
 
 
+TEST(Utf8ConversionLatin1) {
+  // Latin-1 text decodes to a one-byte string and encodes back unchanged.
+  CcTest::InitializeVM();
+  v8::HandleScope handle_scope(CcTest::isolate());
+  // Long enough to exceed the decoder's buffer, with ASCII runs of varying
+  // length and alignment between the two-byte UTF-8 sequences.
+  const int kRepeats = 200;
+  std::string utf8;
+  std::vector<uint16_t> utf16;
+  for (int i = 0; i < kRepeats; i++) {
+    for (int j = 0; j < i % 19; j++) {
+      utf8 += static_cast<char>('a' + j);
+      utf16.push_back('a' + j);
+    }
+    // U+00E9 -> C3 A9
+    utf8 += "\xC3\xA9";
+    utf16.push_back(0xE9);
+  }
+  int length = static_cast<int>(utf16.size());
+  int utf8_length = static_cast<int>(utf8.size());
+  v8::Local<v8::String> latin1 =
+      v8::String::NewFromUtf8(CcTest::isolate(), utf8.data(),
+                              v8::NewStringType::kNormal, utf8_length)
+          .ToLocalChecked();
+  CHECK(latin1->IsOneByte());
+  CHECK_EQ(length, latin1->Length());
+  Handle<String> string = v8::Utils::OpenHandle(*latin1);
+  for (int i = 0; i < length; i++) CHECK_EQ(utf16[i], string->Get(i));
+  CHECK_EQ(utf8_length, latin1->Utf8Length());
+
+  std::vector<char> buffer(utf8_length + 1);
+  int chars_written;
+  CHECK_EQ(utf8_length + 1,
+           latin1->WriteUtf8(buffer.data(), utf8_length + 1, &chars_written));
+  CHECK_EQ(length, chars_written);
+  CHECK_EQ(0, memcmp(utf8.data(), buffer.data(), utf8_length + 1));
+  // A buffer that is too short must not be overrun or end in the middle of a
+  // character.
+  const char kNoChar = static_cast<char>(-1);
+  for (int capacity = utf8_length - 8; capacity < utf8_length; capacity++) {
+    std::fill(buffer.begin(), buffer.end(), kNoChar);
+    int written = latin1->WriteUtf8(buffer.data(), capacity, &chars_written,
+                                    v8::String::NO_NULL_TERMINATION);
+    CHECK_LE(capacity - 1, written);
+    CHECK_LE(written, capacity);
+    CHECK_EQ(0, memcmp(utf8.data(), buffer.data(), written));
+    CHECK_NE(0xC3, static_cast<uint8_t>(buffer[written - 1]));
+    for (int j = written; j <= utf8_length; j++) CHECK_EQ(kNoChar, buffer[j]);
+  }
+
+  // A single character outside Latin-1 still needs a two-byte string.
+  // U+2603 -> E2 98 83
+  utf8 += "\xE2\x98\x83";
+  v8::Local<v8::String> mixed =
+      v8::String::NewFromUtf8(CcTest::isolate(), utf8.data(),
+                              v8::NewStringType::kNormal,
+                              static_cast<int>(utf8.size()))
+          .ToLocalChecked();
+  CHECK(!mixed->IsOneByte());
+  CHECK_EQ(length + 1, mixed->Length());
+  string = v8::Utils::OpenHandle(*mixed);
+  for (int i = 0; i < length; i++) CHECK_EQ(utf16[i], string->Get(i));
+  CHECK_EQ(0x2603, string->Get(length));
+}
+
 TEST(ExternalShortStringAdd) {
   LocalContext context;
   v8::HandleScope handle_scope(CcTest::isolate());
@@ -0,0 +1,70 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// toLocaleString and friends reuse cached ICU objects for non-default
+// locales and options. Results must match the Intl objects, also after
+// entries are evicted from the cache.
+
+var locales = ['en', 'de', 'fr', 'ja', 'ar', 'sr', 'en-u-nu-thai', 'zh'];
+var number = 1234567.891;
+var date = new Date(Date.UTC(2016, 6, 15, 13, 45, 30));
+
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < locales.length; i++) {
+    var locale = locales[i];
+    var numberOptions = [
+      undefined,
+      {style: 'percent'},
+      {style: 'currency', currency: 'EUR'},
+      {minimumFractionDigits: 4, useGrouping: false},
+      {maximumSignificantDigits: 2}
+    ];
+    for (var j = 0; j < numberOptions.length; j++) {
+      var options = numberOptions[j];
+      assertEquals(new Intl.NumberFormat(locale, options).format(number),
+                   number.toLocaleString(locale, options));
+    }
+
+    var dateOptions = [
+      {year: 'numeric', month: 'short', day: 'numeric'},
+      {hour: 'numeric', minute: 'numeric', timeZone: 'UTC'},
+      {weekday: 'long', timeZone: 'America/Los_Angeles'},
+      {month: 'long', hour: 'numeric', timeZone: 'Asia/Tokyo'}
+    ];
+    for (var j = 0; j < dateOptions.length; j++) {
+      var options = dateOptions[j];
+      assertEquals(new Intl.DateTimeFormat(locale, options).format(date),
+                   date.toLocaleString(locale, options));
+    }
+    var all = {year: 'numeric', month: 'numeric', day: 'numeric',
+               hour: 'numeric', minute: 'numeric', second: 'numeric'};
+    assertEquals(new Intl.DateTimeFormat(locale, all).format(date),
+                 date.toLocaleString(locale));
+    assertEquals(
+        new Intl.DateTimeFormat(locale, {timeZone: 'UTC'}).format(date),
+        date.toLocaleDateString(locale, {timeZone: 'UTC'}));
+
+    var collatorOptions = [undefined, {sensitivity: 'base'}, {numeric: true}];
+    for (var j = 0; j < collatorOptions.length; j++) {
+      var options = collatorOptions[j];
+      var collator = new Intl.Collator(locale, options);
+      assertEquals(collator.compare('a10', 'A9'),
+                   'a10'.localeCompare('A9', locale, options));
+    }
+  }
+}
+
+// Options are read on every call.
+var reads = 0;
+var options = {get minimumFractionDigits() { reads++; return 2; }};
+assertEquals('1.50', (1.5).toLocaleString('en', options));
+assertEquals('1.50', (1.5).toLocaleString('en', options));
+assertEquals(2, reads);
+
+assertEquals('0', (-0).toLocaleString('en', {}));
+assertThrows(function() { (1).toLocaleString('en', {style: 'currency'}); },
+             TypeError);
+assertThrows(function() { date.toLocaleString('en', {timeZone: 'Foo/Bar'}); },
+             RangeError);
+assertEquals('Invalid Date', new Date(NaN).toLocaleString('en', {}));
@@ -0,0 +1,83 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Parse', [1000], [
+  new Benchmark('ParseLongStrings', false, false, 0,
+                ParseLongStrings, LongStringsSetup, ParseTearDown),
+  new Benchmark('ParseEscapedStrings', false, false, 0,
+                ParseEscapedStrings, EscapedStringsSetup, ParseTearDown),
+  new Benchmark('ParseIndented', false, false, 0,
+                ParseIndented, IndentedSetup, ParseTearDown),
+  new Benchmark('ParseCompact', false, false, 0,
+                ParseCompact, CompactSetup, ParseTearDown),
+]);
+
+
+var source;
+var result;
+
+function MakeRecords(count) {
+  var records = [];
+  for (var i = 0; i < count; i++) {
+    records.push({
+      id: i,
+      name: "record number " + i,
+      active: i % 2 == 0,
+      score: i * 1.5,
+      tags: ["alpha", "beta", "gamma"],
+      address: { street: "Main Street " + i, city: "Springfield" }
+    });
+  }
+  return records;
+}
+
+function LongStringsSetup() {
+  var strings = [];
+  for (var i = 0; i < 20; i++) {
+    strings.push("Lorem ipsum dolor sit amet, consectetur adipiscing elit, " +
+                 "sed do eiusmod tempor incididunt ut labore et dolore " +
+                 "magna aliqua " + i);
+  }
+  source = JSON.stringify(strings);
+  result = undefined;
+}
+
+function ParseLongStrings() {
+  result = JSON.parse(source);
+}
+
+function EscapedStringsSetup() {
+  var strings = [];
+  for (var i = 0; i < 20; i++) {
+    strings.push("line one\nline two\t\"quoted\" \\ path/to/file " + i);
+  }
+  source = JSON.stringify(strings);
+  result = undefined;
+}
+
+function ParseEscapedStrings() {
+  result = JSON.parse(source);
+}
+
+function IndentedSetup() {
+  source = JSON.stringify(MakeRecords(20), null, 8);
+  result = undefined;
+}
+
+function ParseIndented() {
+  result = JSON.parse(source);
+}
+
+function CompactSetup() {
+  source = JSON.stringify(MakeRecords(20));
+  result = undefined;
+}
+
+function ParseCompact() {
+  result = JSON.parse(source);
+}
+
+function ParseTearDown() {
+  return JSON.stringify(result) === JSON.stringify(JSON.parse(source));
+}
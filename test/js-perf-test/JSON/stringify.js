@@ -0,0 +1,66 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Stringify', [1000], [
+  new Benchmark('StringifyLongStrings', false, false, 0,
+                StringifyLongStrings, LongStringsStringifySetup,
+                StringifyTearDown),
+  new Benchmark('StringifyEscapedStrings', false, false, 0,
+                StringifyEscapedStrings, EscapedStringsStringifySetup,
+                StringifyTearDown),
+  new Benchmark('StringifyRecords', false, false, 0,
+                StringifyRecords, RecordsStringifySetup, StringifyTearDown),
+]);
+
+
+var value;
+var output;
+
+function LongStringsStringifySetup() {
+  value = [];
+  for (var i = 0; i < 20; i++) {
+    value.push("Lorem ipsum dolor sit amet, consectetur adipiscing elit, " +
+               "sed do eiusmod tempor incididunt ut labore et dolore " +
+               "magna aliqua " + i);
+  }
+  output = undefined;
+}
+
+function StringifyLongStrings() {
+  output = JSON.stringify(value);
+}
+
+function EscapedStringsStringifySetup() {
+  value = [];
+  for (var i = 0; i < 20; i++) {
+    value.push("line one\nline two\t\"quoted\" \\ path/to/file " + i);
+  }
+  output = undefined;
+}
+
+function StringifyEscapedStrings() {
+  output = JSON.stringify(value);
+}
+
+function RecordsStringifySetup() {
+  value = [];
+  for (var i = 0; i < 20; i++) {
+    value.push({
+      id: i,
+      name: "record number " + i,
+      active: i % 2 == 0,
+      tags: ["alpha", "beta", "gamma"],
+      address: { street: "Main Street " + i, city: "Springfield" }
+    });
+  }
+  output = undefined;
+}
+
+function StringifyRecords() {
+  output = JSON.stringify(value);
+}
+
+function StringifyTearDown() {
+  return JSON.stringify(JSON.parse(output)) === output;
+}
@@ -5,6 +5,7 @@
 
 load('../base.js');
 load('harmony-string.js');
+load('string-search.js');
 
 
 var success = true;
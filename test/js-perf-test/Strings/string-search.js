@@ -0,0 +1,71 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('StringSearch', [1000], [
+  new Benchmark('IndexOfShortPattern', false, false, 0,
+                IndexOfShortPattern, SearchSetup, SearchTearDown),
+  new Benchmark('IndexOfMediumPattern', false, false, 0,
+                IndexOfMediumPattern, SearchSetup, SearchTearDown),
+  new Benchmark('IndexOfLongPattern', false, false, 0,
+                IndexOfLongPattern, SearchSetup, SearchTearDown),
+  new Benchmark('IndexOfTwoByteSubject', false, false, 0,
+                IndexOfTwoByteSubject, SearchSetup, SearchTearDown),
+  new Benchmark('IncludesShortPattern', false, false, 0,
+                IncludesShortPattern, SearchSetup, SearchTearDown),
+  new Benchmark('SplitShortPattern', false, false, 0,
+                SplitShortPattern, SearchSetup, SearchTearDown),
+  new Benchmark('ReplaceShortPattern', false, false, 0,
+                ReplaceShortPattern, SearchSetup, SearchTearDown),
+]);
+
+
+var log_line = "2016-06-01 12:00:00 INFO request handled in 12ms " +
+               "path=/index.html status=200 bytes=5120\n";
+var small_subject;
+var large_subject;
+var two_byte_subject;
+var search_result;
+
+function SearchSetup() {
+  small_subject = log_line.repeat(4) + "ERROR: disk full\n";
+  large_subject = log_line.repeat(400) + "ERROR: disk full\n";
+  two_byte_subject = log_line.repeat(400) + "\u2603 ERROR: disk full\n";
+  search_result = undefined;
+}
+
+function IndexOfShortPattern() {
+  search_result = large_subject.indexOf("ER") +
+                  small_subject.indexOf("ER");
+}
+
+function IndexOfMediumPattern() {
+  search_result = large_subject.indexOf("ERROR:") +
+                  small_subject.indexOf("ERROR:");
+}
+
+function IndexOfLongPattern() {
+  search_result = large_subject.indexOf("ERROR: disk full") +
+                  small_subject.indexOf("ERROR: disk full");
+}
+
+function IndexOfTwoByteSubject() {
+  search_result = two_byte_subject.indexOf("ERROR:");
+}
+
+function IncludesShortPattern() {
+  search_result = large_subject.includes("ERR");
+}
+
+function SplitShortPattern() {
+  search_result = large_subject.split("ms ").length;
+}
+
+function ReplaceShortPattern() {
+  search_result = large_subject.replace("ERROR", "WARNING").length;
+}
+
+function SearchTearDown() {
+  return search_result !== undefined && search_result !== -1 &&
+         search_result !== false;
+}
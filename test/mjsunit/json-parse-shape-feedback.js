@@ -0,0 +1,62 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+// Objects at the same nesting depth predict the keys of their successors.
+var records = JSON.parse(
+    '[{"id":1,"name":"a","tags":{"x":1,"y":2}},' +
+    ' {"id":2,"name":"b","tags":{"x":3,"y":4}},' +
+    ' {"id":3,"name":"c","tags":{"x":5,"y":6}}]');
+assertEquals(3, records.length);
+for (var i = 0; i < records.length; i++) {
+  assertEquals(i + 1, records[i].id);
+  assertEquals(["id", "name", "tags"], Object.keys(records[i]));
+  assertEquals(["x", "y"], Object.keys(records[i].tags));
+  assertTrue(%HaveSameMap(records[0], records[i]));
+  assertTrue(%HaveSameMap(records[0].tags, records[i].tags));
+}
+assertEquals(6, records[2].tags.y);
+
+// Diverging shapes fall back to the regular key lookup.
+var mixed = JSON.parse(
+    '[{"a":1,"b":2,"c":3},{"a":4,"b":5},{"a":6,"x":7,"c":8},' +
+    ' {"b":9,"a":10},{"a":11,"b":12,"c":13,"d":14},{},{"a":"s"},' +
+    ' {"a":1.5,"b":[1,2]},{"a":{"a":1}},{"1":1,"a":2},{"a\\u0062":1}]');
+assertEquals({a: 1, b: 2, c: 3}, mixed[0]);
+assertEquals({a: 4, b: 5}, mixed[1]);
+assertEquals({a: 6, x: 7, c: 8}, mixed[2]);
+assertEquals(["b", "a"], Object.keys(mixed[3]));
+assertEquals({a: 11, b: 12, c: 13, d: 14}, mixed[4]);
+assertEquals({}, mixed[5]);
+assertEquals({a: "s"}, mixed[6]);
+assertEquals({a: 1.5, b: [1, 2]}, mixed[7]);
+assertEquals({a: {a: 1}}, mixed[8]);
+assertEquals({1: 1, a: 2}, mixed[9]);
+assertEquals({ab: 1}, mixed[10]);
+
+// A key that is a prefix of the predicted one must not match it.
+var prefixes = JSON.parse('[{"abc":1},{"ab":2},{"abcd":3},{"abc":4}]');
+assertEquals([{abc: 1}, {ab: 2}, {abcd: 3}, {abc: 4}], prefixes);
+
+// Deeply nested objects beyond the feedback depth still parse.
+var deep = '{"v":0}';
+for (var i = 1; i < 40; i++) deep = '{"v":' + i + ',"next":' + deep + '}';
+var object = JSON.parse('[' + deep + ',' + deep + ']');
+for (var i = 39; i > 0; i--) {
+  assertEquals(i, object[1].v);
+  object[1] = object[1].next;
+}
+
+// Feedback carries over to later parses and is dropped by full GCs.
+var first = JSON.parse('[{"p":1,"q":{"r":2}}]');
+var second = JSON.parse('[{"p":3,"q":{"r":4}}]');
+assertTrue(%HaveSameMap(first[0], second[0]));
+assertTrue(%HaveSameMap(first[0].q, second[0].q));
+assertEquals([{p: 3, q: {r: 4}}], second);
+assertEquals([{p: 5, s: 6}], JSON.parse('[{"p":5,"s":6}]'));
+gc();
+var third = JSON.parse('[{"p":7,"q":{"r":8}}]');
+assertTrue(%HaveSameMap(first[0], third[0]));
+assertEquals([{p: 7, q: {r: 8}}], third);
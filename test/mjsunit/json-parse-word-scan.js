@@ -0,0 +1,46 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercise the word-at-a-time scanning of string bodies and whitespace with
+// special characters at every offset relative to a machine word.
+
+var filler = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+for (var i = 0; i < 24; i++) {
+  var prefix = filler.substring(0, i);
+  var suffix = filler.substring(i);
+
+  // Plain strings, as values and as keys.
+  assertEquals(prefix, JSON.parse('"' + prefix + '"'));
+  var object = JSON.parse('{"' + prefix + 'x":' + i + '}');
+  assertEquals(i, object[prefix + "x"]);
+
+  // Escapes directly after a run of ordinary characters.
+  assertEquals(prefix + "\n" + suffix,
+               JSON.parse('"' + prefix + '\\n' + suffix + '"'));
+  assertEquals(prefix + '"' + suffix,
+               JSON.parse('"' + prefix + '\\"' + suffix + '"'));
+  assertEquals(prefix + "\u0100" + suffix,
+               JSON.parse('"' + prefix + '\\u0100' + suffix + '"'));
+  var escaped_key = JSON.parse('{"' + prefix + '\\t":1}');
+  assertEquals(1, escaped_key[prefix + "\t"]);
+
+  // Unescaped control characters and unterminated strings are errors.
+  assertThrows(function() { JSON.parse('"' + prefix + '\n' + suffix + '"'); },
+               SyntaxError);
+  assertThrows(function() { JSON.parse('"' + prefix + '\x01"'); },
+               SyntaxError);
+  assertThrows(function() { JSON.parse('"' + prefix); }, SyntaxError);
+  assertThrows(function() { JSON.parse('{"' + prefix); }, SyntaxError);
+
+  // Whitespace runs of every length, including mixed whitespace.
+  var spaces = new Array(i + 1).join(" ");
+  assertEquals([1, 2], JSON.parse("[" + spaces + "1," + spaces + "2" +
+                                  spaces + "]" + spaces));
+  assertEquals({a: 1}, JSON.parse(spaces + "{\n" + spaces + "\t\"a\"" +
+                                  spaces + "\r:" + spaces + "1}"));
+  assertThrows(function() { JSON.parse(spaces + "1" + spaces + "x"); },
+               SyntaxError);
+  assertThrows(function() { JSON.parse(spaces + "\x0b1"); }, SyntaxError);
+}
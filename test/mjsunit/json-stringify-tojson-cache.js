@@ -0,0 +1,46 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The stringifier caches receiver maps known to have no toJSON. Adding
+// toJSON to a prototype during serialization must invalidate that.
+var objects = [{a: 1}, {get b() {
+  Object.prototype.toJSON = function() { return "replaced"; };
+  return 2;
+}}, {a: 3}];
+assertEquals('[{"a":1},{"b":2},"replaced"]', JSON.stringify(objects));
+delete Object.prototype.toJSON;
+assertEquals('[{"a":1},"replaced",{"a":3}]', JSON.stringify([{a: 1}, {
+  get b() { return 2; },
+  toJSON: function() { return "replaced"; }
+}, {a: 3}]));
+
+var arrays = [[1], {get c() {
+  Array.prototype.toJSON = function() { return "array"; };
+  return 3;
+}}, [2]];
+assertEquals('[[1],{"c":3},"array"]', JSON.stringify(arrays));
+delete Array.prototype.toJSON;
+assertEquals('[[1],[2]]', JSON.stringify([[1], [2]]));
+
+// Own toJSON properties added during serialization change the map.
+var first = {x: 1};
+var second = {x: 2};
+var third = {x: 3};
+var holder = [first, {get y() {
+  third.toJSON = function() { return "own"; };
+  return 0;
+}}, second, third];
+assertEquals('[{"x":1},{"y":0},{"x":2},"own"]', JSON.stringify(holder));
+
+// Characters that need escaping at every offset within a word.
+var filler = "abcdefghijklmnopqrstuvwxyz";
+for (var i = 0; i < 20; i++) {
+  var prefix = filler.substring(0, i);
+  assertEquals('"' + prefix + '\\n' + prefix + '"',
+               JSON.stringify(prefix + "\n" + prefix));
+  assertEquals('"' + prefix + '\\"\\\\"', JSON.stringify(prefix + '"\\'));
+  assertEquals('"' + prefix + ' !\x7f\xff"',
+               JSON.stringify(prefix + " !\x7f\xff"));
+  assertEquals('"' + prefix + '\\u0001"', JSON.stringify(prefix + "\x01"));
+}
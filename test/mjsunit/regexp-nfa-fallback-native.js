@@ -0,0 +1,36 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up-subject-length=1
+// Flags: --regexp-nfa-on-excessive-backtracks
+// Flags: --regexp-backtracks-before-nfa=1000
+
+// Regexps that run as native code count their backtracks too. A match that
+// exceeds the budget continues in the linear-time automaton instead of
+// backtracking exponentially.
+
+var re = /(a+)+$/;
+assertEquals(["aaa", "aaa"], re.exec("baaa"));
+var subject = new Array(40).join("a") + "b";
+assertNull(re.exec(subject));
+assertEquals(["aaa", "aaa"], re.exec("baaa"));
+
+// Backtracking into greedy loops counts as well.
+var words = /^(\w*\s*)*!$/;
+assertEquals(["ab cd!", "cd"], words.exec("ab cd!"));
+assertNull(words.exec(new Array(20).join("ab ") + "?"));
+
+// Global regexps fall back in the middle of a match loop.
+var global_re = /(x+x+)+y/g;
+var text = new Array(30).join("x") + " xxy " + new Array(30).join("x");
+assertEquals(["xxy"], text.match(global_re));
+assertEquals(["xxy", "xxy"], ("xxy " + text).match(/(x+x+)+y/g));
+
+// Patterns the automaton cannot handle are compiled without a budget.
+assertNull(/(a+)+\1$/.exec(new Array(18).join("a") + "b"));
+
+// If the automaton program would be too large, the native code is compiled
+// again without a budget to finish the match.
+assertEquals(["xxy", "xx"],
+             new RegExp("(x+x+)+y|z{40000}").exec("xxxxxxxx xxy"));
@@ -0,0 +1,34 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up-ticks=1000 --regexp-nfa-on-excessive-backtracks
+// Flags: --regexp-backtracks-before-nfa=1000
+
+// An interpreted regexp that exceeds the backtrack budget continues in the
+// linear-time automaton, and keeps using it for later executions.
+
+var re = /(a+)+$/;
+var subject = new Array(40).join("a") + "b";
+assertNull(re.exec(subject));
+assertEquals(["aaa", "aaa"], re.exec("baaa"));
+assertNull(re.exec(subject));
+
+var global_re = /(x+x+)+y/g;
+var text = new Array(30).join("x") + " xxy " + new Array(30).join("x");
+assertEquals(["xxy"], text.match(global_re));
+assertEquals("[xxy]", text.replace(global_re, "[$&]").replace(/x+ | x+/g, ""));
+
+// Patterns the automaton cannot handle keep backtracking without a limit.
+assertEquals(["abab", "ab"], /(ab)\1/.exec("xabab"));
+assertEquals(["aa", "a"], /(a)(?=a)\1/.exec(new Array(20).join("ab") + "aa"));
+
+// Patterns the automaton cannot handle are never started with a budget, so
+// an exponential search still completes in the interpreter.
+assertNull(/(a+)+\1$/.exec(new Array(18).join("a") + "b"));
+
+// If the automaton program would be too large, the match is finished in
+// native code instead, also in the middle of a global loop.
+var big_re = new RegExp("(x+x+)+y|z{40000}", "g");
+assertEquals(["xxy", "xxy"], ("xxy " + text).match(big_re));
+assertEquals(["xxy", "xx"], new RegExp("(x+x+)+y|z{40000}").exec(text));
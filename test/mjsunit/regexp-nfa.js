@@ -0,0 +1,93 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-nfa
+
+// Regexps without back references and lookarounds are executed by the
+// linear-time automaton and must produce the same results as Irregexp.
+
+function test(expected, re, subject) {
+  assertEquals(expected, re.exec(subject), re + " on " + subject);
+}
+
+test(["abc"], /abc/, "xxabcxx");
+test(null, /abd/, "xxabcxx");
+test(["a"], /a|ab/, "xab");
+test(["ab", "b"], /a(b|bc)/, "abc");
+test(["aaa", "a"], /(a)+/, "aaa");
+test(["aaa", "aa", "a"], /((a)*)a/, "aaa");
+test(["b", undefined], /(a)*b/, "b");
+test(["aab", "a"], /(a)*b/, "aab");
+
+// Captures inside a quantifier are reset on every iteration.
+test(["abab", "b"], /(?:a|(b))*/, "abab");
+test(["ac", "c"], /(?:a|b|(c))+/, "ac");
+test(["ca", undefined], /(?:a|b|(c))+/, "ca");
+
+// Greedy and non-greedy quantifiers.
+test(["aaa"], /a*/, "aaab");
+test([""], /a*?/, "aaab");
+test(["aaab"], /a*?b/, "aaab");
+test(["<a><b>"], /<.*>/, "<a><b>");
+test(["<a>"], /<.*?>/, "<a><b>");
+test(["aa"], /a{2}/, "aaaa");
+test(["aaa"], /a{2,3}/, "aaaa");
+test(["aa"], /a{2,3}?/, "aaaa");
+test(["aaaa"], /a{2,}/, "aaaa");
+test(null, /a{5,}/, "aaaa");
+test(["ab", "b"], /a(b)?/, "abb");
+test(["a", undefined], /a(b)??/, "abb");
+
+// Character classes.
+test(["123"], /\d+/, "abc123def");
+test(["abc"], /[^\d]+/, "abc123");
+test(["foo_1"], /\w+/, "  foo_1!");
+test(["  "], /\s+/, "a  b");
+test(["b-d"], /[a-c]-[d]/, "b-d");
+test(["x"], /./, "\nx");
+test(null, /[]/, "abc");
+test(["a"], /[^]/, "a");
+
+// Case-insensitive matching.
+test(["ABC"], /abc/i, "xABC");
+test(["Xy"], /[w-z]+/i, "Xy1");
+test(["\u00e9\u00c9"], /\u00e9+/i, "\u00e9\u00c9");
+test(["abc"], /[^X]+/i, "abcxd");
+
+// Assertions.
+test(["foo"], /^foo/, "foobar");
+test(null, /^bar/, "foobar");
+test(["bar"], /^bar/m, "foo\nbar");
+test(["bar"], /bar$/, "foobar");
+test(["foo"], /foo$/m, "foo\nbar");
+test(null, /foo$/, "foo\nbar");
+test(["bar"], /\bbar\b/, "foo bar baz");
+test(null, /\bar\b/, "foo bar baz");
+test(["ar"], /\Bar\b/, "foo bar baz");
+
+// Two-byte subjects.
+test(["\u2603\u2603", "\u2603"], /(\u2603)+/, "a\u2603\u2603b");
+test(["x"], /[^\u2603]/, "\u2603x");
+
+// Global and sticky regexps.
+assertEquals(["ab", "abb", "a"], "xabyabbza".match(/ab*/g));
+assertEquals("x[b]y[bb]z[]", "xabyabbza".replace(/a(b*)/g, "[$1]"));
+assertEquals(["", "", ""], "ab".match(/x*/g));
+assertEquals(["a", "b", "c"], "a , b,c".split(/\s*,\s*/));
+var sticky = /b/y;
+sticky.lastIndex = 1;
+assertEquals(["b"], sticky.exec("abb"));
+assertEquals(2, sticky.lastIndex);
+sticky.lastIndex = 0;
+assertNull(sticky.exec("abb"));
+
+// Patterns that need backtracking still work through Irregexp.
+test(["abab", "ab"], /(ab)\1/, "xabab");
+test(["a"], /a(?=b)/, "acab");
+
+// Catastrophic patterns run in linear time.
+var subject = new Array(40).join("a") + "b";
+assertNull(/(a+)+$/.exec(subject));
+assertNull(/(a|aa)+$/.exec(subject));
+assertNull(/(?:a*)*c/.exec(subject));
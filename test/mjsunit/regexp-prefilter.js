@@ -0,0 +1,96 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-prefilter --harmony-regexp-lookbehind
+
+// Regexps with a literal that every match contains search for the literal
+// first and start matching no earlier than it allows. Results must be the
+// same as without the search.
+
+var padding = new Array(2000).join("-");
+
+function test(expected, re, subject) {
+  var m = re.exec(subject);
+  assertEquals(expected, m, re + " on " + subject);
+  // Repeat on a long subject, which is matched by native code right away.
+  var long_m = re.exec(padding + subject);
+  assertEquals(expected, long_m, re + " on long " + subject);
+  if (m !== null) assertEquals(padding.length + m.index, long_m.index);
+}
+
+// Literal at a fixed offset.
+test(["ERROR: disk", "disk"], /ERROR: (\w+)/, "INFO: ok ERROR: disk");
+test(null, /ERROR: (\w+)/, "INFO: ok WARNING: disk");
+test(["xxabc"], /\w\wabc/, "a xxabc");
+test(["(abc)", "abc"], /\((abc)\)/, "abc (abc)");
+
+// Literal at a bounded offset.
+test(["aaabcd"], /a{1,3}bcd/, "aaaaabcd");
+test(["x1234", "1", "234"], /x(1)?(234)/, "x1234");
+test(["x234", undefined, "234"], /x(1)?(234)/, "x234");
+test(["abc-def"], /[a-c]+-def/, "abc-def");
+
+// Literal at an unbounded offset.
+test(["123 end"], /\d+ end/, "1 2 123 end");
+test(null, /\d+ end/, "1 2 123 fin");
+test(["b:abc"], /(?:a|b)*:abc/, "b:abc");
+
+// Literals inside mandatory quantifiers and captures.
+test(["abcabc"], /(?:abc)+/, "ababcabc");
+test(["zfoo!", "foo"], /z(foo)+!/, "zfo zfoo!");
+test(null, /(?:abc){2}/, "abcab");
+
+// Only literals shared by all alternatives can be required.
+test(["def"], /abc|def/, "xdefx");
+test(["x"], /x(?:abc)?/, "yx");
+test(["x"], /x(?:abc)*/, "yx");
+
+// Assertions and lookarounds around the literal.
+test(["abc"], /\babc\b/, "xabc abc");
+test(["abc"], /(?=abc)abc/, "ababc");
+test(["def"], /(?<=abc)def/, "xdef abcdef");
+test(null, /(?<=abc)def/, "xdef abdef");
+test(["abcd"], /abc(?!e)./, "abce abcd");
+
+// Flags that disable the search.
+test(["ABCD"], /abcd/i, "xABCD");
+test(["\ud83d\ude00xyz"], /.xyz/u, "\ud83d\ude00xyz");
+test(null, /abcd/y, "xabcd");
+
+// Anchoring at the start disables the search. Multiline anchors can match
+// after any line terminator, so the search still applies to them.
+test(null, /^abcd/, "x\nabcd");
+test(["abcd"], /^abcd/m, "x\nabcd");
+test(null, /^abcd/m, "xabcd");
+
+// Two-byte subjects and literals.
+test(["\u2603abc"], /.abc/, "x\u2603abc");
+test(["a\u2603\u2603\u2603"], /a\u2603{3}/, "a\u2603a\u2603\u2603\u2603");
+test(["x\u00e9\u00e9\u00e9"], /x\u00e9\u00e9\u00e9/,
+     "\u2603x\u00e9\u00e9\u00e9");
+test(null, /x\u2603\u2603\u2603/, "x\u00e9\u00e9\u00e9");
+
+// Global regexps.
+var log = "ok\nERROR: a\nok\nERROR: bb\nERROR: ccc\n";
+assertEquals(["ERROR: a", "ERROR: bb", "ERROR: ccc"],
+             log.match(/ERROR: \w+/g));
+assertEquals("ok\n[a]\nok\n[bb]\n[ccc]\n",
+             log.replace(/ERROR: (\w+)/g, "[$1]"));
+assertEquals(["ok\n", "\nok\n", "\n", "\n"], log.split(/ERROR: \w+/));
+assertEquals(log, log.replace(/FATAL: (\w+)/g, "[$1]"));
+
+var re = /(\w+)=abc/g;
+var positions = [];
+var m;
+while ((m = re.exec("x=abc y=abd zz=abc")) !== null) {
+  positions.push(m.index, m[1]);
+}
+assertEquals([0, "x", 12, "zz"], positions);
+
+// Sticky regexps only match at lastIndex.
+var sticky = /\w+=abc/y;
+sticky.lastIndex = 1;
+assertNull(sticky.exec("x y=abc"));
+sticky.lastIndex = 2;
+assertEquals(["y=abc"], sticky.exec("x y=abc"));
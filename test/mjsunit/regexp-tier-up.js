@@ -0,0 +1,76 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=3
+
+// Regexps start out in the bytecode interpreter and are compiled to native
+// code after a few executions. Results must not change across the switch.
+
+(function TestExecAcrossTierUp() {
+  var re = /(\d+)-(\d+)?/;
+  for (var i = 0; i < 10; i++) {
+    var m = re.exec("abc 12-34 def");
+    assertEquals(["12-34", "12", "34"], m);
+    assertEquals(4, m.index);
+    m = re.exec("7-");
+    assertEquals(["7-", "7", undefined], m);
+    assertNull(re.exec("no digits"));
+  }
+})();
+
+(function TestGlobalAcrossTierUp() {
+  var re = /a(b*)/g;
+  for (var i = 0; i < 10; i++) {
+    assertEquals(["ab", "abb", "a"], "xabyabbza".match(re));
+    assertEquals("x[b]y[bb]z[]", "xabyabbza".replace(re, "[$1]"));
+    assertEquals(0, re.lastIndex);
+  }
+})();
+
+(function TestLastIndexAcrossTierUp() {
+  var re = /o/g;
+  for (var i = 0; i < 10; i++) {
+    re.lastIndex = 0;
+    var positions = [];
+    var m;
+    while ((m = re.exec("foo boo")) !== null) positions.push(m.index);
+    assertEquals([1, 2, 5, 6], positions);
+  }
+})();
+
+(function TestTwoByteAndOneByteSubjects() {
+  var re = /(\u00e9+)|(x+)/;
+  for (var i = 0; i < 10; i++) {
+    assertEquals(["\u00e9\u00e9", "\u00e9\u00e9", undefined],
+                 re.exec("a\u00e9\u00e9b"));
+    assertEquals(["xx", undefined, "xx"], re.exec("\u2603xx"));
+    assertEquals(["xxx", undefined, "xxx"], re.exec("axxx"));
+  }
+})();
+
+(function TestLongSubjectTiersUpImmediately() {
+  var re = /b+$/;
+  var subject = new Array(5000).join("a") + "bbb";
+  assertEquals(["bbb"], re.exec(subject));
+  assertEquals(["bbb"], re.exec("abbb"));
+  assertNull(re.exec(subject + "c"));
+})();
+
+(function TestSplitAcrossTierUp() {
+  var re = /\s*,\s*/;
+  for (var i = 0; i < 10; i++) {
+    assertEquals(["a", "b", "c"], "a , b,c".split(re));
+  }
+})();
+
+(function TestDeepBacktrackingInInterpreter() {
+  // Just below the subject length that triggers native compilation, this
+  // needs more backtrack entries than the interpreter starts out with.
+  var re = /((a)|(b))*c/;
+  var subject = new Array(500).join("ab") + "c";
+  assertEquals(999, subject.length);
+  var m = re.exec(subject);
+  assertEquals(subject, m[0]);
+  assertEquals("b", m[1]);
+})();
@@ -0,0 +1,44 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns are located by filtering candidate positions on their first
+// and last character a word at a time. Check matches at every offset within
+// a word, for one-byte and two-byte subjects and patterns.
+
+function NaiveIndexOf(subject, pattern, start) {
+  for (var i = start; i + pattern.length <= subject.length; i++) {
+    if (subject.substring(i, i + pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+function Check(subject, pattern) {
+  for (var start = 0; start <= subject.length; start++) {
+    assertEquals(NaiveIndexOf(subject, pattern, start),
+                 subject.indexOf(pattern, start),
+                 "'" + pattern + "' in '" + subject + "' from " + start);
+  }
+}
+
+var one_byte_subject = "abacabadabacabaeabacabadabacabaf\xe9ab\xe9a";
+var two_byte_subject = "ab\u1234cab\u1234dab\u1235cab\u1234eab\u1234cabaf" +
+                       "\u01234ab\u12345";
+var patterns = ["ab", "ba", "aba", "abac", "abacab", "cabae", "daba",
+                "abacabad", "abacabadabacabae", "f\xe9", "\xe9a", "\u1234c",
+                "b\u1234d", "ab\u1234", "\u1234e", "zz", "az"];
+
+for (var i = 0; i < patterns.length; i++) {
+  Check(one_byte_subject, patterns[i]);
+  Check(two_byte_subject, patterns[i]);
+}
+
+// Matches right at the end of the subject and near lane boundaries.
+for (var n = 0; n < 40; n++) {
+  var prefix = new Array(n + 1).join("x");
+  assertEquals(n, (prefix + "ab").indexOf("ab"));
+  assertEquals(n, (prefix + "a\u0100b").indexOf("a\u0100b"));
+  assertEquals(-1, (prefix + "a").indexOf("ab"));
+  assertEquals(n, (prefix + "\u0100\u0101").indexOf("\u0100\u0101"));
+  assertEquals(-1, (prefix + "\u0101\u0100").indexOf("\u0100\u0101"));
+}
@@ -0,0 +1,103 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Load the log reader implementation from <project root>/tools.
+// Files: tools/csvparser.js tools/logreader.js
+
+function BinaryLog() {
+  this.bytes = [];
+  var magic = LogReader.BINARY_LOG_MAGIC + '\n';
+  for (var i = 0; i < magic.length; ++i) this.bytes.push(magic.charCodeAt(i));
+}
+
+BinaryLog.prototype.record = function(type, payload) {
+  this.bytes.push(type);
+  this.bytes.push.apply(this.bytes, varint(payload.length));
+  this.bytes.push.apply(this.bytes, payload);
+};
+
+BinaryLog.prototype.buffer = function() {
+  return new Uint8Array(this.bytes).buffer;
+};
+
+function varint(value) {
+  var result = [];
+  while (value >= 0x80) {
+    result.push((value % 0x80) | 0x80);
+    value = Math.floor(value / 0x80);
+  }
+  result.push(value);
+  return result;
+}
+
+function signedVarint(value) {
+  return varint(value < 0 ? -2 * value - 1 : 2 * value);
+}
+
+function text(str) {
+  var result = [];
+  for (var i = 0; i < str.length; ++i) result.push(str.charCodeAt(i));
+  return result;
+}
+
+function decode(log) {
+  var reader = new LogReader({}, false, false);
+  var lines = [];
+  reader.processLogLine = function(line) { lines.push(line); };
+  reader.processBinaryLog(log.buffer());
+  return lines;
+}
+
+var T = LogReader.BinaryRecordType;
+
+(function testTextRecords() {
+  var log = new BinaryLog();
+  log.record(T.TEXT, text('v8-version,5,3,0,0,0'));
+  log.record(T.TEXT, text('binary-log-tags,code-creation,tick'));
+  log.record(T.TEXT, text('shared-library,"/lib/libc.so",0x1000,0x2000,0'));
+  assertEquals(['v8-version,5,3,0,0,0',
+                'shared-library,"/lib/libc.so",0x1000,0x2000,0'],
+               decode(log));
+})();
+
+(function testCodeCreationRecords() {
+  var log = new BinaryLog();
+  log.record(T.TEXT, text('binary-log-tags,Builtin,LazyCompile'));
+  log.record(T.CODE_CREATION,
+             [].concat(varint(1), varint(0), varint(0x12345678), varint(300),
+                       text('"foo a.js:1:1",0x2000,~')));
+  log.record(T.CODE_CREATION,
+             [].concat(varint(0), varint(3), varint(0xa000), varint(16),
+                       text('"Bar"')));
+  assertEquals(
+      ['code-creation,LazyCompile,0,0x12345678,300,"foo a.js:1:1",0x2000,~',
+       'code-creation,Builtin,3,0xa000,16,"Bar"'],
+      decode(log));
+})();
+
+(function testTickRecords() {
+  var log = new BinaryLog();
+  // Times are deltas to the previous tick, frames deltas to the previous
+  // frame starting from the pc.
+  log.record(T.TICK,
+             [].concat(varint(0x1000), signedVarint(100), varint(0 << 2 | 0),
+                       varint(0x2000), varint(2), signedVarint(0x10),
+                       signedVarint(-0x20)));
+  log.record(T.TICK,
+             [].concat(varint(0x1800), signedVarint(50), varint(2 << 2 | 3),
+                       varint(0x3000), varint(0)));
+  assertEquals(['tick,0x1000,100,0,0x2000,0,0x1010,0xff0',
+                'tick,0x1800,150,1,0x3000,2,overflow'],
+               decode(log));
+})();
+
+(function testLargeValues() {
+  var log = new BinaryLog();
+  var address = 0x7fff12345678;
+  log.record(T.TEXT, text('binary-log-tags,Function'));
+  log.record(T.CODE_CREATION,
+             [].concat(varint(0), varint(0), varint(address), varint(1),
+                       text('""')));
+  assertEquals(['code-creation,Function,0,0x7fff12345678,1,""'], decode(log));
+})();
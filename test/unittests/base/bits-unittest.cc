@@ -295,6 +295,25 @@ TEST(Bits, UnsignedMod32) {
   }
 }
 
+
+TEST(Bits, UnsignedMul128) {
+  uint64_t high;
+  EXPECT_EQ(0u, UnsignedMul128(0, V8_UINT64_C(0xffffffffffffffff), &high));
+  EXPECT_EQ(0u, high);
+  EXPECT_EQ(6u, UnsignedMul128(2, 3, &high));
+  EXPECT_EQ(0u, high);
+  EXPECT_EQ(0u, UnsignedMul128(V8_UINT64_C(0x100000000),
+                               V8_UINT64_C(0x100000000), &high));
+  EXPECT_EQ(1u, high);
+  EXPECT_EQ(1u, UnsignedMul128(V8_UINT64_C(0xffffffffffffffff),
+                               V8_UINT64_C(0xffffffffffffffff), &high));
+  EXPECT_EQ(V8_UINT64_C(0xfffffffffffffffe), high);
+  EXPECT_EQ(V8_UINT64_C(0x2236d88fe5618cf0),
+            UnsignedMul128(V8_UINT64_C(0x123456789abcdef0),
+                           V8_UINT64_C(0x0fedcba987654321), &high));
+  EXPECT_EQ(V8_UINT64_C(0x0121fa00ad77d742), high);
+}
+
 }  // namespace bits
 }  // namespace base
 }  // namespace v8
@@ -45,5 +45,30 @@ TEST(GCTracer, AverageSpeed) {
       GCTracer::AverageSpeed(buffer, MakeBytesAndDuration(0, 0), buffer.kSize));
 }
 
+TEST(GCTracer, LatencyHistogram) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(0u, histogram.count());
+  EXPECT_EQ(0, histogram.Percentile(0.5));
+  for (int i = 1; i <= 1000; i++) histogram.Record(i * 0.1);
+  EXPECT_EQ(1000u, histogram.count());
+  EXPECT_NEAR(50050, histogram.total_ms(), 1e-6);
+  EXPECT_DOUBLE_EQ(100, histogram.max_ms());
+  // Percentiles are upper bounds within 20% of the exact value.
+  const double fractions[] = {0.5, 0.9, 0.99, 0.999};
+  for (double fraction : fractions) {
+    double exact = fraction * 100;
+    EXPECT_LE(exact, histogram.Percentile(fraction));
+    EXPECT_GT(exact * 1.2, histogram.Percentile(fraction));
+  }
+  EXPECT_DOUBLE_EQ(100, histogram.Percentile(1));
+  // Very short and very long pauses end up in the first and last bucket.
+  histogram.Reset();
+  histogram.Record(0);
+  EXPECT_DOUBLE_EQ(0, histogram.Percentile(1));
+  histogram.Record(1e12);
+  EXPECT_DOUBLE_EQ(LatencyHistogram::kMinMs, histogram.Percentile(0.5));
+  EXPECT_DOUBLE_EQ(1e12, histogram.Percentile(1));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -20,9 +20,18 @@ struct MockTask : public Task {
 };
 
 
+struct MockIdleTask : public IdleTask {
+  virtual ~MockIdleTask() { Die(); }
+  MOCK_METHOD1(Run, void(double deadline_in_seconds));
+  MOCK_METHOD0(Die, void());
+};
+
+
 class DefaultPlatformWithMockTime : public DefaultPlatform {
  public:
-  DefaultPlatformWithMockTime() : time_(0) {}
+  explicit DefaultPlatformWithMockTime(
+      IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled)
+      : DefaultPlatform(idle_task_support), time_(0) {}
   double MonotonicallyIncreasingTime() override { return time_; }
   void IncreaseTime(double seconds) { time_ += seconds; }
 
@@ -126,6 +135,50 @@ TEST(DefaultPlatformTest, PendingDelayedTasksAreDestroyedOnShutdown) {
   }
 }
 
+TEST(DefaultPlatformTest, IdleTasksDisabledByDefault) {
+  int dummy;
+  Isolate* isolate = reinterpret_cast<Isolate*>(&dummy);
+
+  DefaultPlatform platform;
+  EXPECT_FALSE(platform.IdleTasksEnabled(isolate));
+}
+
+
+TEST(DefaultPlatformTest, RunIdleTasks) {
+  InSequence s;
+
+  int dummy;
+  Isolate* isolate = reinterpret_cast<Isolate*>(&dummy);
+
+  DefaultPlatformWithMockTime platform(IdleTaskSupport::kEnabled);
+  EXPECT_TRUE(platform.IdleTasksEnabled(isolate));
+
+  StrictMock<MockIdleTask>* task = new StrictMock<MockIdleTask>;
+  platform.CallIdleOnForegroundThread(isolate, task);
+  EXPECT_CALL(*task, Run(42.0 + 23.0));
+  EXPECT_CALL(*task, Die());
+  platform.IncreaseTime(23.0);
+  platform.RunIdleTasks(isolate, 42.0);
+}
+
+
+TEST(DefaultPlatformTest, RunIdleTasksWithoutTimeLeft) {
+  InSequence s;
+
+  int dummy;
+  Isolate* isolate = reinterpret_cast<Isolate*>(&dummy);
+
+  {
+    DefaultPlatformWithMockTime platform(IdleTaskSupport::kEnabled);
+    StrictMock<MockIdleTask>* task = new StrictMock<MockIdleTask>;
+    platform.CallIdleOnForegroundThread(isolate, task);
+    // An empty idle period does not run any tasks; pending idle tasks are
+    // destroyed with the platform.
+    platform.RunIdleTasks(isolate, 0.0);
+    EXPECT_CALL(*task, Die());
+  }
+}
+
 
 }  // namespace platform
 }  // namespace v8
@@ -9,6 +9,7 @@
 
 using testing::InSequence;
 using testing::IsNull;
+using testing::NotNull;
 using testing::StrictMock;
 
 namespace v8 {
@@ -45,6 +46,82 @@ TEST(TaskQueueTest, Basic) {
 }
 
 
+TEST(TaskQueueTest, Priorities) {
+  TaskQueue queue;
+  MockTask best_effort_task;
+  MockTask user_visible_task;
+  MockTask user_blocking_task;
+  queue.Append(&best_effort_task, Platform::kBestEffortTask, NULL);
+  queue.Append(&user_visible_task, Platform::kUserVisibleTask, NULL);
+  queue.Append(&user_blocking_task, Platform::kUserBlockingTask, NULL);
+  EXPECT_EQ(&user_blocking_task, queue.GetNext());
+  EXPECT_EQ(&user_visible_task, queue.GetNext());
+  EXPECT_EQ(&best_effort_task, queue.GetNext());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(), IsNull());
+}
+
+
+TEST(TaskQueueTest, FairnessBetweenIsolates) {
+  Isolate* isolate1 = reinterpret_cast<Isolate*>(0x1000);
+  Isolate* isolate2 = reinterpret_cast<Isolate*>(0x2040);
+  TaskQueue queue(2);
+  MockTask task1a;
+  MockTask task1b;
+  MockTask task2;
+  queue.Append(&task1a, Platform::kUserVisibleTask, isolate1);
+  queue.Append(&task1b, Platform::kUserVisibleTask, isolate1);
+  queue.Append(&task2, Platform::kUserVisibleTask, isolate2);
+  Task* first = queue.GetNext(0);
+  EXPECT_TRUE(first == &task1a || first == &task1b);
+  // While a task of the first isolate runs, the other isolate goes first.
+  EXPECT_EQ(&task2, queue.GetNext(1));
+  EXPECT_THAT(queue.GetNext(0), NotNull());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+  EXPECT_THAT(queue.GetNext(1), IsNull());
+}
+
+
+TEST(TaskQueueTest, StealingAndStats) {
+  TaskQueue queue(2);
+  MockTask task1;
+  MockTask task2;
+  queue.Append(&task1);
+  queue.Append(&task2);
+  // The tasks are spread over both workers, so the second one is stolen.
+  EXPECT_THAT(queue.GetNext(0), NotNull());
+  EXPECT_THAT(queue.GetNext(0), NotNull());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+
+  BackgroundTaskStats stats;
+  queue.GetStats(&stats);
+  EXPECT_EQ(0u, stats.tasks_run[Platform::kUserBlockingTask]);
+  EXPECT_EQ(2u, stats.tasks_run[Platform::kUserVisibleTask]);
+  EXPECT_EQ(0u, stats.tasks_run[Platform::kBestEffortTask]);
+  EXPECT_LE(stats.max_queue_time_in_seconds[Platform::kUserVisibleTask],
+            stats.total_queue_time_in_seconds[Platform::kUserVisibleTask]);
+  EXPECT_EQ(1u, stats.tasks_stolen);
+}
+
+
+TEST(TaskQueueTest, DelayedTasks) {
+  TaskQueue queue;
+  MockTask delayed_task;
+  MockTask task;
+  queue.AppendDelayed(&delayed_task, 0.01, Platform::kUserBlockingTask, NULL);
+  queue.Append(&task, Platform::kBestEffortTask, NULL);
+  EXPECT_EQ(&task, queue.GetNext());
+  // Blocks until the delayed task is due.
+  EXPECT_EQ(&delayed_task, queue.GetNext());
+  // Tasks that are not due yet are deleted with the queue.
+  queue.AppendDelayed(new MockTask(), 100, Platform::kUserVisibleTask, NULL);
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(), IsNull());
+}
+
+
 TEST(TaskQueueTest, TerminateMultipleReaders) {
   TaskQueue queue;
   TaskQueueThread thread1(&queue);
@@ -0,0 +1,228 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <sstream>
+#include <string>
+
+#include "include/libplatform/v8-tracing.h"
+#include "src/base/platform/platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+namespace {
+
+size_t CountOccurrences(const std::string& str, const std::string& pattern) {
+  size_t count = 0;
+  for (size_t pos = str.find(pattern); pos != std::string::npos;
+       pos = str.find(pattern, pos + 1)) {
+    ++count;
+  }
+  return count;
+}
+
+uint64_t AddEvent(TracingController* controller, char phase,
+                  const uint8_t* category_enabled_flag, const char* name) {
+  return controller->AddTraceEvent(phase, category_enabled_flag, name, nullptr,
+                                   0, 0, 0, nullptr, nullptr, nullptr, 0);
+}
+
+class TraceThread : public base::Thread {
+ public:
+  TraceThread(TracingController* controller, const uint8_t* category,
+              int num_events)
+      : Thread(Options("TraceThread")),
+        controller_(controller),
+        category_(category),
+        num_events_(num_events) {}
+
+  void Run() override {
+    for (int i = 0; i < num_events_; ++i) {
+      uint64_t handle = AddEvent(controller_, 'X', category_, "ThreadEvent");
+      controller_->UpdateTraceEventDuration(category_, "ThreadEvent", handle);
+    }
+  }
+
+ private:
+  TracingController* controller_;
+  const uint8_t* category_;
+  int num_events_;
+};
+
+}  // namespace
+
+
+TEST(TracingTest, TraceConfig) {
+  std::unique_ptr<TraceConfig> default_config(
+      TraceConfig::CreateDefaultTraceConfig());
+  EXPECT_TRUE(default_config->IsCategoryGroupEnabled("v8"));
+  EXPECT_TRUE(default_config->IsCategoryGroupEnabled("blink,v8"));
+  EXPECT_FALSE(default_config->IsCategoryGroupEnabled("v8.compile"));
+
+  std::unique_ptr<TraceConfig> config(TraceConfig::CreateFromCategoryFilter(
+      "v8*, -v8.compile,disabled-by-default-v8.runtime_stats"));
+  EXPECT_EQ(2u, config->GetIncludedCategories().size());
+  EXPECT_EQ(1u, config->GetExcludedCategories().size());
+  EXPECT_TRUE(config->IsCategoryGroupEnabled("v8"));
+  EXPECT_TRUE(config->IsCategoryGroupEnabled("v8.execute"));
+  EXPECT_FALSE(config->IsCategoryGroupEnabled("v8.compile"));
+  EXPECT_TRUE(config->IsCategoryGroupEnabled("v8.compile,v8.execute"));
+  EXPECT_FALSE(config->IsCategoryGroupEnabled("blink"));
+  EXPECT_TRUE(
+      config->IsCategoryGroupEnabled("disabled-by-default-v8.runtime_stats"));
+  EXPECT_FALSE(config->IsCategoryGroupEnabled("disabled-by-default-v8.gc"));
+
+  std::unique_ptr<TraceConfig> exclude_only(
+      TraceConfig::CreateFromCategoryFilter("-v8.compile"));
+  EXPECT_TRUE(exclude_only->IsCategoryGroupEnabled("blink"));
+  EXPECT_FALSE(exclude_only->IsCategoryGroupEnabled("v8.compile"));
+  EXPECT_FALSE(
+      exclude_only->IsCategoryGroupEnabled("disabled-by-default-v8.gc"));
+
+  std::unique_ptr<TraceConfig> wildcard(
+      TraceConfig::CreateFromCategoryFilter("*"));
+  EXPECT_TRUE(wildcard->IsCategoryGroupEnabled("v8"));
+  EXPECT_FALSE(wildcard->IsCategoryGroupEnabled("disabled-by-default-v8.gc"));
+
+  std::unique_ptr<TraceConfig> empty_exclude(
+      TraceConfig::CreateFromCategoryFilter("v8,-, - ,-v8.compile"));
+  EXPECT_EQ(1u, empty_exclude->GetIncludedCategories().size());
+  EXPECT_EQ(1u, empty_exclude->GetExcludedCategories().size());
+  EXPECT_TRUE(empty_exclude->IsCategoryGroupEnabled("v8"));
+  EXPECT_FALSE(empty_exclude->IsCategoryGroupEnabled("v8.compile"));
+}
+
+
+TEST(TracingTest, CategoryGroupEnabledFlags) {
+  std::ostringstream stream;
+  TracingController controller;
+  const uint8_t* v8 = controller.GetCategoryGroupEnabled("v8");
+  const uint8_t* blink = controller.GetCategoryGroupEnabled("blink");
+  EXPECT_EQ(v8, controller.GetCategoryGroupEnabled("v8"));
+  EXPECT_STREQ("v8", TracingController::GetCategoryGroupName(v8));
+  EXPECT_STREQ("blink", TracingController::GetCategoryGroupName(blink));
+  EXPECT_FALSE(*v8);
+
+  controller.Initialize(TraceBuffer::CreateTraceBufferRingBuffer(
+      TraceBuffer::kRingBufferChunks,
+      TraceWriter::CreateJSONTraceWriter(stream)));
+  controller.StartTracing(TraceConfig::CreateDefaultTraceConfig());
+  EXPECT_TRUE(*v8);
+  EXPECT_FALSE(*blink);
+  // Categories first seen while tracing get the current state, too.
+  EXPECT_TRUE(*controller.GetCategoryGroupEnabled("v8,renderer"));
+  controller.StopTracing();
+  EXPECT_FALSE(*v8);
+}
+
+
+TEST(TracingTest, JSONOutput) {
+  std::ostringstream stream;
+  TracingController controller;
+  controller.Initialize(TraceBuffer::CreateTraceBufferRingBuffer(
+      TraceBuffer::kRingBufferChunks,
+      TraceWriter::CreateJSONTraceWriter(stream)));
+  controller.StartTracing(TraceConfig::CreateDefaultTraceConfig());
+  const uint8_t* v8 = controller.GetCategoryGroupEnabled("v8");
+
+  uint64_t handle = AddEvent(&controller, 'X', v8, "Complete\"Event");
+  EXPECT_NE(0u, handle);
+  AddEvent(&controller, 'I', v8, "InstantEvent");
+  controller.UpdateTraceEventDuration(v8, "Complete\"Event", handle);
+  controller.StopTracing();
+
+  std::string json = stream.str();
+  EXPECT_EQ(0u, json.find("{\"traceEvents\":[{\"pid\":"));
+  EXPECT_EQ(json.size() - 2, json.rfind("]}"));
+  EXPECT_NE(std::string::npos, json.find("\"ph\":\"X\",\"cat\":\"v8\","
+                                         "\"name\":\"Complete\\\"Event\","
+                                         "\"dur\":"));
+  EXPECT_NE(std::string::npos, json.find("\"ph\":\"I\",\"cat\":\"v8\","
+                                         "\"name\":\"InstantEvent\","
+                                         "\"args\":{}}"));
+  EXPECT_EQ(2u, CountOccurrences(json, "\"ph\":"));
+}
+
+
+TEST(TracingTest, EventsOutlivingTheirChunk) {
+  std::ostringstream stream;
+  TracingController controller;
+  controller.Initialize(TraceBuffer::CreateTraceBufferRingBuffer(
+      TraceBuffer::kRingBufferChunks,
+      TraceWriter::CreateJSONTraceWriter(stream)));
+  controller.StartTracing(TraceConfig::CreateDefaultTraceConfig());
+  const uint8_t* v8 = controller.GetCategoryGroupEnabled("v8");
+
+  // The outer event's chunk fills up and is written out before it ends, so
+  // it is recorded as a begin/end pair.
+  uint64_t handle = AddEvent(&controller, 'X', v8, "Outer");
+  for (size_t i = 0; i < TraceBufferChunk::kChunkSize; ++i) {
+    uint64_t inner = AddEvent(&controller, 'X', v8, "Inner");
+    controller.UpdateTraceEventDuration(v8, "Inner", inner);
+  }
+  controller.UpdateTraceEventDuration(v8, "Outer", handle);
+  controller.StopTracing();
+
+  std::string json = stream.str();
+  EXPECT_EQ(TraceBufferChunk::kChunkSize,
+            CountOccurrences(json, "\"ph\":\"X\",\"cat\":\"v8\","
+                                   "\"name\":\"Inner\""));
+  EXPECT_EQ(1u, CountOccurrences(json, "\"ph\":\"B\",\"cat\":\"v8\","
+                                       "\"name\":\"Outer\""));
+  EXPECT_EQ(1u, CountOccurrences(json, "\"ph\":\"E\",\"cat\":\"v8\","
+                                       "\"name\":\"Outer\""));
+}
+
+
+TEST(TracingTest, MultipleThreads) {
+  static const int kNumThreads = 4;
+  static const int kEventsPerThread = 1000;
+  std::ostringstream stream;
+  TracingController controller;
+  controller.Initialize(TraceBuffer::CreateTraceBufferRingBuffer(
+      TraceBuffer::kRingBufferChunks,
+      TraceWriter::CreateJSONTraceWriter(stream)));
+  controller.StartTracing(TraceConfig::CreateDefaultTraceConfig());
+  const uint8_t* v8 = controller.GetCategoryGroupEnabled("v8");
+
+  std::unique_ptr<TraceThread> threads[kNumThreads];
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads[i].reset(new TraceThread(&controller, v8, kEventsPerThread));
+    threads[i]->Start();
+  }
+  for (int i = 0; i < kNumThreads; ++i) threads[i]->Join();
+  controller.StopTracing();
+
+  EXPECT_EQ(static_cast<size_t>(kNumThreads * kEventsPerThread),
+            CountOccurrences(stream.str(), "\"ph\":\"X\""));
+}
+
+
+TEST(TracingTest, FullBufferDropsOldestEvents) {
+  static const int kNumEvents = 10000;
+  std::ostringstream stream;
+  TracingController controller;
+  controller.Initialize(TraceBuffer::CreateTraceBufferRingBuffer(
+      1, TraceWriter::CreateJSONTraceWriter(stream)));
+  controller.StartTracing(TraceConfig::CreateDefaultTraceConfig());
+  const uint8_t* v8 = controller.GetCategoryGroupEnabled("v8");
+
+  // With a single chunk, full chunks the writer has not got to yet are
+  // recycled, but the most recent events are always kept.
+  for (int i = 0; i < kNumEvents; ++i) AddEvent(&controller, 'I', v8, "Event");
+  AddEvent(&controller, 'I', v8, "LastEvent");
+  controller.StopTracing();
+
+  std::string json = stream.str();
+  EXPECT_GE(static_cast<size_t>(kNumEvents),
+            CountOccurrences(json, "\"Event\""));
+  EXPECT_EQ(1u, CountOccurrences(json, "\"LastEvent\""));
+  EXPECT_EQ(json.size() - 2, json.rfind("]}"));
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
@@ -28,7 +28,7 @@ struct MockTask : public Task {
 TEST(WorkerThreadTest, Basic) {
   static const size_t kNumTasks = 10;
 
-  TaskQueue queue;
+  TaskQueue queue(2);
   for (size_t i = 0; i < kNumTasks; ++i) {
     InSequence s;
     StrictMock<MockTask>* task = new StrictMock<MockTask>;
@@ -37,8 +37,8 @@ TEST(WorkerThreadTest, Basic) {
     queue.Append(task);
   }
 
-  WorkerThread thread1(&queue);
-  WorkerThread thread2(&queue);
+  WorkerThread thread1(&queue, 0);
+  WorkerThread thread2(&queue, 1);
 
   // TaskQueue DCHECKS that it's empty in its destructor.
   queue.Terminate();
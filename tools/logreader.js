@@ -136,6 +136,119 @@ LogReader.prototype.processLogLine = function(line) {
 };
 
 
+/**
+ * First line of a log written with --log-binary.
+ */
+LogReader.BINARY_LOG_MAGIC = 'v8-binary-log,1';
+
+
+/**
+ * Record types of binary logs, see Log::RecordType in src/log-utils.h.
+ */
+LogReader.BinaryRecordType = {
+  TEXT: 0,
+  CODE_CREATION: 1,
+  TICK: 2
+};
+
+
+/**
+ * Processes a log written with --log-binary. Every record is turned back
+ * into the text line the logger writes without that flag.
+ *
+ * @param {ArrayBuffer} buffer Contents of the log file.
+ */
+LogReader.prototype.processBinaryLog = function(buffer) {
+  var bytes = new Uint8Array(buffer);
+  var pos = 0;
+  function readVarint() {
+    var value = 0;
+    var multiplier = 1;
+    var b;
+    do {
+      b = bytes[pos++];
+      value += (b & 0x7f) * multiplier;
+      multiplier *= 128;
+    } while (b & 0x80);
+    return value;
+  }
+  function readSignedVarint() {
+    var value = readVarint();
+    return value % 2 == 0 ? value / 2 : -(value + 1) / 2;
+  }
+  function readString(end) {
+    var str = '';
+    for (var i = pos; i < end; i += 0x1000) {
+      str += String.fromCharCode.apply(
+          null, bytes.subarray(i, Math.min(i + 0x1000, end)));
+    }
+    pos = end;
+    try {
+      // Names are written as UTF-8.
+      return decodeURIComponent(escape(str));
+    } catch (e) {
+      return str;
+    }
+  }
+  function hex(value) {
+    return '0x' + value.toString(16);
+  }
+
+  var magic = LogReader.BINARY_LOG_MAGIC + '\n';
+  for (; pos < magic.length; ++pos) {
+    if (bytes[pos] !== magic.charCodeAt(pos)) {
+      this.printError('not a binary log');
+      return;
+    }
+  }
+  var tags = [];
+  var time = 0;
+  while (pos < bytes.length) {
+    var type = bytes[pos++];
+    var length = readVarint();
+    var end = pos + length;
+    var line;
+    switch (type) {
+      case LogReader.BinaryRecordType.TEXT:
+        line = readString(end);
+        if (line.startsWith('binary-log-tags,')) {
+          tags = line.split(',').slice(1);
+          continue;
+        }
+        break;
+      case LogReader.BinaryRecordType.CODE_CREATION:
+        var tag = readVarint();
+        var kind = readVarint();
+        var start = readVarint();
+        var size = readVarint();
+        line = 'code-creation,' + tags[tag] + ',' + kind + ',' + hex(start) +
+            ',' + size + ',' + readString(end);
+        break;
+      case LogReader.BinaryRecordType.TICK:
+        var pc = readVarint();
+        time += readSignedVarint();
+        var flags = readVarint();
+        var tos = readVarint();
+        line = 'tick,' + hex(pc) + ',' + time + ',' + (flags & 1) + ',' +
+            hex(tos) + ',' + Math.floor(flags / 4);
+        if (flags & 2) line += ',overflow';
+        var frame = pc;
+        for (var n = readVarint(); n > 0; --n) {
+          frame += readSignedVarint();
+          line += ',' + hex(frame);
+        }
+        break;
+      default:
+        this.printError('unknown binary log record type ' + type);
+        pos = end;
+        continue;
+    }
+    pos = end;
+    this.processLogLine(line);
+  }
+};
+
+
 /**
  * Processes stack record.
  *
@@ -226,8 +226,13 @@ TickProcessor.prototype.isJsCode = function(name) {
 
 TickProcessor.prototype.processLogFile = function(fileName) {
   this.lastLogFileName_ = fileName;
-  var line;
-  while (line = readline()) {
+  var line = readline();
+  if (line == LogReader.BINARY_LOG_MAGIC) {
+    // Binary logs cannot be read line by line, read the whole file instead.
+    this.processBinaryLog(readbuffer(fileName));
+    return;
+  }
+  for (; line; line = readline()) {
     this.processLogLine(line);
   }
 };